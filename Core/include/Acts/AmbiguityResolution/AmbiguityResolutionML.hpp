@@ -15,6 +15,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace Acts {
@@ -43,6 +44,25 @@ class AmbiguityResolutionML {
         m_duplicateClassifier(m_cfg.inputDuplicateNN.c_str()),
         m_logger{std::move(logger)} {}
 
+  /// Construct the ambiguity resolution algorithm, passing additional
+  /// arguments to the network constructor.
+  ///
+  /// @param cfg is the algorithm configuration
+  /// @param logger is the logging instance
+  /// @param networkArgs are passed to the network after the model path
+  template <typename... network_args_t>
+  AmbiguityResolutionML(const Config& cfg,
+                        std::unique_ptr<const Logger> logger,
+                        network_args_t&&... networkArgs)
+      : m_cfg{cfg},
+        m_duplicateClassifier(m_cfg.inputDuplicateNN.c_str(),
+                              std::forward<network_args_t>(networkArgs)...),
+        m_logger{std::move(logger)} {}
+
+  /// Access the network used for the duplicate classification
+  /// @return the network instance
+  const AmbiguityNetwork& network() const { return m_duplicateClassifier; }
+
   /// Associate the hits to the tracks
   ///
   /// This algorithm performs the mapping of hits ID to track ID. Our final goal
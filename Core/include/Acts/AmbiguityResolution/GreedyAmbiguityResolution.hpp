@@ -11,9 +11,10 @@
 #include "Acts/EventData/TrackContainerFrontendConcept.hpp"
 #include "Acts/Utilities/Logger.hpp"
 
+#include <cstdint>
 #include <memory>
+#include <vector>
 
-#include <boost/container/flat_map.hpp>
 #include <boost/container/flat_set.hpp>
 
 namespace Acts {
@@ -31,6 +32,10 @@ namespace Acts {
 ///  3) Else, remove the track with the highest relative shared hits (i.e.
 ///     shared hits / hits).
 ///  4) Back to square 1.
+///
+/// The tracks are kept in a heap ordered by the eviction criteria. After a
+/// track is removed only the tracks which shared a measurement with it are
+/// updated, so a single iteration does not scale with the number of tracks.
 class GreedyAmbiguityResolution {
  public:
   /// Configuration parameters for greedy ambiguity resolution.
@@ -56,11 +61,9 @@ class GreedyAmbiguityResolution {
     /// Measurement indices for each track
     std::vector<std::vector<std::size_t>> measurementsPerTrack;
 
-    // TODO consider boost 1.81 unordered_flat_map
-    /// Map from measurement index to set of track indices using it
-    boost::container::flat_map<std::size_t,
-                               boost::container::flat_set<std::size_t>>
-        tracksPerMeasurement;
+    /// Set of track indices using a measurement, indexed by the measurement
+    /// index
+    std::vector<boost::container::flat_set<std::size_t>> tracksPerMeasurement;
     /// Number of shared measurements for each track
     std::vector<std::size_t> sharedMeasurementsPerTrack;
 
@@ -92,6 +95,18 @@ class GreedyAmbiguityResolution {
                            source_link_hash_t&& sourceLinkHash,
                            source_link_equality_t&& sourceLinkEquality) const;
 
+  /// Computes the initial state for input data where every source link can be
+  /// mapped to a dense measurement index, e.g. its position in the event
+  /// measurement container. This avoids hashing the source links.
+  ///
+  /// @param tracks The input track container.
+  /// @param state An empty state object which is expected to be default constructed.
+  /// @param sourceLinkIndex A functor to acquire the measurement index from a given source link.
+  template <TrackContainerFrontend track_container_t,
+            typename source_link_index_t>
+  void computeInitialState(const track_container_t& tracks, State& state,
+                           source_link_index_t&& sourceLinkIndex) const;
+
   /// Updates the state iteratively by evicting one track after the other until
   /// the final state conditions are met.
   ///
@@ -99,6 +114,15 @@ class GreedyAmbiguityResolution {
   void resolve(State& state) const;
 
  private:
+  /// Adds a track to the state if it passes the initial requirements.
+  template <typename track_proxy_t, typename measurement_index_t>
+  void addTrack(const track_proxy_t& track, State& state,
+                measurement_index_t&& measurementIndex) const;
+
+  /// Relates the measurements to the tracks and counts the shared
+  /// measurements after all tracks were added.
+  void computeSharedMeasurements(State& state) const;
+
   Config m_cfg;
 
   /// Logging instance
@@ -30,46 +30,54 @@ void GreedyAmbiguityResolution::computeInitialState(
   // count and chi2 and fill the measurement map in order to relate tracks to
   // each other if they have shared hits.
   for (const auto& track : tracks) {
-    // Kick out tracks that do not fulfill our initial requirements
-    if (track.nMeasurements() < m_cfg.nMeasurementsMin) {
-      continue;
-    }
-    std::vector<std::size_t> measurements;
-    for (auto ts : track.trackStatesReversed()) {
-      if (ts.typeFlags().isMeasurement()) {
-        SourceLink sourceLink = ts.getUncalibratedSourceLink();
-        // assign a new measurement index if the source link was not seen yet
-        auto emplace = measurementIndexMap.try_emplace(
-            sourceLink, measurementIndexMap.size());
-        measurements.push_back(emplace.first->second);
-      }
-    }
+    addTrack(track, state, [&](const SourceLink& sourceLink) {
+      // assign a new measurement index if the source link was not seen yet
+      auto emplace = measurementIndexMap.try_emplace(
+          sourceLink, measurementIndexMap.size());
+      return emplace.first->second;
+    });
+  }
 
-    state.trackTips.push_back(track.index());
-    state.trackChi2.push_back(track.chi2() / static_cast<float>(track.nDoF()));
-    state.measurementsPerTrack.push_back(std::move(measurements));
-    state.selectedTracks.insert(state.numberOfTracks);
+  computeSharedMeasurements(state);
+}
 
-    ++state.numberOfTracks;
+template <TrackContainerFrontend track_container_t,
+          typename source_link_index_t>
+void GreedyAmbiguityResolution::computeInitialState(
+    const track_container_t& tracks, State& state,
+    source_link_index_t&& sourceLinkIndex) const {
+  for (const auto& track : tracks) {
+    addTrack(track, state, [&](const SourceLink& sourceLink) {
+      return static_cast<std::size_t>(sourceLinkIndex(sourceLink));
+    });
   }
 
-  // Now we relate measurements to tracks
-  for (std::size_t iTrack = 0; iTrack < state.numberOfTracks; ++iTrack) {
-    for (auto iMeasurement : state.measurementsPerTrack[iTrack]) {
-      state.tracksPerMeasurement[iMeasurement].insert(iTrack);
-    }
-  }
+  computeSharedMeasurements(state);
+}
 
-  // Finally, we can accumulate the number of shared measurements per track
-  state.sharedMeasurementsPerTrack =
-      std::vector<std::size_t>(state.trackTips.size(), 0);
-  for (std::size_t iTrack = 0; iTrack < state.numberOfTracks; ++iTrack) {
-    for (auto iMeasurement : state.measurementsPerTrack[iTrack]) {
-      if (state.tracksPerMeasurement[iMeasurement].size() > 1) {
-        ++state.sharedMeasurementsPerTrack[iTrack];
-      }
+template <typename track_proxy_t, typename measurement_index_t>
+void GreedyAmbiguityResolution::addTrack(
+    const track_proxy_t& track, State& state,
+    measurement_index_t&& measurementIndex) const {
+  // Kick out tracks that do not fulfill our initial requirements
+  if (track.nMeasurements() < m_cfg.nMeasurementsMin) {
+    return;
+  }
+  std::vector<std::size_t> measurements;
+  measurements.reserve(track.nMeasurements());
+  for (auto ts : track.trackStatesReversed()) {
+    if (ts.typeFlags().isMeasurement()) {
+      measurements.push_back(
+          measurementIndex(ts.getUncalibratedSourceLink()));
     }
   }
+
+  state.trackTips.push_back(track.index());
+  state.trackChi2.push_back(track.chi2() / static_cast<float>(track.nDoF()));
+  state.measurementsPerTrack.push_back(std::move(measurements));
+  state.selectedTracks.insert(state.selectedTracks.end(), state.numberOfTracks);
+
+  ++state.numberOfTracks;
 }
 
 }  // namespace Acts
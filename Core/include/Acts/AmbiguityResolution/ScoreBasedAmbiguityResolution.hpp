@@ -17,6 +17,7 @@
 #include "Acts/Utilities/Logger.hpp"
 
 #include <cstddef>
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <numbers>
@@ -106,6 +107,56 @@ class ScoreBasedAmbiguityResolution {
     std::size_t nSharedHits = 0;
   };
 
+  /// @brief TrackFeatureTable struct : contains the features of all tracks in a structure-of-arrays layout.
+  ///
+  /// The counts of one detector are stored contiguously for all tracks, the
+  /// value for track `iTrack` in detector `iDetector` is found at
+  /// `iDetector * nTracks + iTrack`. This allows evaluating the detector cuts
+  /// and scores as loops over plain columns.
+  struct TrackFeatureTable {
+    /// Number of tracks in the table
+    std::size_t nTracks = 0;
+    /// Number of detectors in the table
+    std::size_t nDetectors = 0;
+
+    /// Number of hits per detector and track
+    std::vector<std::uint32_t> nHits;
+    /// Number of holes per detector and track
+    std::vector<std::uint32_t> nHoles;
+    /// Number of outliers per detector and track
+    std::vector<std::uint32_t> nOutliers;
+    /// Number of shared hits per detector and track
+    std::vector<std::uint32_t> nSharedHits;
+
+    /// Pseudorapidity of each track
+    std::vector<double> eta;
+    /// Transverse momentum of each track
+    std::vector<double> pT;
+    /// Chi-squared of each track
+    std::vector<float> chi2;
+    /// Number of degrees of freedom of each track
+    std::vector<unsigned int> nDoF;
+
+    /// Resize all columns and reset the counts to zero
+    /// @param nTracks_ is the number of tracks
+    /// @param nDetectors_ is the number of detectors
+    void reset(std::size_t nTracks_, std::size_t nDetectors_);
+
+    /// Index of a count in the detector columns
+    /// @param iTrack is the track index
+    /// @param iDetector is the detector index
+    /// @return the index into the count columns
+    std::size_t index(std::size_t iTrack, std::size_t iDetector) const {
+      return iDetector * nTracks + iTrack;
+    }
+
+    /// Gather the features of one track in one detector
+    /// @param iTrack is the track index
+    /// @param iDetector is the detector index
+    /// @return the track features
+    TrackFeatures features(std::size_t iTrack, std::size_t iDetector) const;
+  };
+
   /// Enumeration of track state types for ambiguity resolution
   enum class TrackStateTypes : std::uint8_t {
     // A measurement not yet used in any other track
@@ -189,6 +240,41 @@ class ScoreBasedAmbiguityResolution {
   std::vector<std::vector<TrackFeatures>> computeInitialState(
       const track_container_t& tracks) const;
 
+  /// Compute the features of all tracks in a single pass over the track
+  /// states.
+  ///
+  /// @param tracks is the input track container
+  /// @return the feature table of the tracks
+  template <TrackContainerFrontend track_container_t>
+  TrackFeatureTable computeFeatureTable(const track_container_t& tracks) const;
+
+  /// Compute the score of each track from the feature table. The detector
+  /// cuts and scores are evaluated column by column, only the optional cuts
+  /// and weights are called per track.
+  ///
+  /// @param tracks is the input track container
+  /// @param table is the feature table of the tracks
+  /// @param optionals is the user defined optional cuts to be applied.
+  /// @return a vector of scores for each track
+  template <TrackContainerFrontend track_container_t>
+  std::vector<double> simpleScore(
+      const track_container_t& tracks, const TrackFeatureTable& table,
+      const Optionals<typename track_container_t::ConstTrackProxy>& optionals =
+          {}) const;
+
+  /// Compute the score of each track based on the ambiguity function from
+  /// the feature table.
+  ///
+  /// @param tracks is the input track container
+  /// @param table is the feature table of the tracks
+  /// @param optionals is the user defined optional cuts to be applied.
+  /// @return a vector of scores for each track
+  template <TrackContainerFrontend track_container_t>
+  std::vector<double> ambiguityScore(
+      const track_container_t& tracks, const TrackFeatureTable& table,
+      const Optionals<typename track_container_t::ConstTrackProxy>& optionals =
+          {}) const;
+
   /// Compute the score of each track.
   ///
   /// @param tracks is the input track container
@@ -262,6 +348,55 @@ class ScoreBasedAmbiguityResolution {
           {}) const;
 
  private:
+  /// Fill the per track columns of the feature table
+  template <TrackContainerFrontend track_container_t>
+  void fillTrackColumns(const track_container_t& tracks,
+                        TrackFeatureTable& table) const;
+
+  /// Build the feature table from per track feature vectors
+  template <TrackContainerFrontend track_container_t>
+  TrackFeatureTable makeFeatureTable(
+      const track_container_t& tracks,
+      const std::vector<std::vector<TrackFeatures>>& trackFeaturesVectors)
+      const;
+
+  /// Mark the tracks which are rejected by the optional cuts
+  template <TrackContainerFrontend track_container_t>
+  void applyOptionalCuts(
+      const track_container_t& tracks,
+      const Optionals<typename track_container_t::ConstTrackProxy>& optionals,
+      std::vector<std::uint8_t>& rejected) const;
+
+  /// Check the counts of one detector against its eta dependent cuts
+  ///
+  /// @param detector is the detector configuration object
+  /// @param eta is the eta of the track
+  /// @param nHits is the number of hits in the detector
+  /// @param nHoles is the number of holes in the detector
+  /// @param nOutliers is the number of outliers in the detector
+  /// @param nSharedHits is the number of shared hits in the detector
+  /// @return true if the track is rejected, false otherwise
+  static bool rejectedByEtaCuts(const DetectorConfig& detector, double eta,
+                                std::size_t nHits, std::size_t nHoles,
+                                std::size_t nOutliers,
+                                std::size_t nSharedHits);
+
+  /// Mark the tracks which are rejected by the eta dependent detector cuts,
+  /// column by column of the feature table
+  void applyDetectorCuts(const TrackFeatureTable& table,
+                         std::vector<std::uint8_t>& rejected) const;
+
+  /// Add the weighted hit, hole, outlier and shared hit counts of all
+  /// detectors to the scores
+  void addDetectorScores(const TrackFeatureTable& table,
+                         std::vector<double>& scores) const;
+
+  /// Multiply the scores of the tracks which are not rejected with the hit
+  /// and hole factors of all detectors
+  void applyDetectorFactors(const TrackFeatureTable& table,
+                            const std::vector<std::uint8_t>& rejected,
+                            std::vector<double>& scores) const;
+
   Config m_cfg;
 
   /// Logging instance
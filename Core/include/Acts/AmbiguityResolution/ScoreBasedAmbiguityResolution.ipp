@@ -12,8 +12,11 @@
 
 #include "Acts/Definitions/Units.hpp"
 #include "Acts/EventData/TrackContainerFrontendConcept.hpp"
+#include "Acts/Geometry/GeometryIdentifier.hpp"
 #include "Acts/Utilities/VectorHelpers.hpp"
 
+#include <cmath>
+#include <limits>
 #include <unordered_map>
 
 namespace Acts {
@@ -23,47 +26,77 @@ inline const Logger& ScoreBasedAmbiguityResolution::logger() const {
 }
 
 template <TrackContainerFrontend track_container_t>
-std::vector<std::vector<ScoreBasedAmbiguityResolution::TrackFeatures>>
-ScoreBasedAmbiguityResolution::computeInitialState(
+ScoreBasedAmbiguityResolution::TrackFeatureTable
+ScoreBasedAmbiguityResolution::computeFeatureTable(
     const track_container_t& tracks) const {
-  ACTS_VERBOSE("Starting to compute initial state");
-  std::vector<std::vector<TrackFeatures>> trackFeaturesVectors;
-  trackFeaturesVectors.reserve(tracks.size());
-
-  for (const auto& track : tracks) {
-    std::size_t numberOfDetectors = m_cfg.detectorConfigs.size();
-
-    std::vector<TrackFeatures> trackFeaturesVector(numberOfDetectors);
+  ACTS_VERBOSE("Starting to compute feature table");
+  TrackFeatureTable table;
+  table.reset(tracks.size(), m_cfg.detectorConfigs.size());
+
+  // Flat lookup from volume ID to detector ID
+  constexpr std::size_t kNoDetector = std::numeric_limits<std::size_t>::max();
+  std::vector<std::size_t> detectorIds(GeometryIdentifier::getMaxVolume() + 1,
+                                       kNoDetector);
+  for (const auto& [iVolume, detectorId] : m_cfg.volumeMap) {
+    if (iVolume < detectorIds.size() && detectorId < table.nDetectors) {
+      detectorIds[iVolume] = detectorId;
+    }
+  }
 
+  for (std::size_t iTrack = 0; const auto& track : tracks) {
     for (const auto& ts : track.trackStatesReversed()) {
       if (!ts.hasReferenceSurface()) {
         ACTS_DEBUG("Track state has no reference surface");
         continue;
       }
       auto iVolume = ts.referenceSurface().geometryId().volume();
-      auto volume_it = m_cfg.volumeMap.find(iVolume);
-      if (volume_it == m_cfg.volumeMap.end()) {
+      std::size_t detectorId = detectorIds[iVolume];
+      if (detectorId == kNoDetector) {
         ACTS_ERROR("Volume " << iVolume << "not found in the volume map");
         continue;
       }
-      auto detectorId = volume_it->second;
+      std::size_t index = table.index(iTrack, detectorId);
 
       if (ts.typeFlags().isHole()) {
         ACTS_VERBOSE("Track state type is HoleFlag");
-        trackFeaturesVector[detectorId].nHoles++;
+        table.nHoles[index]++;
       } else if (ts.typeFlags().isOutlier()) {
         ACTS_VERBOSE("Track state type is OutlierFlag");
-        trackFeaturesVector[detectorId].nOutliers++;
-
+        table.nOutliers[index]++;
       } else if (ts.typeFlags().isMeasurement()) {
         ACTS_VERBOSE("Track state type is MeasurementFlag");
 
         if (ts.typeFlags().isSharedHit()) {
-          trackFeaturesVector[detectorId].nSharedHits++;
+          table.nSharedHits[index]++;
         }
-        trackFeaturesVector[detectorId].nHits++;
+        table.nHits[index]++;
       }
     }
+    iTrack++;
+  }
+
+  fillTrackColumns(tracks, table);
+
+  return table;
+}
+
+template <TrackContainerFrontend track_container_t>
+std::vector<std::vector<ScoreBasedAmbiguityResolution::TrackFeatures>>
+ScoreBasedAmbiguityResolution::computeInitialState(
+    const track_container_t& tracks) const {
+  ACTS_VERBOSE("Starting to compute initial state");
+  const TrackFeatureTable table = computeFeatureTable(tracks);
+
+  std::vector<std::vector<TrackFeatures>> trackFeaturesVectors;
+  trackFeaturesVectors.reserve(table.nTracks);
+
+  for (std::size_t iTrack = 0; iTrack < table.nTracks; ++iTrack) {
+    std::vector<TrackFeatures> trackFeaturesVector;
+    trackFeaturesVector.reserve(table.nDetectors);
+    for (std::size_t iDetector = 0; iDetector < table.nDetectors;
+         ++iDetector) {
+      trackFeaturesVector.push_back(table.features(iTrack, iDetector));
+    }
     trackFeaturesVectors.push_back(std::move(trackFeaturesVector));
   }
 
@@ -71,104 +104,106 @@ ScoreBasedAmbiguityResolution::computeInitialState(
 }
 
 template <TrackContainerFrontend track_container_t>
-std::vector<double> Acts::ScoreBasedAmbiguityResolution::simpleScore(
-    const track_container_t& tracks,
-    const std::vector<std::vector<TrackFeatures>>& trackFeaturesVectors,
-    const Optionals<typename track_container_t::ConstTrackProxy>& optionals)
-    const {
-  std::vector<double> trackScore;
-  trackScore.reserve(tracks.size());
+void ScoreBasedAmbiguityResolution::fillTrackColumns(
+    const track_container_t& tracks, TrackFeatureTable& table) const {
+  for (std::size_t iTrack = 0; const auto& track : tracks) {
+    table.eta[iTrack] = VectorHelpers::eta(track.momentum());
+    table.pT[iTrack] = VectorHelpers::perp(track.momentum());
+    table.chi2[iTrack] = track.chi2();
+    table.nDoF[iTrack] = track.nDoF();
+    iTrack++;
+  }
+}
 
-  int iTrack = 0;
+template <TrackContainerFrontend track_container_t>
+ScoreBasedAmbiguityResolution::TrackFeatureTable
+ScoreBasedAmbiguityResolution::makeFeatureTable(
+    const track_container_t& tracks,
+    const std::vector<std::vector<TrackFeatures>>& trackFeaturesVectors) const {
+  TrackFeatureTable table;
+  table.reset(tracks.size(), m_cfg.detectorConfigs.size());
+
+  for (std::size_t iTrack = 0; iTrack < table.nTracks; ++iTrack) {
+    for (std::size_t iDetector = 0; iDetector < table.nDetectors;
+         ++iDetector) {
+      const TrackFeatures& trackFeatures =
+          trackFeaturesVectors[iTrack][iDetector];
+      std::size_t index = table.index(iTrack, iDetector);
+      table.nHits[index] = trackFeatures.nHits;
+      table.nHoles[index] = trackFeatures.nHoles;
+      table.nOutliers[index] = trackFeatures.nOutliers;
+      table.nSharedHits[index] = trackFeatures.nSharedHits;
+    }
+  }
 
-  ACTS_VERBOSE("Number of detectors: " << m_cfg.detectorConfigs.size());
+  fillTrackColumns(tracks, table);
 
-  ACTS_INFO("Starting to score tracks");
+  return table;
+}
 
-  // Loop over all the tracks in the container
-  for (const auto& track : tracks) {
-    // get the trackFeatures map for the track
-    const auto& trackFeaturesVector = trackFeaturesVectors[iTrack];
-    double score = 1;
-    auto eta = Acts::VectorHelpers::eta(track.momentum());
+template <TrackContainerFrontend track_container_t>
+void ScoreBasedAmbiguityResolution::applyOptionalCuts(
+    const track_container_t& tracks,
+    const Optionals<typename track_container_t::ConstTrackProxy>& optionals,
+    std::vector<std::uint8_t>& rejected) const {
+  if (optionals.cuts.empty()) {
+    return;
+  }
 
-    // cuts on optional cuts
+  for (std::size_t iTrack = 0; const auto& track : tracks) {
     for (const auto& cutFunction : optionals.cuts) {
       if (cutFunction(track)) {
-        score = 0;
+        rejected[iTrack] = 1;
         ACTS_DEBUG("Track: " << iTrack
                              << " has score = 0, due to optional cuts.");
         break;
       }
     }
+    iTrack++;
+  }
+}
 
-    if (score == 0) {
-      iTrack++;
-      trackScore.push_back(score);
-      ACTS_DEBUG("Track: " << iTrack << " score : " << score);
-      continue;
-    }
-
-    // Reject tracks which didn't pass the detector cuts.
-    for (std::size_t detectorId = 0; detectorId < m_cfg.detectorConfigs.size();
-         detectorId++) {
-      const auto& detector = m_cfg.detectorConfigs.at(detectorId);
-
-      const auto& trackFeatures = trackFeaturesVector[detectorId];
+template <TrackContainerFrontend track_container_t>
+std::vector<double> Acts::ScoreBasedAmbiguityResolution::simpleScore(
+    const track_container_t& tracks, const TrackFeatureTable& table,
+    const Optionals<typename track_container_t::ConstTrackProxy>& optionals)
+    const {
+  ACTS_VERBOSE("Number of detectors: " << m_cfg.detectorConfigs.size());
 
-      ACTS_VERBOSE("---> Found summary information");
-      ACTS_VERBOSE("---> Detector ID: " << detectorId);
-      ACTS_VERBOSE("---> Number of hits: " << trackFeatures.nHits);
-      ACTS_VERBOSE("---> Number of holes: " << trackFeatures.nHoles);
-      ACTS_VERBOSE("---> Number of outliers: " << trackFeatures.nOutliers);
+  ACTS_INFO("Starting to score tracks");
 
-      // eta based cuts
-      if (etaBasedCuts(detector, trackFeatures, eta)) {
-        score = 0;
-        ACTS_DEBUG("Track: " << iTrack
-                             << " has score = 0, due to detector cuts");
-        break;
+  // Reject tracks which didn't pass the optional or detector cuts.
+  std::vector<std::uint8_t> rejected(table.nTracks, 0);
+  applyOptionalCuts(tracks, optionals, rejected);
+  applyDetectorCuts(table, rejected);
+
+  ACTS_VERBOSE("Using Simple Scoring function");
+
+  // Adding the score for each detector.
+  // detector score is determined by the number of hits/hole/outliers *
+  // hit/hole/outlier scoreWeights in a detector.
+  std::vector<double> trackScore(table.nTracks, 100);
+  addDetectorScores(table, trackScore);
+
+  // Adding scores based on optional weights
+  if (!optionals.weights.empty()) {
+    for (std::size_t iTrack = 0; const auto& track : tracks) {
+      if (rejected[iTrack] == 0) {
+        for (const auto& weightFunction : optionals.weights) {
+          weightFunction(track, trackScore[iTrack]);
+        }
       }
-    }
-
-    if (score == 0) {
       iTrack++;
-      trackScore.push_back(score);
-      ACTS_DEBUG("Track: " << iTrack << " score : " << score);
-      continue;
-    }
-
-    // All cuts passed, now start scoring the track
-
-    ACTS_VERBOSE("Using Simple Scoring function");
-
-    score = 100;
-    // Adding the score for each detector.
-    // detector score is determined by the number of hits/hole/outliers *
-    // hit/hole/outlier scoreWeights in a detector.
-    for (std::size_t detectorId = 0; detectorId < m_cfg.detectorConfigs.size();
-         detectorId++) {
-      const auto& detector = m_cfg.detectorConfigs.at(detectorId);
-      const auto& trackFeatures = trackFeaturesVector[detectorId];
-
-      score +=
-          static_cast<double>(trackFeatures.nHits * detector.hitsScoreWeight);
-      score +=
-          static_cast<double>(trackFeatures.nHoles * detector.holesScoreWeight);
-      score += static_cast<double>(trackFeatures.nOutliers *
-                                   detector.outliersScoreWeight);
-      score += static_cast<double>(trackFeatures.nSharedHits *
-                                   detector.otherScoreWeight);
     }
+  }
 
-    // Adding scores based on optional weights
-    for (const auto& weightFunction : optionals.weights) {
-      weightFunction(track, score);
-    }
+  for (std::size_t iTrack = 0; iTrack < table.nTracks; ++iTrack) {
+    double& score = trackScore[iTrack];
 
     // Adding the score based on the chi2/ndf
-    if (track.chi2() > 0 && track.nDoF() > 0) {
-      double p = 1. / std::log10(10. + 10. * track.chi2() / track.nDoF());
+    if (table.chi2[iTrack] > 0 && table.nDoF[iTrack] > 0) {
+      double p =
+          1. / std::log10(10. + 10. * table.chi2[iTrack] / table.nDoF[iTrack]);
       if (p > 0) {
         score += p;
       } else {
@@ -176,154 +211,92 @@ std::vector<double> Acts::ScoreBasedAmbiguityResolution::simpleScore(
       }
     }
 
-    iTrack++;
-
-    // Add the score to the vector
-    trackScore.push_back(score);
+    if (rejected[iTrack] != 0) {
+      score = 0;
+    }
     ACTS_VERBOSE("Track: " << iTrack << " score: " << score);
-
-  }  // end of loop over tracks
+  }
 
   return trackScore;
 }
 
 template <TrackContainerFrontend track_container_t>
-std::vector<double> Acts::ScoreBasedAmbiguityResolution::ambiguityScore(
+std::vector<double> Acts::ScoreBasedAmbiguityResolution::simpleScore(
     const track_container_t& tracks,
     const std::vector<std::vector<TrackFeatures>>& trackFeaturesVectors,
     const Optionals<typename track_container_t::ConstTrackProxy>& optionals)
     const {
-  std::vector<double> trackScore;
-  trackScore.reserve(tracks.size());
+  return simpleScore(tracks, makeFeatureTable(tracks, trackFeaturesVectors),
+                     optionals);
+}
 
+template <TrackContainerFrontend track_container_t>
+std::vector<double> Acts::ScoreBasedAmbiguityResolution::ambiguityScore(
+    const track_container_t& tracks, const TrackFeatureTable& table,
+    const Optionals<typename track_container_t::ConstTrackProxy>& optionals)
+    const {
   ACTS_VERBOSE("Using Ambiguity Scoring function");
 
-  int iTrack = 0;
-
   ACTS_VERBOSE("Number of detectors: " << m_cfg.detectorConfigs.size());
 
   ACTS_INFO("Starting to score tracks");
 
-  // Loop over all the tracks in the container
-  for (const auto& track : tracks) {
-    // get the trackFeatures map for the track
-    const auto& trackFeaturesVector = trackFeaturesVectors[iTrack];
-    double score = 1;
-    auto pT = Acts::VectorHelpers::perp(track.momentum());
-    auto eta = Acts::VectorHelpers::eta(track.momentum());
-
-    // cuts on optional cuts
-    for (const auto& cutFunction : optionals.cuts) {
-      if (cutFunction(track)) {
-        score = 0;
-        ACTS_DEBUG("Track: " << iTrack
-                             << " has score = 0, due to optional cuts.");
-        break;
-      }
-    }
-
-    if (score == 0) {
-      iTrack++;
-      trackScore.push_back(score);
-      ACTS_DEBUG("Track: " << iTrack << " score : " << score);
-      continue;
-    }
+  // Reject tracks which didn't pass the optional or detector cuts.
+  std::vector<std::uint8_t> rejected(table.nTracks, 0);
+  applyOptionalCuts(tracks, optionals, rejected);
+  applyDetectorCuts(table, rejected);
 
-    // Reject tracks which didn't pass the detector cuts.
-    for (std::size_t detectorId = 0; detectorId < m_cfg.detectorConfigs.size();
-         detectorId++) {
-      const auto& detector = m_cfg.detectorConfigs.at(detectorId);
-
-      const auto& trackFeatures = trackFeaturesVector[detectorId];
+  // start with larger score for tracks with higher pT.
+  // pT in GeV, hence 100 MeV is minimum and gets score = 1
+  std::vector<double> trackScore(table.nTracks);
+  for (std::size_t iTrack = 0; iTrack < table.nTracks; ++iTrack) {
+    trackScore[iTrack] = std::log10(table.pT[iTrack] / UnitConstants::MeV) - 1.;
+  }
 
-      ACTS_VERBOSE("---> Found summary information");
-      ACTS_VERBOSE("---> Detector ID: " << detectorId);
-      ACTS_VERBOSE("---> Number of hits: " << trackFeatures.nHits);
-      ACTS_VERBOSE("---> Number of holes: " << trackFeatures.nHoles);
-      ACTS_VERBOSE("---> Number of outliers: " << trackFeatures.nOutliers);
+  // choosing a scaling factor based on the number of hits and holes in a
+  // track per detector.
+  applyDetectorFactors(table, rejected, trackScore);
 
-      // eta based cuts
-      if (etaBasedCuts(detector, trackFeatures, eta)) {
-        score = 0;
-        ACTS_DEBUG("Track: " << iTrack
-                             << " has score = 0, due to detector cuts");
-        break;
+  if (!optionals.scores.empty()) {
+    for (std::size_t iTrack = 0; const auto& track : tracks) {
+      if (rejected[iTrack] == 0) {
+        for (const auto& scoreFunction : optionals.scores) {
+          scoreFunction(track, trackScore[iTrack]);
+        }
       }
-    }
-
-    if (score == 0) {
       iTrack++;
-      trackScore.push_back(score);
-      ACTS_DEBUG("Track: " << iTrack << " score : " << score);
-      continue;
-    }
-
-    // All cuts passed, now start scoring the track
-
-    // start with larger score for tracks with higher pT.
-    score = std::log10(pT / UnitConstants::MeV) - 1.;
-    // pT in GeV, hence 100 MeV is minimum and gets score = 1
-    ACTS_DEBUG("Modifier for pT = " << pT << " GeV is : " << score
-                                    << "  New score now: " << score);
-
-    for (std::size_t detectorId = 0; detectorId < m_cfg.detectorConfigs.size();
-         detectorId++) {
-      const auto& detector = m_cfg.detectorConfigs.at(detectorId);
-
-      const auto& trackFeatures = trackFeaturesVector[detectorId];
-
-      // choosing a scaling factor based on the number of hits in a track per
-      // detector.
-      std::size_t nHits = trackFeatures.nHits;
-      if (nHits > detector.maxHits) {
-        score = score * static_cast<double>(nHits - detector.maxHits +
-                                            1);  // hits are good !
-        nHits = detector.maxHits;
-      }
-      score = score * detector.factorHits[nHits];
-      ACTS_DEBUG("Modifier for " << nHits
-                                 << " hits: " << detector.factorHits[nHits]
-                                 << "  New score now: " << score);
-
-      // choosing a scaling factor based on the number of holes in a track per
-      // detector.
-      std::size_t iHoles = trackFeatures.nHoles;
-      if (iHoles > detector.maxHoles) {
-        // holes are bad !
-        score /= static_cast<double>(iHoles - detector.maxHoles + 1);
-        iHoles = detector.maxHoles;
-      }
-      score = score * detector.factorHoles[iHoles];
-      ACTS_DEBUG("Modifier for " << iHoles
-                                 << " holes: " << detector.factorHoles[iHoles]
-                                 << "  New score now: " << score);
     }
+  }
 
-    for (const auto& scoreFunction : optionals.scores) {
-      scoreFunction(track, score);
-    }
+  for (std::size_t iTrack = 0; iTrack < table.nTracks; ++iTrack) {
+    double& score = trackScore[iTrack];
 
-    if (track.chi2() > 0 && track.nDoF() > 0) {
-      double chi2 = track.chi2();
-      int indf = track.nDoF();
+    if (table.chi2[iTrack] > 0 && table.nDoF[iTrack] > 0) {
+      double chi2 = table.chi2[iTrack];
+      int indf = table.nDoF[iTrack];
       double fac = 1. / std::log10(10. + 10. * chi2 / indf);
       score = score * fac;
-      ACTS_DEBUG("Modifier for chi2 = " << chi2 << " and NDF = " << indf
-                                        << " is : " << fac
-                                        << "  New score now: " << score);
     }
 
-    iTrack++;
-
-    // Add the score to the vector
-    trackScore.push_back(score);
+    if (rejected[iTrack] != 0) {
+      score = 0;
+    }
     ACTS_VERBOSE("Track: " << iTrack << " score: " << score);
-
-  }  // end of loop over tracks
+  }
 
   return trackScore;
 }
 
+template <TrackContainerFrontend track_container_t>
+std::vector<double> Acts::ScoreBasedAmbiguityResolution::ambiguityScore(
+    const track_container_t& tracks,
+    const std::vector<std::vector<TrackFeatures>>& trackFeaturesVectors,
+    const Optionals<typename track_container_t::ConstTrackProxy>& optionals)
+    const {
+  return ambiguityScore(tracks, makeFeatureTable(tracks, trackFeaturesVectors),
+                        optionals);
+}
+
 template <TrackContainerFrontend track_container_t, typename source_link_hash_t,
           typename source_link_equality_t>
 std::vector<int> Acts::ScoreBasedAmbiguityResolution::solveAmbiguity(
@@ -332,18 +305,16 @@ std::vector<int> Acts::ScoreBasedAmbiguityResolution::solveAmbiguity(
     const Optionals<typename track_container_t::ConstTrackProxy>& optionals)
     const {
   ACTS_INFO("Number of tracks before Ambiguty Resolution: " << tracks.size());
-  // vector of trackFeaturesVectors. where each trackFeaturesVector contains the
-  // number of hits/hole/outliers for each detector in a track.
+  // feature table with the number of hits/hole/outliers for each detector
+  // and track.
 
-  const std::vector<std::vector<TrackFeatures>> trackFeaturesVectors =
-      computeInitialState<track_container_t>(tracks);
+  const TrackFeatureTable table = computeFeatureTable(tracks);
 
   std::vector<double> trackScore;
-  trackScore.reserve(tracks.size());
   if (m_cfg.useAmbiguityScoring) {
-    trackScore = ambiguityScore(tracks, trackFeaturesVectors, optionals);
+    trackScore = ambiguityScore(tracks, table, optionals);
   } else {
-    trackScore = simpleScore(tracks, trackFeaturesVectors, optionals);
+    trackScore = simpleScore(tracks, table, optionals);
   }
 
   auto MeasurementIndexMap =
@@ -20,8 +20,12 @@
 #include "Acts/Utilities/detail/ContainerIterator.hpp"
 
 #include <any>
+#include <concepts>
+#include <ranges>
+#include <span>
 #include <string>
 #include <string_view>
+#include <vector>
 
 namespace Acts {
 
@@ -351,6 +355,43 @@ class TrackContainer {
     m_traj->clear();
   }
 
+  /// Remove all track states which do not belong to one of the given tracks
+  /// from the track state container and compact its storage.
+  ///
+  /// The tip and stem indices of all tracks are updated. Other tracks keep
+  /// only the track states they share with the given tracks and are left
+  /// without track states if their tip was removed.
+  /// @note Only available if the track container is not read-only and the
+  ///       track state container supports compaction
+  /// @note This invalidates all track state proxies into this container
+  /// @param tracks The indices of the tracks whose track states are kept
+  template <std::ranges::input_range track_range_t>
+  void compactTrackStates(const track_range_t& tracks)
+    requires(!ReadOnly &&
+             requires(traj_t& traj, std::span<const IndexType> tips) {
+               {
+                 traj.compact(tips)
+               } -> std::same_as<std::vector<IndexType>>;
+             })
+  {
+    std::vector<IndexType> tips;
+    for (IndexType itrack : tracks) {
+      tips.push_back(component<IndexType, hashString("tipIndex")>(itrack));
+    }
+
+    const std::vector<IndexType> stateMap = m_traj->compact(tips);
+    auto remap = [&stateMap](IndexType i) {
+      return i < stateMap.size() ? stateMap[i] : kInvalid;
+    };
+
+    for (IndexType itrack = 0; itrack < size(); ++itrack) {
+      auto& tip = component<IndexType, hashString("tipIndex")>(itrack);
+      auto& stem = component<IndexType, hashString("stemIndex")>(itrack);
+      tip = remap(tip);
+      stem = tip != kInvalid ? remap(stem) : kInvalid;
+    }
+  }
+
  protected:
   /// @brief Get mutable reference to track component using compile-time key
   /// @tparam T Component type to retrieve
@@ -26,6 +26,7 @@
 #include <iosfwd>
 #include <memory>
 #include <optional>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <string_view>
@@ -564,6 +565,18 @@ class VectorMultiTrajectory final
   /// Reserve space for track states
   /// @param n Number of track states to reserve space for
   void reserve(std::size_t n);
+
+  /// Remove all track states which cannot be reached from any of the given
+  /// tips by following the previous indices, and compact the storage of the
+  /// remaining ones. The relative order of the kept track states is
+  /// preserved and shared components stay shared. The allocated capacity is
+  /// kept for reuse.
+  /// @note This invalidates all track state proxies into this container
+  /// @param tips The tip indices of the trajectories to keep, invalid
+  ///        indices are ignored
+  /// @return The new index of every old track state, or @c kTrackIndexInvalid
+  ///         if the track state was removed
+  std::vector<IndexType> compact(std::span<const IndexType> tips);
 };
 
 static_assert(
@@ -11,10 +11,12 @@
 #include "Acts/Geometry/GeometryIdentifier.hpp"
 
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <initializer_list>
 #include <iterator>
 #include <stdexcept>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -54,6 +56,12 @@ namespace Acts {
 ///   or index-based access. Any apparent ordering must be considered an
 ///   implementation detail and might change.
 ///
+/// Lookups use a hash index over the stored identifiers. Only the truncations
+/// of the requested identifier to its leading levels can match, so at most one
+/// index lookup per hierarchy level is needed, independent of the number of
+/// stored elements. If any stored identifier uses the extra level, lookups fall
+/// back to a search in the sorted identifiers.
+///
 /// Adding elements is potentially expensive as the internal lookup structure
 /// must be updated. In addition, modifying an element in-place could change its
 /// identifier which would also break the lookup. Thus, the container can not be
@@ -171,6 +179,9 @@ class GeometryHierarchyMap {
   // validity bit masks for the ids: which parts to use for comparison
   std::vector<Identifier> m_masks;
   std::vector<Value> m_values;
+  // position of each element by its encoded id. empty if the index is not
+  // used because some ids have the extra level set.
+  std::unordered_map<Identifier, std::size_t> m_index;
 
   /// Construct a mask where all leading non-zero levels are set.
   static constexpr Identifier makeLeadingLevelsMask(GeometryIdentifier id) {
@@ -225,6 +236,12 @@ class GeometryHierarchyMap {
   /// This assumes that the elements are ordered and unique with respect to
   /// their identifiers.
   void fill(const std::vector<InputElement>& elements);
+
+  /// Find the most specific element using the hash index.
+  Iterator findInIndex(const GeometryIdentifier& id) const;
+
+  /// Find the most specific element by searching the sorted identifiers.
+  Iterator findInSorted(const GeometryIdentifier& id) const;
 };
 
 // implementations
@@ -266,6 +283,7 @@ inline void GeometryHierarchyMap<value_t>::fill(
   m_ids.clear();
   m_masks.clear();
   m_values.clear();
+  m_index.clear();
 
   m_ids.reserve(elements.size());
   m_masks.reserve(elements.size());
@@ -277,6 +295,19 @@ inline void GeometryHierarchyMap<value_t>::fill(
         makeLeadingLevelsMask(GeometryIdentifier(element.first.value())));
     m_values.push_back(std::move(element.second));
   }
+
+  // the extra level is ignored by the masks. identifiers with extra bits
+  // could therefore match identifiers that differ from all their
+  // truncations, which the index can not represent.
+  const bool useIndex = std::ranges::none_of(elements, [](const auto& element) {
+    return element.first.extra() != 0u;
+  });
+  if (useIndex) {
+    m_index.reserve(m_ids.size());
+    for (std::size_t i = 0; i < m_ids.size(); ++i) {
+      m_index.emplace(m_ids[i], i);
+    }
+  }
 }
 
 template <typename value_t>
@@ -287,6 +318,42 @@ inline auto GeometryHierarchyMap<value_t>::find(
   assert((m_masks.size() == m_values.size()) &&
          "Inconsistent container state: #masks != #values");
 
+  if (!m_index.empty()) {
+    return findInIndex(id);
+  }
+  return findInSorted(id);
+}
+
+template <typename value_t>
+inline auto GeometryHierarchyMap<value_t>::findInIndex(
+    const GeometryIdentifier& id) const -> Iterator {
+  // a stored element matches if it is equal to the requested id truncated to
+  // the leading levels of the stored element. checking all truncations from
+  // the most to the least specific one returns the most specific match.
+  const GeometryIdentifier sensitive = id.withExtra(0u);
+  const GeometryIdentifier approach = sensitive.withSensitive(0u);
+  const GeometryIdentifier layer = approach.withApproach(0u);
+  const GeometryIdentifier boundary = layer.withLayer(0u);
+  const GeometryIdentifier volume = boundary.withBoundary(0u);
+  const std::array<Identifier, 6> candidates = {
+      sensitive.value(), approach.value(), layer.value(),
+      boundary.value(),  volume.value(),   Identifier{0u}};
+
+  for (std::size_t i = 0; i < candidates.size(); ++i) {
+    // vanishing levels give identical truncations, look them up only once
+    if (i > 0 && candidates[i] == candidates[i - 1]) {
+      continue;
+    }
+    if (auto it = m_index.find(candidates[i]); it != m_index.end()) {
+      return std::next(begin(), it->second);
+    }
+  }
+  return end();
+}
+
+template <typename value_t>
+inline auto GeometryHierarchyMap<value_t>::findInSorted(
+    const GeometryIdentifier& id) const -> Iterator {
   // we can not search for the element directly since the relevant one
   // might be stored at a higher level. ids for higher levels would always
   // be sorted before the requested id. searching for the first element
@@ -17,9 +17,12 @@
 #include "Acts/Surfaces/SurfaceVisitorConcept.hpp"
 #include "Acts/Utilities/Logger.hpp"
 
+#include <cstddef>
 #include <memory>
+#include <optional>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 namespace Acts {
 
@@ -195,6 +198,34 @@ class TrackingGeometry {
   const std::unordered_map<GeometryIdentifier, const Surface*>&
   geoIdSurfaceMap() const;
 
+  /// Number of sensitive surfaces in the dense surface index
+  ///
+  /// Every surface with a non-zero sensitive identifier component gets a
+  /// contiguous index in `[0, numSensitiveSurfaces())` at construction. The
+  /// indices follow the geometry identifier ordering.
+  ///
+  /// @return the number of indexed sensitive surfaces
+  std::size_t numSensitiveSurfaces() const;
+
+  /// Access a sensitive surface by its dense index.
+  ///
+  /// @param index is the dense index of the sensitive surface
+  /// @retval nullptr if the index is out of range
+  /// @retval pointer to the sensitive surface otherwise.
+  const Surface* surfaceByIndex(std::size_t index) const;
+
+  /// Look up the dense index of a sensitive surface.
+  ///
+  /// @param id is the geometry identifier of the sensitive surface
+  /// @return the dense index or an empty optional if @p id does not
+  ///         identify an indexed sensitive surface
+  std::optional<std::size_t> indexOf(GeometryIdentifier id) const;
+
+  /// Access to all indexed sensitive surfaces
+  /// @return Const reference to the sensitive surfaces ordered by their
+  ///         dense index
+  const std::vector<const Surface*>& sensitiveSurfaces() const;
+
   /// Visualize a tracking geometry including substructure
   /// @param helper The visualization helper that implement the output
   /// @param gctx The geometry context
@@ -219,6 +250,9 @@ class TrackingGeometry {
   // lookup containers
   std::unordered_map<GeometryIdentifier, const TrackingVolume*> m_volumesById;
   std::unordered_map<GeometryIdentifier, const Surface*> m_surfacesById;
+  // dense sensitive surface index
+  std::vector<const Surface*> m_sensitiveSurfaces;
+  std::unordered_map<GeometryIdentifier, std::size_t> m_sensitiveIndexById;
 };
 
 }  // namespace Acts
@@ -0,0 +1,179 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+
+namespace Acts {
+
+/// @addtogroup magnetic_field
+/// @{
+
+/// Storage policies for the nodes of an @ref Acts::InterpolatedBFieldMap grid.
+///
+/// A storage policy defines the type in which the field value of each grid
+/// node is stored, and how a field vector is encoded into and decoded from
+/// it. The grid only holds the encoded values; the field map decodes the
+/// corner values whenever it builds a field cell, so that the interpolation
+/// is always done in double precision.
+///
+/// Less precise storage reduces the memory footprint of large maps and
+/// improves their cache efficiency at the cost of a bounded error on the
+/// node values. @c maxError(maxField) returns the maximum absolute error per
+/// field component of a node, for components of a magnitude up to
+/// @c maxField.
+template <typename T>
+concept BFieldMapStorage = requires(const T& storage, const Vector2& field2,
+                                    const Vector3& field3, double maxField) {
+  { storage.decode(storage.encode(field2)) } -> std::same_as<Vector2>;
+  { storage.decode(storage.encode(field3)) } -> std::same_as<Vector3>;
+  { storage.maxError(maxField) } -> std::same_as<double>;
+};
+
+/// Keeps the grid nodes in double precision, i.e. without any loss.
+struct DoubleBFieldStorage {
+  /// Type of the stored node values
+  template <int DIM>
+  using value_type = Eigen::Matrix<double, DIM, 1>;
+
+  /// Encode a field vector into a node value
+  /// @param field The field vector
+  /// @return The stored node value
+  template <int DIM>
+  value_type<DIM> encode(const Eigen::Matrix<double, DIM, 1>& field) const {
+    return field;
+  }
+
+  /// Decode a node value into a field vector
+  /// @param value The stored node value
+  /// @return The field vector
+  template <int DIM>
+  Eigen::Matrix<double, DIM, 1> decode(const value_type<DIM>& value) const {
+    return value;
+  }
+
+  /// Maximum absolute error per field component of a node
+  /// @return Always zero
+  double maxError(double /*maxField*/) const { return 0.; }
+};
+
+/// Keeps the grid nodes in single precision, which halves the memory of the
+/// map. The relative error of every field component is bound by the float
+/// machine epsilon.
+struct FloatBFieldStorage {
+  /// Type of the stored node values
+  template <int DIM>
+  using value_type = Eigen::Matrix<float, DIM, 1>;
+
+  /// Encode a field vector into a node value
+  /// @param field The field vector
+  /// @return The stored node value
+  template <int DIM>
+  value_type<DIM> encode(const Eigen::Matrix<double, DIM, 1>& field) const {
+    return field.template cast<float>();
+  }
+
+  /// Decode a node value into a field vector
+  /// @param value The stored node value
+  /// @return The field vector
+  template <int DIM>
+  Eigen::Matrix<double, DIM, 1> decode(const value_type<DIM>& value) const {
+    return value.template cast<double>();
+  }
+
+  /// Maximum absolute error per field component of a node
+  /// @param maxField Maximum magnitude of the field components
+  /// @return The rounding error of single precision at @p maxField
+  double maxError(double maxField) const {
+    return 0.5 * std::numeric_limits<float>::epsilon() * std::abs(maxField);
+  }
+};
+
+/// Keeps the grid nodes as 16 bit integers counting multiples of a fixed
+/// field quantum, which quarters the memory of the map. The absolute error of
+/// every field component is bound by half the quantum, while the field range
+/// that can be represented is limited to +-32767 quanta. Components beyond
+/// that range are rejected when encoding.
+class Int16BFieldStorage {
+ public:
+  /// Type of the stored node values
+  template <int DIM>
+  using value_type = Eigen::Matrix<std::int16_t, DIM, 1>;
+
+  /// Create the storage policy from the tolerated error
+  /// @param maxError Maximum absolute error per field component
+  explicit Int16BFieldStorage(double maxError) : m_quantum(2. * maxError) {
+    if (!(maxError > 0.)) {
+      throw std::invalid_argument(
+          "Int16BFieldStorage: the maximum error must be positive");
+    }
+  }
+
+  /// Encode a field vector into a node value
+  ///
+  /// @param field The field vector
+  /// @return The stored node value
+  /// @throw std::invalid_argument if a component is NaN or exceeds the
+  ///        representable range of +-32767 quanta
+  template <int DIM>
+  value_type<DIM> encode(const Eigen::Matrix<double, DIM, 1>& field) const {
+    constexpr double limit = std::numeric_limits<std::int16_t>::max();
+    value_type<DIM> value;
+    for (int i = 0; i < DIM; ++i) {
+      if (std::isnan(field[i])) {
+        throw std::invalid_argument("Int16BFieldStorage: field value is NaN");
+      }
+      const double quanta = std::round(field[i] / m_quantum);
+      if (std::abs(quanta) > limit) {
+        throw std::invalid_argument(
+            "Int16BFieldStorage: field value exceeds the representable "
+            "range, increase the maximum error");
+      }
+      value[i] = static_cast<std::int16_t>(quanta);
+    }
+    return value;
+  }
+
+  /// Decode a node value into a field vector
+  /// @param value The stored node value
+  /// @return The field vector
+  template <int DIM>
+  Eigen::Matrix<double, DIM, 1> decode(const value_type<DIM>& value) const {
+    return value.template cast<double>() * m_quantum;
+  }
+
+  /// Maximum absolute error per field component of a node
+  /// @return Half the field quantum, independent of the field magnitude
+  double maxError(double /*maxField*/ = 0.) const { return 0.5 * m_quantum; }
+
+  /// Field value of one stored unit
+  /// @return The field quantum
+  double quantum() const { return m_quantum; }
+
+ private:
+  double m_quantum;
+};
+
+/// Storage policies for which the field map factories in
+/// BFieldMapUtils.hpp are compiled
+template <typename T>
+concept BuiltinBFieldMapStorage =
+    BFieldMapStorage<T> && (std::same_as<T, DoubleBFieldStorage> ||
+                            std::same_as<T, FloatBFieldStorage> ||
+                            std::same_as<T, Int16BFieldStorage>);
+
+/// @}
+
+}  // namespace Acts
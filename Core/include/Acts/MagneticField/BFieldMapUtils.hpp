@@ -10,6 +10,7 @@
 
 #include "Acts/Definitions/Algebra.hpp"
 #include "Acts/Definitions/Units.hpp"
+#include "Acts/MagneticField/BFieldMapStorage.hpp"
 #include "Acts/MagneticField/InterpolatedBFieldMap.hpp"
 #include "Acts/Utilities/AxisDefinitions.hpp"
 #include "Acts/Utilities/Grid.hpp"
@@ -147,6 +148,83 @@ fieldMapXYZ(
     double lengthUnit = UnitConstants::mm, double BFieldUnit = UnitConstants::T,
     bool firstOctant = false);
 
+/// Method to set up a FieldMap in r,z with a compact node storage
+///
+/// Same as @ref Acts::fieldMapRZ, but the grid nodes are stored encoded by
+/// the given storage policy, e.g. @ref Acts::FloatBFieldStorage or
+/// @ref Acts::Int16BFieldStorage, to reduce the memory footprint of the map.
+/// The field values are decoded before the interpolation, which is therefore
+/// always done in double precision. Only the storage policies of
+/// @ref Acts::BuiltinBFieldMapStorage are compiled.
+///
+/// @param storage The storage policy of the grid nodes
+/// @param localToGlobalBin Function mapping the local bins of r,z to the global
+///                         bin of the map magnetic field value
+/// @param[in] rPos Values of the grid points in r
+/// @param[in] zPos Values of the grid points in z
+/// @param[in] bField The magnetic field values in r and z for all given grid
+///                   points stored in a vector
+/// @param[in] lengthUnit The unit of the grid points
+/// @param[in] BFieldUnit The unit of the magnetic field
+/// @param[in] firstQuadrant Flag if set to true indicating that only the first
+///                          quadrant of the grid points and the BField values
+///                          has been given.
+/// @throw std::invalid_argument if a field value cannot be encoded by the
+///        storage policy, e.g. NaN or a value beyond the range of
+///        @ref Acts::Int16BFieldStorage
+/// @return A field map instance for use in interpolation.
+template <BuiltinBFieldMapStorage storage_t>
+Acts::InterpolatedBFieldMap<
+    Acts::Grid<typename storage_t::template value_type<2>,
+               Acts::Axis<Acts::AxisType::Equidistant>,
+               Acts::Axis<Acts::AxisType::Equidistant>>>
+fieldMapRZ(const storage_t& storage,
+           const std::function<std::size_t(std::array<std::size_t, 2> binsRZ,
+                                           std::array<std::size_t, 2> nBinsRZ)>&
+               localToGlobalBin,
+           std::vector<double> rPos, std::vector<double> zPos,
+           const std::vector<Acts::Vector2>& bField,
+           double lengthUnit = UnitConstants::mm,
+           double BFieldUnit = UnitConstants::T, bool firstQuadrant = false);
+
+/// Method to set up a FieldMap in x,y,z with a compact node storage
+///
+/// Same as @ref Acts::fieldMapXYZ, but the grid nodes are stored encoded by
+/// the given storage policy, see the r,z version above.
+///
+/// @param storage The storage policy of the grid nodes
+/// @param localToGlobalBin Function mapping the local bins of x,y,z to the
+///                         global bin of the map magnetic field value
+/// @param[in] xPos Values of the grid points in x
+/// @param[in] yPos Values of the grid points in y
+/// @param[in] zPos Values of the grid points in z
+/// @param[in] bField The magnetic field values for all given grid points
+///                   stored in a vector
+/// @param[in] lengthUnit The unit of the grid points
+/// @param[in] BFieldUnit The unit of the magnetic field
+/// @param[in] firstOctant Flag if set to true indicating that only the first
+///                        octant of the grid points and the BField values has
+///                        been given.
+/// @throw std::invalid_argument if a field value cannot be encoded by the
+///        storage policy, e.g. NaN or a value beyond the range of
+///        @ref Acts::Int16BFieldStorage
+/// @return A field map instance for use in interpolation.
+template <BuiltinBFieldMapStorage storage_t>
+Acts::InterpolatedBFieldMap<
+    Acts::Grid<typename storage_t::template value_type<3>,
+               Acts::Axis<Acts::AxisType::Equidistant>,
+               Acts::Axis<Acts::AxisType::Equidistant>,
+               Acts::Axis<Acts::AxisType::Equidistant>>>
+fieldMapXYZ(
+    const storage_t& storage,
+    const std::function<std::size_t(std::array<std::size_t, 3> binsXYZ,
+                                    std::array<std::size_t, 3> nBinsXYZ)>&
+        localToGlobalBin,
+    std::vector<double> xPos, std::vector<double> yPos,
+    std::vector<double> zPos, const std::vector<Acts::Vector3>& bField,
+    double lengthUnit = UnitConstants::mm, double BFieldUnit = UnitConstants::T,
+    bool firstOctant = false);
+
 /// Function which takes an existing SolenoidBField instance and
 /// creates a field mapper by sampling grid points from the analytical
 /// solenoid field.
@@ -0,0 +1,108 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/MagneticField/InterpolatedBFieldMap.hpp"
+#include "Acts/Utilities/Axis.hpp"
+#include "Acts/Utilities/AxisDefinitions.hpp"
+#include "Acts/Utilities/Grid.hpp"
+#include "Acts/Utilities/MappedGrid.hpp"
+
+#include <cstdint>
+#include <string>
+
+namespace Acts {
+
+/// @addtogroup magnetic_field
+/// @{
+
+/// Binary field map format
+///
+/// The format stores the nodes of an rz or xyz field map with equidistant
+/// axes exactly as they are held in memory by @ref Acts::InterpolatedBFieldMap,
+/// so that a map can be memory mapped instead of being parsed and copied:
+///
+/// - a fixed size header with a magic string, the format version, a byte
+///   order marker, the grid type and the axes definitions,
+/// - padding up to @ref s_binaryBFieldMapAlignment bytes,
+/// - the field values of all grid bins in global bin order, including the
+///   under- and overflow bins, in internal units.
+///
+/// Reading maps the file read-only and shares its pages, so that all
+/// processes on a node which read the same file use a single physical copy of
+/// the field map, and the startup time does not depend on the map size.
+///
+/// @note The format is native to the machine writing it, files with a
+///       different byte order or version are rejected.
+
+/// Version of the binary field map format
+static constexpr std::uint32_t s_binaryBFieldMapVersion = 1;
+/// Alignment of the field values inside the binary field map file
+static constexpr std::uint64_t s_binaryBFieldMapAlignment = 4096;
+
+/// Type of the field map created from a binary rz field map file
+using MappedBFieldMapRz = InterpolatedBFieldMap<MappedGrid<
+    Vector2, Axis<AxisType::Equidistant>, Axis<AxisType::Equidistant>>>;
+
+/// Type of the field map created from a binary xyz field map file
+using MappedBFieldMapXyz = InterpolatedBFieldMap<
+    MappedGrid<Vector3, Axis<AxisType::Equidistant>,
+               Axis<AxisType::Equidistant>, Axis<AxisType::Equidistant>>>;
+
+/// Write an rz field map to a binary field map file
+///
+/// The file is written to a temporary file next to @p fieldMapFile first and
+/// renamed afterwards, so that readers never observe a partially written map.
+///
+/// @param map The field map, which must be created with @ref Acts::fieldMapRZ
+///            semantics, i.e. the grid nodes hold (Br, Bz)
+/// @param fieldMapFile Path of the output file
+/// @throw std::runtime_error if the file cannot be written
+void writeMagneticFieldMapRzToBinary(
+    const InterpolatedBFieldMap<Grid<Vector2, Axis<AxisType::Equidistant>,
+                                     Axis<AxisType::Equidistant>>>& map,
+    const std::string& fieldMapFile);
+
+/// Write an xyz field map to a binary field map file
+///
+/// @param map The field map, which must be created with @ref Acts::fieldMapXYZ
+///            semantics, i.e. the grid nodes hold (Bx, By, Bz)
+/// @param fieldMapFile Path of the output file
+/// @throw std::runtime_error if the file cannot be written
+void writeMagneticFieldMapXyzToBinary(
+    const InterpolatedBFieldMap<
+        Grid<Vector3, Axis<AxisType::Equidistant>, Axis<AxisType::Equidistant>,
+             Axis<AxisType::Equidistant>>>& map,
+    const std::string& fieldMapFile);
+
+/// Create an rz field map from a binary field map file
+///
+/// The file is mapped read-only into memory and stays mapped for the
+/// lifetime of the returned map and all its copies.
+///
+/// @param fieldMapFile Path to the binary field map file
+/// @throw std::runtime_error if the file cannot be mapped or is not a valid
+///        rz field map of the supported version
+/// @return Interpolated magnetic field map in R-Z coordinates
+MappedBFieldMapRz makeMagneticFieldMapRzFromBinary(
+    const std::string& fieldMapFile);
+
+/// Create an xyz field map from a binary field map file
+///
+/// @param fieldMapFile Path to the binary field map file
+/// @throw std::runtime_error if the file cannot be mapped or is not a valid
+///        xyz field map of the supported version
+/// @return Interpolated magnetic field map in X-Y-Z coordinates
+MappedBFieldMapXyz makeMagneticFieldMapXyzFromBinary(
+    const std::string& fieldMapFile);
+
+/// @}
+
+}  // namespace Acts
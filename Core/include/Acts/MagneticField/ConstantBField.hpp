@@ -12,6 +12,9 @@
 #include "Acts/MagneticField/MagneticFieldContext.hpp"
 #include "Acts/MagneticField/MagneticFieldProvider.hpp"
 
+#include <algorithm>
+#include <span>
+
 namespace Acts {
 
 /// @ingroup magnetic_field
@@ -47,6 +50,16 @@ class ConstantBField final : public MagneticFieldProvider {
     return Result<Vector3>::success(m_BField);
   }
 
+  /// @copydoc MagneticFieldProvider::getFieldBatch(std::span<const Vector3>,std::span<Vector3>,MagneticFieldProvider::Cache&) const
+  Result<void> getFieldBatch(
+      std::span<const Vector3> positions, std::span<Vector3> fields,
+      MagneticFieldProvider::Cache& cache) const override {
+    static_cast<void>(positions);
+    static_cast<void>(cache);
+    std::ranges::fill(fields, m_BField);
+    return Result<void>::success();
+  }
+
   /// @copydoc MagneticFieldProvider::makeCache(const MagneticFieldContext&) const
   Acts::MagneticFieldProvider::Cache makeCache(
       const Acts::MagneticFieldContext& mctx) const override {
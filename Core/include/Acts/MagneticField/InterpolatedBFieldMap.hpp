@@ -15,8 +15,13 @@
 #include "Acts/Utilities/Interpolation.hpp"
 #include "Acts/Utilities/Result.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cassert>
 #include <functional>
 #include <optional>
+#include <span>
+#include <type_traits>
 #include <vector>
 
 namespace Acts {
@@ -329,8 +334,7 @@ class InterpolatedBFieldMap : public InterpolatedMagneticField {
       return Result<Vector3>::failure(MagneticFieldError::OutOfBounds);
     }
 
-    return Result<Vector3>::success(
-        m_cfg.transformBField(m_cfg.grid.interpolate(gridPosition), position));
+    return Result<Vector3>::success(interpolateField(gridPosition, position));
   }
 
   /// Get magnetic field value without bounds checking (faster).
@@ -342,8 +346,7 @@ class InterpolatedBFieldMap : public InterpolatedMagneticField {
   ///          the position is within the valid range of the field map.
   Vector3 getFieldUnchecked(const Vector3& position) const final {
     const auto gridPosition = m_cfg.transformPos(position);
-    return m_cfg.transformBField(m_cfg.grid.interpolate(gridPosition),
-                                 position);
+    return interpolateField(gridPosition, position);
   }
 
   /// @copydoc MagneticFieldProvider::getField(const Vector3&,MagneticFieldProvider::Cache&) const
@@ -361,7 +364,108 @@ class InterpolatedBFieldMap : public InterpolatedMagneticField {
     return Result<Vector3>::success((*lcache.fieldCell).getField(gridPosition));
   }
 
+  /// @copydoc MagneticFieldProvider::getFieldBatch(std::span<const Vector3>,std::span<Vector3>,MagneticFieldProvider::Cache&) const
+  ///
+  /// The positions are processed in blocks. For every position of a block the
+  /// field cell is looked up first and its corner values are gathered into
+  /// structure-of-arrays buffers. The linear interpolation is then done for
+  /// all positions of the block at once, so that the compiler can vectorise
+  /// it across positions. The field cell cache is not used.
+  Result<void> getFieldBatch(
+      std::span<const Vector3> positions, std::span<Vector3> fields,
+      MagneticFieldProvider::Cache& /*cache*/) const final {
+    assert(positions.size() == fields.size());
+
+    constexpr std::size_t kBlock = 16;
+    constexpr std::size_t nCorners = FieldCell::N;
+    using Lanes = std::array<double, kBlock>;
+
+    // relative position inside the field cell along each grid axis
+    std::array<Lanes, DIM_POS> fractions{};
+    // field components at the cell corners in the canonical order of
+    // Acts::interpolate
+    std::array<std::array<Lanes, 3>, nCorners> values{};
+
+    for (std::size_t begin = 0; begin < positions.size(); begin += kBlock) {
+      const std::size_t n = std::min(kBlock, positions.size() - begin);
+
+      // cell lookup
+      for (std::size_t i = 0; i < n; ++i) {
+        const Vector3& position = positions[begin + i];
+        const auto gridPosition = m_cfg.transformPos(position);
+        if (!isInsideLocal(gridPosition)) {
+          return Result<void>::failure(MagneticFieldError::OutOfBounds);
+        }
+        const auto& indices = m_cfg.grid.localBinsFromPosition(gridPosition);
+        const auto& lowerLeft = m_cfg.grid.lowerLeftBinEdge(indices);
+        const auto& upperRight = m_cfg.grid.upperRightBinEdge(indices);
+        for (std::size_t d = 0; d < DIM_POS; ++d) {
+          fractions[d][i] = (gridPosition[d] - lowerLeft[d]) /
+                            (upperRight[d] - lowerLeft[d]);
+        }
+        std::size_t c = 0;
+        for (std::size_t index :
+             m_cfg.grid.closestPointsIndices(gridPosition)) {
+          const Vector3 corner =
+              m_cfg.transformBField(m_cfg.grid.at(index), position);
+          for (std::size_t k = 0; k < 3; ++k) {
+            values[c][k][i] = corner[k];
+          }
+          ++c;
+        }
+        assert(c == nCorners);
+      }
+
+      // reduce the corners pairwise along the last grid axis first, as done
+      // by Acts::interpolate
+      for (std::size_t d = DIM_POS, m = nCorners; d-- > 0; m /= 2) {
+        for (std::size_t c = 0; c < m / 2; ++c) {
+          for (std::size_t k = 0; k < 3; ++k) {
+            const Lanes& lower = values[2 * c][k];
+            const Lanes& upper = values[2 * c + 1][k];
+            Lanes& out = values[c][k];
+            for (std::size_t i = 0; i < kBlock; ++i) {
+              const double f = fractions[d][i];
+              out[i] = (1 - f) * lower[i] + f * upper[i];
+            }
+          }
+        }
+      }
+
+      for (std::size_t i = 0; i < n; ++i) {
+        fields[begin + i] =
+            Vector3(values[0][0][i], values[0][1][i], values[0][2][i]);
+      }
+    }
+    return Result<void>::success();
+  }
+
  private:
+  /// Interpolate the field at a position inside the look-up domain
+  ///
+  /// Grids of double precision values are interpolated before transforming
+  /// the result. Grids storing the nodes in a compact type (see
+  /// @ref Acts::BFieldMapStorage) are decoded by @c transformBField first and
+  /// the corner values are interpolated in double precision instead.
+  Vector3 interpolateField(const Vector<DIM_POS>& gridPosition,
+                           const Vector3& position) const {
+    if constexpr (std::is_same_v<typename FieldType::Scalar, double>) {
+      return m_cfg.transformBField(m_cfg.grid.interpolate(gridPosition),
+                                   position);
+    } else {
+      const auto& indices = m_cfg.grid.localBinsFromPosition(gridPosition);
+      std::array<Vector3, FieldCell::N> neighbors{};
+      std::size_t i = 0;
+      for (std::size_t index : m_cfg.grid.closestPointsIndices(gridPosition)) {
+        neighbors.at(i++) =
+            m_cfg.transformBField(m_cfg.grid.at(index), position);
+      }
+      return Acts::interpolate(
+          gridPosition, m_cfg.grid.lowerLeftBinEdge(indices),
+          m_cfg.grid.upperRightBinEdge(indices), neighbors);
+    }
+  }
+
   Config m_cfg;
 
   typename Grid::point_t m_lowerLeft;
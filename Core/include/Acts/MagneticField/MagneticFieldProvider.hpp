@@ -13,6 +13,9 @@
 #include "Acts/Utilities/Any.hpp"
 #include "Acts/Utilities/Result.hpp"
 
+#include <cassert>
+#include <span>
+
 namespace Acts {
 
 /// Base class for all magnetic field providers
@@ -88,6 +91,35 @@ class MagneticFieldProvider {
   virtual Result<Vector3> getField(const Vector3& position,
                                    Cache& cache) const = 0;
 
+  /// Retrieve magnetic field values at a batch of locations. Requires an
+  /// instance of @ref Acts::MagneticFieldProvider::Cache created through
+  /// @ref makeCache.
+  ///
+  /// The default implementation calls @ref getField for every position.
+  /// Implementations can override it to amortize the virtual dispatch and to
+  /// share work between nearby lookups.
+  ///
+  /// @param [in] positions global 3D positions for the lookup
+  /// @param [out] fields magnetic field vectors at the given positions, must
+  ///              have the same size as @p positions
+  /// @param [in,out] cache Field provider specific cache object
+  ///
+  /// @return error of the first failed lookup, in which case the content of
+  ///         @p fields is unspecified
+  virtual Result<void> getFieldBatch(std::span<const Vector3> positions,
+                                     std::span<Vector3> fields,
+                                     Cache& cache) const {
+    assert(positions.size() == fields.size());
+    for (std::size_t i = 0; i < positions.size(); ++i) {
+      auto field = getField(positions[i], cache);
+      if (!field.ok()) {
+        return field.error();
+      }
+      fields[i] = *field;
+    }
+    return Result<void>::success();
+  }
+
   virtual ~MagneticFieldProvider() = default;
 };
 
@@ -13,6 +13,10 @@
 #include "Acts/MagneticField/MagneticFieldProvider.hpp"
 #include "Acts/Utilities/RangeXD.hpp"
 
+#include <optional>
+#include <span>
+#include <vector>
+
 namespace Acts {
 
 /// Magnetic field provider modelling a magnetic field consisting of
@@ -52,6 +56,11 @@ class MultiRangeBField final : public MagneticFieldProvider {
   // regions.
   std::vector<BFieldRange> fieldRanges;
 
+  // Find the range with the highest precedence containing the position and
+  // update the cache accordingly.
+  std::optional<std::size_t> findRange(const Vector3& position,
+                                       Cache& cache) const;
+
  public:
   /// @brief Construct a magnetic field from a vector of ranges.
   ///
@@ -81,6 +90,17 @@ class MultiRangeBField final : public MagneticFieldProvider {
   /// otherwise.
   Result<Vector3> getField(const Vector3& position,
                            MagneticFieldProvider::Cache& cache) const override;
+
+  /// @brief Request the values of the magnetic field at a batch of positions.
+  ///
+  /// @param [in] positions Global 3D positions for the lookup.
+  /// @param [out] fields Field vectors at the given positions.
+  /// @param [in, out] cache Cache object.
+  /// @returns A failure value if any of the locations is not contained
+  /// inside any of the regions.
+  Result<void> getFieldBatch(
+      std::span<const Vector3> positions, std::span<Vector3> fields,
+      MagneticFieldProvider::Cache& cache) const override;
 };
 
 }  // namespace Acts
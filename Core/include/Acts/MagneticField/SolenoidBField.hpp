@@ -14,6 +14,7 @@
 #include "Acts/Utilities/Result.hpp"
 
 #include <cstddef>
+#include <span>
 
 namespace Acts {
 
@@ -139,6 +140,11 @@ class SolenoidBField final : public MagneticFieldProvider {
   Result<Vector3> getField(const Vector3& position,
                            MagneticFieldProvider::Cache& cache) const override;
 
+  /// @copydoc MagneticFieldProvider::getFieldBatch(std::span<const Vector3>,std::span<Vector3>,MagneticFieldProvider::Cache&) const
+  Result<void> getFieldBatch(
+      std::span<const Vector3> positions, std::span<Vector3> fields,
+      MagneticFieldProvider::Cache& cache) const override;
+
  private:
   Config m_cfg;
   double m_scale;
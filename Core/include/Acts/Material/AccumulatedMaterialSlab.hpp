@@ -35,6 +35,21 @@ class AccumulatedMaterialSlab {
   // this class does not have a custom default constructor and thus should not
   // provide any custom default cstors, dstor, or assignment. see ISOCPP C.20.
 
+  /// Create an accumulator from previously accumulated totals.
+  ///
+  /// @param totalAverage Average material properties over all tracks
+  /// @param totalVariance Material variance over all tracks
+  /// @param totalCount Number of contributing tracks
+  ///
+  /// @returns Accumulator with the given totals and an empty per-track store
+  ///
+  /// This restores the output of `.totalAverage()` and `.totalVariance()`,
+  /// e.g. from a file written by a partial mapping job, such that it can be
+  /// merged with other accumulators.
+  static AccumulatedMaterialSlab fromTotals(const MaterialSlab& totalAverage,
+                                            float totalVariance,
+                                            unsigned int totalCount);
+
   /// Add the material to the current per-track store.
   ///
   /// @param slabAlongTrack Recorded equivalent material slab for this step
@@ -73,6 +88,22 @@ class AccumulatedMaterialSlab {
   /// unless explicitly requested.
   void trackAverage(bool useEmptyTrack = false);
 
+  /// Add the total average of another accumulator to this one.
+  ///
+  /// @param other Accumulator filled from a disjoint set of tracks
+  ///
+  /// Both total averages are combined weighted with their number of
+  /// contributing tracks. This allows accumulating independent sets of tracks,
+  /// e.g. in different threads, and combining them afterwards. The per-track
+  /// store of @p other is ignored and should be empty.
+  ///
+  /// The track count, the thickness in radiation and interaction lengths and
+  /// the molar properties are the same as if all tracks were accumulated here,
+  /// up to rounding. The atomic number and the mean excitation energy are
+  /// averaged logarithmically only as long as no vacuum is involved, so they
+  /// can differ at the percent level when some tracks crossed vacuum.
+  void merge(const AccumulatedMaterialSlab& other);
+
   /// Return the average material properties from all accumulated tracks.
   ///
   /// @returns Average material properties and the number of contributing tracks
@@ -141,6 +141,23 @@ class AccumulatedSurfaceMaterial {
   /// @param emptyHit indicator if this is an empty assignment
   void trackAverage(const Vector3& gp, bool emptyHit = false);
 
+  /// Add the material accumulated by another instance with the same binning
+  ///
+  /// @param other is the accumulated material from a disjoint set of tracks
+  ///
+  /// @throws std::invalid_argument if the binning differs
+  void merge(const AccumulatedSurfaceMaterial& other);
+
+  /// Add material accumulated from another set of tracks to a single bin
+  ///
+  /// @param bin0 is the bin index along the first local axis
+  /// @param bin1 is the bin index along the second local axis
+  /// @param slab is the accumulated material to be added
+  ///
+  /// @throws std::out_of_range if the bin does not exist
+  void merge(std::size_t bin0, std::size_t bin1,
+             const AccumulatedMaterialSlab& slab);
+
   /// Total average creates SurfaceMaterial
   /// @return Unique pointer to the averaged surface material
   std::unique_ptr<const ISurfaceMaterial> totalAverage();
@@ -25,6 +25,10 @@ class AccumulatedVolumeMaterial {
   /// @param mat The material slab to accumulate
   void accumulate(const MaterialSlab& mat);
 
+  /// Add all entries accumulated by another instance.
+  /// @param other The accumulated material from a disjoint set of entries
+  void merge(const AccumulatedVolumeMaterial& other);
+
   /// Compute the average material collected so far.
   ///
   /// @returns Vacuum properties if no matter has been accumulated yet.
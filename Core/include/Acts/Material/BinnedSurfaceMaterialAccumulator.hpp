@@ -68,6 +68,13 @@ class BinnedSurfaceMaterialAccumulator final
                   const std::vector<IAssignmentFinder::SurfaceAssignment>&
                       surfacesWithoutAssignment) const override;
 
+  /// Merge the material accumulated in another state into this one
+  ///
+  /// @param state the state of the accumulator to be extended
+  /// @param other the state filled from a disjoint set of tracks
+  void merge(ISurfaceMaterialAccumulator::State& state,
+             const ISurfaceMaterialAccumulator::State& other) const override;
+
   /// Finalize the surface material maps
   ///
   /// @param state the state of the accumulator
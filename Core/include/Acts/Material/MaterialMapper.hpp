@@ -79,6 +79,15 @@ class MaterialMapper {
       const MagneticFieldContext& mctx, const RecordedMaterialTrack& rmTrack,
       const Options& options = Options{}) const;
 
+  /// Merge the material collected in another state into this one
+  ///
+  /// This allows to run the mapping with independent states, e.g. one per
+  /// thread, and combine them before finalizing the maps.
+  ///
+  /// @param state the state object to be extended
+  /// @param other the state object filled from a disjoint set of tracks
+  void mergeStates(State& state, const State& other) const;
+
   /// Finalize the maps
   /// @param state Material mapping state containing collected data
   /// @param gctx Geometry context for finalization
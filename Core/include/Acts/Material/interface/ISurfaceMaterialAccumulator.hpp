@@ -56,6 +56,15 @@ class ISurfaceMaterialAccumulator {
       const std::vector<IAssignmentFinder::SurfaceAssignment>&
           surfacesWithoutAssignment) const = 0;
 
+  /// Merge the material accumulated in another state into this one
+  ///
+  /// @param state the state of the accumulator to be extended
+  /// @param other the state filled from a disjoint set of tracks
+  ///
+  /// @note both states must have been created by this accumulator, which
+  ///       allows filling independent states in parallel
+  virtual void merge(State& state, const State& other) const = 0;
+
   /// Finalize the surface material maps
   ///
   /// @param state the state of the accumulator
@@ -0,0 +1,141 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/Navigation/INavigationPolicy.hpp"
+#include "Acts/Navigation/NavigationStream.hpp"
+#include "Acts/Utilities/BoundingBox.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace Acts {
+
+class TrackingVolume;
+class GeometryContext;
+class Logger;
+class Surface;
+
+/// Policy which selects the surfaces of a volume with a bounding volume
+/// hierarchy (BVH) over the axis aligned bounding boxes of the surfaces.
+///
+/// The hierarchy is built once at construction by recursively splitting the
+/// surfaces at the median of their box centers along the longest axis. It is
+/// stored flattened in depth-first order, where every node knows the index of
+/// the node following its subtree. The traversal for a ray from the current
+/// position along the current direction is therefore a single linear pass
+/// without a stack. Only surfaces whose boxes are hit by the ray are added as
+/// candidates, which replaces the intersection of every surface done by
+/// @ref Acts::TryAllNavigationPolicy in volumes with many irregularly
+/// placed surfaces.
+///
+/// Portals and surfaces without bounds are always added.
+///
+/// @note The boxes are computed with the geometry context given at
+///       construction, misalignments which move surfaces by more than the
+///       configured envelope require rebuilding the policy.
+class BoundingVolumeHierarchyNavigationPolicy final : public INavigationPolicy {
+ public:
+  /// Type of the bounding boxes of the hierarchy
+  using BoundingBox = AxisAlignedBoundingBox<Surface, double, 3>;
+
+  /// Configuration for the BVH navigation policy
+  struct Config {
+    /// Whether to include portal surfaces
+    bool portals = true;
+    /// Whether to include sensitive surfaces
+    bool sensitives = true;
+    /// Whether to include passive surfaces
+    bool passives = true;
+    /// Envelope added to the surface boxes in every direction, this also
+    /// gives flat surfaces a finite thickness
+    double envelope = 1 * UnitConstants::mm;
+    /// Maximum number of surfaces in a leaf node
+    std::uint32_t maxLeafSize = 4;
+    /// Number of segments per quarter circle used to approximate curved
+    /// surface bounds when computing the boxes
+    unsigned int quarterSegments = 4;
+  };
+
+  /// A node of the flattened hierarchy
+  struct Node {
+    /// The box enclosing all surfaces below this node
+    BoundingBox box;
+    /// Index of the next node after the subtree of this node
+    std::uint32_t skip = 0;
+    /// Index of the first surface box of a leaf
+    std::uint32_t first = 0;
+    /// Number of surface boxes of a leaf, zero for inner nodes
+    std::uint32_t count = 0;
+  };
+
+  /// Constructor from a volume
+  /// @param gctx is the geometry context
+  /// @param volume is the volume to navigate
+  /// @param logger is the logger
+  /// @param config The configuration for the policy
+  BoundingVolumeHierarchyNavigationPolicy(const GeometryContext& gctx,
+                                          const TrackingVolume& volume,
+                                          const Logger& logger,
+                                          const Config& config);
+
+  /// Constructor from a volume
+  /// @param gctx is the geometry context
+  /// @param volume is the volume to navigate
+  /// @param logger is the logger
+  BoundingVolumeHierarchyNavigationPolicy(const GeometryContext& gctx,
+                                          const TrackingVolume& volume,
+                                          const Logger& logger);
+
+  /// Add the portals and the surfaces whose boxes are hit by the ray to the
+  /// stream
+  /// @param gctx is the geometry context
+  /// @param args are the navigation arguments
+  /// @param state is the navigation policy state
+  /// @param stream is the navigation stream to update
+  /// @param logger is the logger
+  void initializeCandidates(const GeometryContext& gctx,
+                            const NavigationArguments& args,
+                            NavigationPolicyState& state,
+                            AppendOnlyNavigationStream& stream,
+                            const Logger& logger) const;
+
+  /// Connect the policy to a navigation delegate
+  /// @param delegate is the navigation delegate
+  void connect(NavigationDelegate& delegate) const override;
+
+  /// Constant access to config
+  /// @return config
+  const Config& config() const;
+
+  /// Constant access to the flattened hierarchy
+  /// @return the nodes in depth-first order
+  const std::vector<Node>& nodes() const;
+
+  /// Constant access to the surface boxes, ordered such that the surfaces
+  /// of every leaf are contiguous
+  /// @return the surface boxes
+  const std::vector<BoundingBox>& boxes() const;
+
+ private:
+  void build(std::uint32_t first, std::uint32_t last);
+
+  Config m_cfg;
+  const TrackingVolume* m_volume;
+
+  std::vector<Node> m_nodes;
+  std::vector<BoundingBox> m_boxes;
+  std::vector<const Surface*> m_unbounded;
+};
+
+static_assert(
+    NavigationPolicyConcept<BoundingVolumeHierarchyNavigationPolicy>);
+
+}  // namespace Acts
@@ -207,6 +207,13 @@ class INavigationPolicy {
     visitor(*this);
   }
 
+  /// Whether the candidates of the policy depend neither on the query
+  /// position and direction nor on the policy state. The candidates of such
+  /// policies can be reused without calling the policy again, see
+  /// @ref Acts::NavigationCandidateCache.
+  /// @return True if the candidates are the same for every query
+  virtual bool isQueryIndependent() const { return false; }
+
   /// Check if the policy is in a valid state for navigation
   /// @param gctx The geometry context
   /// @param args The navigation arguments
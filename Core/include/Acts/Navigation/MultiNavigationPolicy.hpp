@@ -55,6 +55,11 @@ class MultiNavigationPolicy final : public INavigationPolicy {
   void visit(const std::function<void(const INavigationPolicy&)>& visitor)
       const override;
 
+  /// The combined candidates are query independent if the candidates of all
+  /// child policies are
+  /// @return True if all child policies are query independent
+  bool isQueryIndependent() const override;
+
   /// State structure for MultiNavigationPolicy
   /// Holds the states for all contained child policies
   struct State {
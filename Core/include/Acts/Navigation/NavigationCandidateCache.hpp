@@ -0,0 +1,130 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/Propagator/NavigationTarget.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace Acts {
+
+class TrackingVolume;
+
+/// Cache of the navigation candidates which the navigation policies of the
+/// tracking volumes return, shared between propagations.
+///
+/// When the navigator enters a volume it asks the volume's navigation policy
+/// for the candidate surfaces and portals. For track finding and refitting the
+/// same volumes are traversed many times per event from very similar
+/// positions and directions, so the cache remembers the candidates per
+/// volume, coarse position cell and coarse direction bin. The cached
+/// candidates are stored in the order in which they were reached the last
+/// time, so that the intersection and sorting of the navigator work on an
+/// already sorted list.
+///
+/// The cache is only used for volumes whose navigation policy is query
+/// independent (see @ref Acts::INavigationPolicy::isQueryIndependent), e.g.
+/// @ref Acts::TryAllNavigationPolicy. On a cache hit the policy is not called
+/// at all. Policies which select candidates by position or direction always
+/// bypass the cache, so the navigation result is unchanged. The
+/// intersections of the candidates are recomputed for every propagation.
+///
+/// The cache is not thread-safe and is meant to be owned by one thread, e.g.
+/// one instance per event processing thread. It holds pointers into the
+/// tracking geometry and has to be cleared whenever the geometry changes.
+class NavigationCandidateCache {
+ public:
+  /// Configuration of the cache binning
+  struct Config {
+    /// Size of the cubic position cells in global coordinates
+    double positionCellSize = 50 * UnitConstants::mm;
+    /// Number of bins in the azimuthal angle of the direction
+    std::uint32_t nPhiBins = 32;
+    /// Number of bins in the cosine of the polar angle of the direction
+    std::uint32_t nCosThetaBins = 16;
+    /// Maximum number of entries, the cache is cleared once it is exceeded
+    std::size_t maxEntries = 100000;
+  };
+
+  /// Key of a cache entry
+  struct Key {
+    /// The volume the candidates belong to
+    const TrackingVolume* volume = nullptr;
+    /// The position cell indices
+    std::int64_t cellX = 0;
+    /// @copydoc cellX
+    std::int64_t cellY = 0;
+    /// @copydoc cellX
+    std::int64_t cellZ = 0;
+    /// The combined direction bin
+    std::uint32_t directionBin = 0;
+
+    /// Equality comparison
+    /// @param other The other key
+    /// @return true if both keys are equal
+    bool operator==(const Key& other) const = default;
+  };
+
+  /// Constructor with configuration
+  /// @param config The binning configuration
+  /// @throw std::invalid_argument if the configuration is invalid
+  explicit NavigationCandidateCache(const Config& config);
+
+  /// Compute the key of a query point in a volume
+  /// @param volume The volume which is navigated
+  /// @param position The global position of the query
+  /// @param direction The global direction of the query
+  /// @return The cache key
+  Key key(const TrackingVolume& volume, const Vector3& position,
+          const Vector3& direction) const;
+
+  /// Look up the candidates of a key
+  /// @param key The cache key
+  /// @return Pointer to the cached candidates or nullptr if there is none
+  const std::vector<NavigationTarget>* find(const Key& key) const;
+
+  /// Insert the candidates of a key
+  ///
+  /// The @p candidates are stored in the order in which their surfaces
+  /// appear in @p ordered, candidates not contained in @p ordered keep their
+  /// relative order behind them.
+  ///
+  /// @param key The cache key
+  /// @param candidates The candidates as returned by the navigation policy
+  /// @param ordered The intersected and sorted candidates
+  void insert(const Key& key, std::span<const NavigationTarget> candidates,
+              std::span<const NavigationTarget> ordered);
+
+  /// Remove all entries
+  void clear();
+
+  /// @return The number of cached entries
+  std::size_t size() const;
+
+  /// @return The configuration of the cache
+  const Config& config() const { return m_cfg; }
+
+ private:
+  struct KeyHash {
+    std::size_t operator()(const Key& key) const;
+  };
+
+  Config m_cfg;
+  double m_invCellSize = 0;
+
+  std::unordered_map<Key, std::vector<NavigationTarget>, KeyHash> m_entries;
+};
+
+}  // namespace Acts
@@ -63,6 +63,10 @@ class TryAllNavigationPolicy final : public INavigationPolicy {
   /// @param delegate is the navigation delegate
   void connect(NavigationDelegate& delegate) const override;
 
+  /// The candidates only depend on the volume
+  /// @return Always true
+  bool isQueryIndependent() const override;
+
   /// Constant access to config
   /// @return config
   const Config& config() const;
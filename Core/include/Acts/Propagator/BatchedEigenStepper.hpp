@@ -0,0 +1,231 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/Direction.hpp"
+#include "Acts/EventData/BoundTrackParameters.hpp"
+#include "Acts/MagneticField/MagneticFieldProvider.hpp"
+#include "Acts/Propagator/StepperOptions.hpp"
+#include "Acts/Propagator/StepperStatistics.hpp"
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <system_error>
+
+namespace Acts {
+
+/// @brief Runge-Kutta-Nyström stepper advancing a batch of tracks in lock-step
+///
+/// This is the batched counterpart of the @ref EigenStepper with the default
+/// extension. The state of `kLanes` independent tracks is stored as a
+/// structure of arrays, i.e. every free parameter component is stored in its
+/// own array with one entry per lane. All stages of the RKN4 integration are
+/// written as plain loops over the lanes, which the compiler vectorizes into
+/// SIMD instructions (e.g. 4 lanes for AVX2 or 8 lanes for AVX-512 in double
+/// precision).
+///
+/// Every lane keeps its own adaptive step size. Lanes whose trial step is
+/// rejected are retried with a smaller step size while the accepted lanes are
+/// masked, and lanes that reached their target are deactivated and no longer
+/// updated. The magnetic field is looked up with a single
+/// @ref MagneticFieldProvider::getFieldBatch call per stage for all pending
+/// lanes.
+///
+/// A failing field lookup or step size adjustment only stops the affected
+/// lane. It is deactivated and its error is kept in the state, while the
+/// other lanes continue.
+///
+/// @note Only the free parameters are propagated in vacuum, i.e. there is
+///       neither covariance transport nor material interaction.
+///
+/// @tparam kLanes Number of tracks that are stepped together
+template <std::size_t kLanes = 4>
+class BatchedEigenStepper final {
+ public:
+  static_assert(kLanes > 0, "At least one lane is required");
+
+  /// Number of tracks that are stepped together
+  static constexpr std::size_t lanes = kLanes;
+
+  /// One value per lane
+  using LaneArray = std::array<double, kLanes>;
+  /// One flag per lane
+  using LaneMask = std::array<bool, kLanes>;
+
+  /// Configuration for the batched Eigen stepper.
+  struct Config {
+    /// Magnetic field provider
+    std::shared_ptr<const MagneticFieldProvider> bField;
+  };
+
+  /// Stepper options, shared by all lanes
+  using Options = StepperPlainOptions;
+
+  /// @brief Structure-of-arrays state of the batch of tracks
+  struct State {
+    /// Constructor from the options and the field cache
+    ///
+    /// @param [in] optionsIn is the options object for the stepper
+    /// @param [in] fieldCacheIn is the cache object for the magnetic field
+    State(const Options& optionsIn, MagneticFieldProvider::Cache fieldCacheIn)
+        : options(optionsIn), fieldCache(std::move(fieldCacheIn)) {}
+
+    /// Configuration options for the stepper
+    Options options;
+
+    /// Lanes that are still propagated
+    LaneMask active{};
+
+    /// Global position components
+    LaneArray posX{}, posY{}, posZ{};
+    /// Global time
+    LaneArray time{};
+    /// Normalized direction components
+    LaneArray dirX{}, dirY{}, dirZ{};
+    /// Charge over momentum
+    LaneArray qOverP{};
+    /// Time derivative dt/ds = sqrt(1 + m^2/p^2), constant in vacuum
+    LaneArray dtds{};
+
+    /// Accumulated path length
+    LaneArray pathAccumulated{};
+    /// Adaptive step size of the runge-kutta integration
+    LaneArray accuracy{};
+    /// Upper limit for the next step, e.g. the distance to the target
+    LaneArray stepLimit{};
+
+    /// Total number of performed steps
+    std::array<std::size_t, kLanes> nSteps{};
+    /// Total number of attempted steps
+    std::array<std::size_t, kLanes> nStepTrials{};
+
+    /// Error that stopped a lane, empty unless the lane failed
+    std::array<std::error_code, kLanes> error{};
+
+    /// Magnetic field cache shared by the batched lookups of all lanes
+    MagneticFieldProvider::Cache fieldCache;
+
+    /// Statistics of the stepper, accumulated over all lanes
+    StepperStatistics statistics;
+  };
+
+  /// Constructor requires knowledge of the detector's magnetic field
+  /// @param bField The magnetic field provider
+  explicit BatchedEigenStepper(
+      std::shared_ptr<const MagneticFieldProvider> bField);
+
+  /// @brief Constructor with configuration
+  ///
+  /// @param [in] config The configuration of the stepper
+  explicit BatchedEigenStepper(const Config& config)
+      : BatchedEigenStepper(config.bField) {}
+
+  /// Create a stepper state with all lanes inactive
+  /// @param options Configuration options for the stepper state
+  /// @return Initialized stepper state object
+  State makeState(const Options& options) const;
+
+  /// Initialize one lane from bound track parameters and activate it
+  /// @param state Stepper state to initialize
+  /// @param lane Index of the lane
+  /// @param par Bound track parameters to initialize from
+  void initialize(State& state, std::size_t lane,
+                  const BoundTrackParameters& par) const;
+
+  /// Stop propagating a lane, e.g. because it reached its target
+  /// @param state Stepper state
+  /// @param lane Index of the lane
+  void deactivate(State& state, std::size_t lane) const {
+    state.active[lane] = false;
+  }
+
+  /// Error that stopped a lane
+  /// @param state Stepper state
+  /// @param lane Index of the lane
+  /// @return The error of a failed lane, or an empty error code otherwise
+  std::error_code error(const State& state, std::size_t lane) const {
+    return state.error[lane];
+  }
+
+  /// Check whether any lane is still propagated
+  /// @param state Stepper state
+  /// @return True if at least one lane is active
+  bool anyActive(const State& state) const;
+
+  /// Limit the next steps of a lane, e.g. to the distance to its target
+  /// @param state Stepper state
+  /// @param lane Index of the lane
+  /// @param limit Absolute value of the maximum step length
+  void setStepLimit(State& state, std::size_t lane, double limit) const {
+    state.stepLimit[lane] = limit;
+  }
+
+  /// Global position of a lane
+  /// @param state Stepper state
+  /// @param lane Index of the lane
+  /// @return Current global position vector
+  Vector3 position(const State& state, std::size_t lane) const {
+    return Vector3(state.posX[lane], state.posY[lane], state.posZ[lane]);
+  }
+
+  /// Momentum direction of a lane
+  /// @param state Stepper state
+  /// @param lane Index of the lane
+  /// @return Current normalized direction vector
+  Vector3 direction(const State& state, std::size_t lane) const {
+    return Vector3(state.dirX[lane], state.dirY[lane], state.dirZ[lane]);
+  }
+
+  /// Charge over momentum of a lane
+  /// @param state Stepper state
+  /// @param lane Index of the lane
+  /// @return Charge over momentum (q/p) value
+  double qOverP(const State& state, std::size_t lane) const {
+    return state.qOverP[lane];
+  }
+
+  /// Global time of a lane
+  /// @param state Stepper state
+  /// @param lane Index of the lane
+  /// @return Current time value
+  double time(const State& state, std::size_t lane) const {
+    return state.time[lane];
+  }
+
+  /// Perform one Runge-Kutta step for all active lanes
+  ///
+  /// Lanes whose field lookup or step size adjustment fails are deactivated,
+  /// see @ref error.
+  ///
+  /// @param [in,out] state is the batched stepper state
+  /// @param [in] propDir is the direction of propagation
+  ///
+  /// @return the step length of every lane (zero for inactive and failed
+  ///         lanes)
+  LaneArray step(State& state, Direction propDir) const;
+
+ private:
+  /// Deactivate a lane and record the error that stopped it
+  void fail(State& state, std::size_t lane, std::error_code error) const;
+
+  /// Look up the magnetic field at the given positions for the masked lanes
+  /// @return the lanes whose lookup failed, which are deactivated
+  LaneMask getFields(State& state, const LaneArray& x, const LaneArray& y,
+                     const LaneArray& z, const LaneMask& mask, LaneArray& bx,
+                     LaneArray& by, LaneArray& bz) const;
+
+  /// Magnetic field provider
+  std::shared_ptr<const MagneticFieldProvider> m_bField;
+};
+
+}  // namespace Acts
+
+#include "Acts/Propagator/BatchedEigenStepper.ipp"
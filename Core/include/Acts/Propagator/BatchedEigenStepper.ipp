@@ -0,0 +1,347 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Propagator/BatchedEigenStepper.hpp"
+
+#include "Acts/Propagator/EigenStepperError.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <span>
+
+template <std::size_t N>
+Acts::BatchedEigenStepper<N>::BatchedEigenStepper(
+    std::shared_ptr<const MagneticFieldProvider> bField)
+    : m_bField(std::move(bField)) {}
+
+template <std::size_t N>
+auto Acts::BatchedEigenStepper<N>::makeState(const Options& options) const
+    -> State {
+  return State(options, m_bField->makeCache(options.magFieldContext));
+}
+
+template <std::size_t N>
+void Acts::BatchedEigenStepper<N>::initialize(
+    State& state, std::size_t lane, const BoundTrackParameters& par) const {
+  const Vector3 pos = par.position(state.options.geoContext);
+  const Vector3 dir = par.direction();
+  const double m = par.particleHypothesis().mass();
+  const double p = par.absoluteMomentum();
+
+  state.active[lane] = true;
+  state.posX[lane] = pos.x();
+  state.posY[lane] = pos.y();
+  state.posZ[lane] = pos.z();
+  state.time[lane] = par.time();
+  state.dirX[lane] = dir.x();
+  state.dirY[lane] = dir.y();
+  state.dirZ[lane] = dir.z();
+  state.qOverP[lane] = par.qOverP();
+  state.dtds[lane] = std::sqrt(1 + m * m / (p * p));
+
+  state.pathAccumulated[lane] = 0;
+  state.accuracy[lane] = state.options.initialStepSize;
+  state.stepLimit[lane] = state.options.maxStepSize;
+  state.nSteps[lane] = 0;
+  state.nStepTrials[lane] = 0;
+  state.error[lane] = {};
+}
+
+template <std::size_t N>
+bool Acts::BatchedEigenStepper<N>::anyActive(const State& state) const {
+  return std::ranges::any_of(state.active, [](bool a) { return a; });
+}
+
+template <std::size_t N>
+void Acts::BatchedEigenStepper<N>::fail(State& state, std::size_t lane,
+                                        std::error_code error) const {
+  state.active[lane] = false;
+  state.error[lane] = error;
+}
+
+template <std::size_t N>
+auto Acts::BatchedEigenStepper<N>::getFields(
+    State& state, const LaneArray& x, const LaneArray& y, const LaneArray& z,
+    const LaneMask& mask, LaneArray& bx, LaneArray& by, LaneArray& bz) const
+    -> LaneMask {
+  LaneMask failed{};
+  // Gather the positions of the masked lanes
+  std::array<Vector3, N> positions;
+  std::array<Vector3, N> fields;
+  std::array<std::size_t, N> laneIndices{};
+  std::size_t n = 0;
+  for (std::size_t i = 0; i < N; ++i) {
+    if (mask[i]) {
+      positions[n] = Vector3(x[i], y[i], z[i]);
+      laneIndices[n++] = i;
+    }
+  }
+  if (n == 0) {
+    return failed;
+  }
+
+  auto res = m_bField->getFieldBatch(std::span(positions.data(), n),
+                                     std::span(fields.data(), n),
+                                     state.fieldCache);
+  if (!res.ok()) {
+    // The batch does not tell which lookup failed, repeat them one by one so
+    // that only the affected lanes are stopped
+    for (std::size_t j = 0; j < n; ++j) {
+      const std::size_t i = laneIndices[j];
+      auto field = m_bField->getField(positions[j], state.fieldCache);
+      if (!field.ok()) {
+        fail(state, i, field.error());
+        failed[i] = true;
+        continue;
+      }
+      fields[j] = *field;
+    }
+  }
+
+  // Scatter the field values back to the lanes
+  for (std::size_t j = 0; j < n; ++j) {
+    const std::size_t i = laneIndices[j];
+    if (failed[i]) {
+      continue;
+    }
+    bx[i] = fields[j].x();
+    by[i] = fields[j].y();
+    bz[i] = fields[j].z();
+  }
+  return failed;
+}
+
+template <std::size_t N>
+auto Acts::BatchedEigenStepper<N>::step(State& state, Direction propDir) const
+    -> LaneArray {
+  const LaneMask& active = state.active;
+  const auto& px = state.posX;
+  const auto& py = state.posY;
+  const auto& pz = state.posZ;
+  const auto& dx = state.dirX;
+  const auto& dy = state.dirY;
+  const auto& dz = state.dirZ;
+  const auto& qop = state.qOverP;
+
+  // For details about these values see ATL-SOFT-PUB-2009-001
+  const auto calcStepSizeScaling = [&](const double errorEstimate_) {
+    constexpr double lower = 0.25;
+    constexpr double upper = 4.0;
+    // This is given by the order of the Runge-Kutta method, the 4th root is
+    // 3x faster than std::pow
+    double x = state.options.stepTolerance / errorEstimate_;
+    x = std::sqrt(std::sqrt(x));
+    return std::clamp(x, lower, upper);
+  };
+  constexpr double marginFactor = 4.0;
+  const double tolerableError = marginFactor * state.options.stepTolerance;
+
+  // Magnetic field evaluations and k_i of the RKN4 algorithm per lane
+  LaneArray b1x{}, b1y{}, b1z{};
+  LaneArray bmx{}, bmy{}, bmz{};
+  LaneArray blx{}, bly{}, blz{};
+  LaneArray k1x{}, k1y{}, k1z{};
+  LaneArray k2x{}, k2y{}, k2z{};
+  LaneArray k3x{}, k3y{}, k3z{};
+  LaneArray k4x{}, k4y{}, k4z{};
+  LaneArray errorEstimate{};
+
+  // First Runge-Kutta point (at current position), lanes failing the lookup
+  // are deactivated and get a zero step below
+  getFields(state, px, py, pz, active, b1x, b1y, b1z);
+  for (std::size_t i = 0; i < N; ++i) {
+    k1x[i] = qop[i] * (dy[i] * b1z[i] - dz[i] * b1y[i]);
+    k1y[i] = qop[i] * (dz[i] * b1x[i] - dx[i] * b1z[i]);
+    k1z[i] = qop[i] * (dx[i] * b1y[i] - dy[i] * b1x[i]);
+  }
+
+  LaneArray h{};
+  for (std::size_t i = 0; i < N; ++i) {
+    h[i] = active[i] ? std::min(state.accuracy[i], state.stepLimit[i]) *
+                           propDir
+                     : 0.;
+  }
+  const LaneArray initialH = h;
+
+  // Select and adjust the appropriate Runge-Kutta step size per lane as given
+  // ATL-SOFT-PUB-2009-001. Accepted lanes are masked while the rejected ones
+  // are retried with a smaller step size.
+  LaneMask pending = active;
+  LaneArray x{}, y{}, z{};
+  std::size_t nStepTrials = 0;
+  // Stop a lane during the step size search, it does not move in this step
+  const auto failPending = [&](std::size_t i, std::error_code error) {
+    fail(state, i, error);
+    pending[i] = false;
+    h[i] = 0.;
+  };
+  while (true) {
+    ++nStepTrials;
+    for (std::size_t i = 0; i < N; ++i) {
+      state.nStepTrials[i] += pending[i] ? 1 : 0;
+      state.statistics.nAttemptedSteps += pending[i] ? 1 : 0;
+    }
+
+    // Second Runge-Kutta point
+    for (std::size_t i = 0; i < N; ++i) {
+      const double half_h = h[i] * 0.5;
+      const double h2 = h[i] * h[i];
+      x[i] = px[i] + half_h * dx[i] + h2 * 0.125 * k1x[i];
+      y[i] = py[i] + half_h * dy[i] + h2 * 0.125 * k1y[i];
+      z[i] = pz[i] + half_h * dz[i] + h2 * 0.125 * k1z[i];
+    }
+    LaneMask failed = getFields(state, x, y, z, pending, bmx, bmy, bmz);
+    for (std::size_t i = 0; i < N; ++i) {
+      if (failed[i]) {
+        failPending(i, state.error[i]);
+      }
+    }
+
+    // Third and last Runge-Kutta point, only committed for pending lanes
+    for (std::size_t i = 0; i < N; ++i) {
+      const double half_h = h[i] * 0.5;
+      const double h2 = h[i] * h[i];
+
+      double tx = dx[i] + half_h * k1x[i];
+      double ty = dy[i] + half_h * k1y[i];
+      double tz = dz[i] + half_h * k1z[i];
+      const double k2xi = qop[i] * (ty * bmz[i] - tz * bmy[i]);
+      const double k2yi = qop[i] * (tz * bmx[i] - tx * bmz[i]);
+      const double k2zi = qop[i] * (tx * bmy[i] - ty * bmx[i]);
+
+      tx = dx[i] + half_h * k2xi;
+      ty = dy[i] + half_h * k2yi;
+      tz = dz[i] + half_h * k2zi;
+      const double k3xi = qop[i] * (ty * bmz[i] - tz * bmy[i]);
+      const double k3yi = qop[i] * (tz * bmx[i] - tx * bmz[i]);
+      const double k3zi = qop[i] * (tx * bmy[i] - ty * bmx[i]);
+
+      k2x[i] = pending[i] ? k2xi : k2x[i];
+      k2y[i] = pending[i] ? k2yi : k2y[i];
+      k2z[i] = pending[i] ? k2zi : k2z[i];
+      k3x[i] = pending[i] ? k3xi : k3x[i];
+      k3y[i] = pending[i] ? k3yi : k3y[i];
+      k3z[i] = pending[i] ? k3zi : k3z[i];
+
+      x[i] = px[i] + h[i] * dx[i] + h2 * 0.5 * k3x[i];
+      y[i] = py[i] + h[i] * dy[i] + h2 * 0.5 * k3y[i];
+      z[i] = pz[i] + h[i] * dz[i] + h2 * 0.5 * k3z[i];
+    }
+    failed = getFields(state, x, y, z, pending, blx, bly, blz);
+    for (std::size_t i = 0; i < N; ++i) {
+      if (failed[i]) {
+        failPending(i, state.error[i]);
+      }
+    }
+
+    // Compute the local integration error estimate
+    for (std::size_t i = 0; i < N; ++i) {
+      const double tx = dx[i] + h[i] * k3x[i];
+      const double ty = dy[i] + h[i] * k3y[i];
+      const double tz = dz[i] + h[i] * k3z[i];
+      const double k4xi = qop[i] * (ty * blz[i] - tz * bly[i]);
+      const double k4yi = qop[i] * (tz * blx[i] - tx * blz[i]);
+      const double k4zi = qop[i] * (tx * bly[i] - ty * blx[i]);
+
+      k4x[i] = pending[i] ? k4xi : k4x[i];
+      k4y[i] = pending[i] ? k4yi : k4y[i];
+      k4z[i] = pending[i] ? k4zi : k4z[i];
+
+      const double error =
+          h[i] * h[i] *
+          (std::abs(k1x[i] - k2x[i] - k3x[i] + k4x[i]) +
+           std::abs(k1y[i] - k2y[i] - k3y[i] + k4y[i]) +
+           std::abs(k1z[i] - k2z[i] - k3z[i] + k4z[i]));
+      // Protect against division by zero
+      errorEstimate[i] =
+          pending[i] ? std::max(1e-20, error) : errorEstimate[i];
+    }
+
+    bool anyPending = false;
+    for (std::size_t i = 0; i < N; ++i) {
+      if (!pending[i]) {
+        continue;
+      }
+      if (errorEstimate[i] <= tolerableError) {
+        pending[i] = false;
+        continue;
+      }
+
+      ++state.statistics.nRejectedSteps;
+      h[i] *= calcStepSizeScaling(errorEstimate[i]);
+
+      // If step size becomes too small the particle remains at the initial
+      // place
+      if (std::abs(h[i]) < std::abs(state.options.stepSizeCutOff)) {
+        // Not moving due to too low momentum needs an aborter
+        failPending(i, EigenStepperError::StepSizeStalled);
+        continue;
+      }
+      anyPending = true;
+    }
+    if (!anyPending) {
+      break;
+    }
+
+    // If the parameter is off track too much or given stepSize is not
+    // appropriate
+    if (nStepTrials > state.options.maxRungeKuttaStepTrials) {
+      // Too many trials, have to abort the remaining lanes
+      for (std::size_t i = 0; i < N; ++i) {
+        if (pending[i]) {
+          failPending(i, EigenStepperError::StepSizeAdjustmentFailed);
+        }
+      }
+      break;
+    }
+  }
+
+  // Update the track parameters according to the equations of motion
+  for (std::size_t i = 0; i < N; ++i) {
+    const double h2 = h[i] * h[i];
+    const double nx =
+        dx[i] + h[i] / 6. * (k1x[i] + 2. * (k2x[i] + k3x[i]) + k4x[i]);
+    const double ny =
+        dy[i] + h[i] / 6. * (k1y[i] + 2. * (k2y[i] + k3y[i]) + k4y[i]);
+    const double nz =
+        dz[i] + h[i] / 6. * (k1z[i] + 2. * (k2z[i] + k3z[i]) + k4z[i]);
+    const double norm = std::sqrt(nx * nx + ny * ny + nz * nz);
+
+    state.posX[i] += h[i] * dx[i] + h2 / 6. * (k1x[i] + k2x[i] + k3x[i]);
+    state.posY[i] += h[i] * dy[i] + h2 / 6. * (k1y[i] + k2y[i] + k3y[i]);
+    state.posZ[i] += h[i] * dz[i] + h2 / 6. * (k1z[i] + k2z[i] + k3z[i]);
+    state.time[i] += h[i] * state.dtds[i];
+    // inactive lanes have a zero step and might have no valid direction
+    state.dirX[i] = active[i] ? nx / norm : dx[i];
+    state.dirY[i] = active[i] ? ny / norm : dy[i];
+    state.dirZ[i] = active[i] ? nz / norm : dz[i];
+    state.pathAccumulated[i] += h[i];
+  }
+
+  for (std::size_t i = 0; i < N; ++i) {
+    if (!active[i]) {
+      continue;
+    }
+    ++state.nSteps[i];
+    ++state.statistics.nSuccessfulSteps;
+    state.statistics.pathLength += h[i];
+    state.statistics.absolutePathLength += std::abs(h[i]);
+
+    const double stepSizeScaling = calcStepSizeScaling(errorEstimate[i]);
+    const double nextAccuracy = std::abs(h[i] * stepSizeScaling);
+    const double previousAccuracy = std::abs(state.accuracy[i]);
+    const double initialStepLength = std::abs(initialH[i]);
+    if (nextAccuracy < initialStepLength || nextAccuracy > previousAccuracy) {
+      state.accuracy[i] = nextAccuracy;
+    }
+  }
+
+  return h;
+}
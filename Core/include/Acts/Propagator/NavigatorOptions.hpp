@@ -17,6 +17,7 @@
 namespace Acts {
 
 class GeometryContext;
+class NavigationCandidateCache;
 class Surface;
 class TrackingVolume;
 
@@ -63,6 +64,13 @@ struct NavigatorPlainOptions {
   /// Surfaces that are not part of the tracking geometry
   std::vector<const Surface*> externalSurfaces;
 
+  /// Optional cache of the navigation policy candidates which is shared
+  /// between propagations, see @ref Acts::NavigationCandidateCache. Only used
+  /// by the @ref Acts::Navigator for Gen3 geometries and for volumes whose
+  /// navigation policy is query independent. The cache must outlive the
+  /// propagation and must not be used by several threads at the same time.
+  NavigationCandidateCache* candidateCache = nullptr;
+
   /// Append an external surface to be considered during navigation. The surface
   /// will be intersected without bounds check to force the propagation to
   /// resolve it. Note the surface must outlive the propagation and surfaces
@@ -21,6 +21,13 @@ struct NavigatorStatistics {
 
   /// Number of volume switches
   std::size_t nVolumeSwitches = 0;
+
+  /// Number of candidate resolutions served by the candidate cache
+  std::size_t nCandidateCacheHits = 0;
+
+  /// Number of candidate resolutions which had to query the navigation policy
+  /// although a candidate cache was configured
+  std::size_t nCandidateCacheMisses = 0;
 };
 
 }  // namespace Acts
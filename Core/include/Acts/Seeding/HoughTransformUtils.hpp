@@ -8,12 +8,17 @@
 
 #pragma once
 
-#include "Acts/Utilities/Grid.hpp"
-
 #include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <mutex>
 #include <span>
 #include <stdexcept>
+#include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 namespace Acts::HoughTransformUtils {
 
@@ -156,16 +161,21 @@ struct HoughPlaneConfig {
 /// @brief Representation of the hough plane - the histogram used
 /// for the hough transform with methods to fill and evaluate
 /// the histogram. Templated to a class used as identifier for the hits
+///
+/// The hit and layer yields are kept in flat arrays indexed by the global
+/// bin, while the hit identifiers are appended to a single entry list as the
+/// plane is filled. The per-cell hit and layer lists are assembled from this
+/// list in one counting-sort pass the first time they are accessed after a
+/// fill. This pass is guarded by a mutex, so that the const accessors can be
+/// called concurrently once the plane is filled. Copies and moves of a plane
+/// rebuild their lists on the next access. Resetting the plane only clears
+/// the touched cells and keeps all buffers, so a plane that is reused does
+/// not allocate once it has seen its largest occupancy.
 template <class identifier_t>
 class HoughPlane {
  public:
-  /// @brief hough histogram representation as a 2D-indexable vector of hough cells
-  using Axis =
-      Acts::Axis<Acts::AxisType::Equidistant, Acts::AxisBoundaryType::Bound>;
-  /// Type alias for Hough histogram grid
-  using HoughHist = Grid<HoughCell<identifier_t>, Axis, Axis>;
-  /// Type alias for histogram index type
-  using Index = typename HoughHist::index_t;
+  /// Type alias for the (x,y) bin indices of a cell
+  using Index = std::array<std::size_t, 2>;
 
   /// @brief instantiate the (empty) hough plane
   /// @param cfg: configuration
@@ -203,7 +213,13 @@ class HoughPlane {
   std::span<const unsigned, std::dynamic_extent> layers(
       std::size_t xBin, std::size_t yBin) const {
     checkIndices(xBin, yBin);
-    return m_houghHist.atLocalBins({xBin, yBin}).getLayers();
+    const std::uint32_t cell = m_cellOfBin[globalBin({xBin, yBin})];
+    if (cell == s_noCell) {
+      return {};
+    }
+    buildCellLists();
+    return std::span<const unsigned>(m_layerList).subspan(
+        m_layerOffsets[cell], m_layerOffsets[cell + 1] - m_layerOffsets[cell]);
   }
 
   /// @brief get the (weighted) number of layers  with hits in one cell of the histogram
@@ -213,7 +229,7 @@ class HoughPlane {
   /// @throws out of range if indices are not within plane limits
   YieldType nLayers(std::size_t xBin, std::size_t yBin) const {
     checkIndices(xBin, yBin);
-    return m_houghHist.atLocalBins({xBin, yBin}).nLayers();
+    return m_nLayers[globalBin({xBin, yBin})];
   }
 
   /// @brief get the identifiers of all hits in one cell of the histogram
@@ -225,7 +241,13 @@ class HoughPlane {
   std::span<const identifier_t, std::dynamic_extent> hitIds(
       std::size_t xBin, std::size_t yBin) const {
     checkIndices(xBin, yBin);
-    return m_houghHist.atLocalBins({xBin, yBin}).getHits();
+    const std::uint32_t cell = m_cellOfBin[globalBin({xBin, yBin})];
+    if (cell == s_noCell) {
+      return {};
+    }
+    buildCellLists();
+    return std::span<const identifier_t>(m_hitList).subspan(
+        m_hitOffsets[cell], m_hitOffsets[cell + 1] - m_hitOffsets[cell]);
   }
   /// @brief get the identifiers of all hits in one cell of the histogram
   /// @param xBin: bin index in the first coordinate
@@ -235,8 +257,7 @@ class HoughPlane {
   /// @throws out of range if indices are not within plane limits
   std::unordered_set<const identifier_t> uniqueHitIds(std::size_t xBin,
                                                       std::size_t yBin) const {
-    checkIndices(xBin, yBin);
-    const auto hits_span = m_houghHist.atLocalBins({xBin, yBin}).getHits();
+    const auto hits_span = hitIds(xBin, yBin);
     return std::unordered_set<identifier_t>(hits_span.begin(), hits_span.end());
   }
   /// @brief access the (weighted) number of hits in one cell of the histogram from bin's coordinates
@@ -246,15 +267,19 @@ class HoughPlane {
   /// @throws out of range if indices are not within plane limits
   YieldType nHits(std::size_t xBin, std::size_t yBin) const {
     checkIndices(xBin, yBin);
-    return m_houghHist.atLocalBins({xBin, yBin}).nHits();
+    return m_nHits[globalBin({xBin, yBin})];
   }
 
   /// @brief access the (weighted) number of hits in one cell of the histogram from globalBin index
   /// @param globalBin: global bin index
   /// @return the (weighted) number of hits for this cell
-  YieldType nHits(std::size_t globalBin) const {
-    return m_houghHist.at(globalBin).nHits();
-  }
+  YieldType nHits(std::size_t globalBin) const { return m_nHits[globalBin]; }
+
+  /// @brief access the (weighted) hit counts of all cells as one flat array,
+  /// indexed by the global bin. Allows scanning the plane without going
+  /// through the per-cell accessors.
+  /// @return Span over the hit counts of all cells
+  std::span<const YieldType> hitCounts() const { return m_nHits; }
 
   /// @brief get the number of bins on the first coordinate
   /// @return Number of bins in the X direction
@@ -271,8 +296,9 @@ class HoughPlane {
   /// @brief get the list of cells with non-zero content.
   /// Useful for peak-finders in sparse data
   /// to avoid looping over all cells
-  /// @return Reference to set of global bin indices with non-zero content
-  const std::unordered_set<std::size_t>& getNonEmptyBins() const {
+  /// @return Reference to the global bin indices with non-zero content,
+  ///         in the order in which they were first filled
+  const std::vector<std::size_t>& getNonEmptyBins() const {
     return m_touchedBins;
   }
 
@@ -280,14 +306,14 @@ class HoughPlane {
   /// @param globalBin Global bin index to convert to coordinates
   /// @return Local bin coordinates (x,y) corresponding to global bin index
   Index axisBins(std::size_t globalBin) const {
-    return m_houghHist.localBinsFromGlobalBin(globalBin);
+    return {globalBin / m_cfg.nBinsY, globalBin % m_cfg.nBinsY};
   }
 
   /// @brief get the globalBin index given the coordinates of the bin
   /// @param indexBin Bin coordinates to convert to global index
   /// @return Global bin index corresponding to local bin coordinates
   std::size_t globalBin(Index indexBin) const {
-    return m_houghHist.globalBinFromLocalBins(indexBin);
+    return indexBin[0] * m_cfg.nBinsY + indexBin[1];
   }
 
   /// @brief get the bin indices of the cell containing the largest number
@@ -316,10 +342,40 @@ class HoughPlane {
   /// @param identifier: hit identifier
   /// @param layer: layer index
   /// @param w: optional hit weight
+  /// @throws out of range if indices are not within plane limits
   void fillBin(std::size_t binX, std::size_t binY,
                const identifier_t& identifier, unsigned layer, double w = 1.0f);
 
  private:
+  /// marker for bins without an associated cell
+  static constexpr std::uint32_t s_noCell =
+      std::numeric_limits<std::uint32_t>::max();
+
+  /// @brief one accepted fill of a cell, in the order of filling
+  struct Entry {
+    std::uint32_t cell = s_noCell;  // index of the touched cell
+    bool newLayer = false;  // true if the hit added a layer to the cell
+    unsigned layer = 0;             // layer of the hit
+    identifier_t identifier{};      // identifier of the hit
+  };
+
+  /// @brief guards the lazy assembly of the per-cell lists
+  ///
+  /// Copying or moving a plane does not share the guard, the target only
+  /// marks its lists as invalid, so that planes stay copyable and movable.
+  struct CellListsGuard {
+    CellListsGuard() = default;
+    CellListsGuard(const CellListsGuard& /*other*/) {}
+    CellListsGuard& operator=(const CellListsGuard& /*other*/) {
+      valid.store(false, std::memory_order_relaxed);
+      return *this;
+    }
+    ~CellListsGuard() = default;
+
+    std::atomic<bool> valid = false;
+    std::mutex mutex;
+  };
+
   YieldType m_maxHits = 0.0f;    // track the maximum number of hits seen
   YieldType m_maxLayers = 0.0f;  // track the maximum number of layers seen
 
@@ -328,18 +384,35 @@ class HoughPlane {
   /// track the location of the maximum in layers
   std::pair<std::size_t, std::size_t> m_maxLocLayers = {0, 0};
 
-  std::size_t m_assignBatch{20};
-
-  /// track the bins with non-trivial content
-  std::unordered_set<std::size_t> m_touchedBins{};
-
-  std::size_t m_iBin = 0;
-
   HoughPlaneConfig m_cfg;  // the configuration object
-  HoughHist m_houghHist;   // the histogram data object
+
+  /// (weighted) hit and layer counts per global bin
+  std::vector<YieldType> m_nHits;
+  std::vector<YieldType> m_nLayers;
+  /// index of the touched cell for each global bin, s_noCell if empty
+  std::vector<std::uint32_t> m_cellOfBin;
+
+  /// global bins of the touched cells, indexed by the cell
+  std::vector<std::size_t> m_touchedBins{};
+  /// index of the most recent entry of each touched cell
+  std::vector<std::size_t> m_lastEntryOfCell{};
+  /// all accepted fills, in the order of filling
+  std::vector<Entry> m_entries{};
+
+  /// per-cell hit and layer lists, assembled lazily from m_entries
+  mutable CellListsGuard m_cellLists;
+  mutable std::vector<std::size_t> m_hitOffsets{};
+  mutable std::vector<std::size_t> m_layerOffsets{};
+  mutable std::vector<std::size_t> m_fillCursor{};
+  mutable std::vector<identifier_t> m_hitList{};
+  mutable std::vector<unsigned> m_layerList{};
 
   /// @brief check if indices are are valid
   void checkIndices(std::size_t x, std::size_t y) const;
+
+  /// @brief sort the entries into the per-cell hit and layer lists,
+  /// if they were changed since the last call. Safe to call concurrently.
+  void buildCellLists() const;
 };
 
 /// example peak finders.
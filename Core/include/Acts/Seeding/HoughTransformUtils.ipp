@@ -11,6 +11,7 @@
 #include "Acts/Seeding/HoughTransformUtils.hpp"
 
 #include <algorithm>
+#include <numeric>
 #include <tuple>
 
 template <class identifier_t>
@@ -104,31 +105,48 @@ template <class identifier_t>
 Acts::HoughTransformUtils::HoughPlane<identifier_t>::HoughPlane(
     const HoughPlaneConfig& cfg)
     : m_cfg(cfg),
-      m_houghHist(Axis(0, m_cfg.nBinsX, m_cfg.nBinsX),
-                  Axis(0, m_cfg.nBinsY, m_cfg.nBinsY)) {
-  // instantiate our histogram.
-  // m_houghHist = HoughHist(Axis(0, m_cfg.nBinsX, m_cfg.nBinsX), Axis(0,
-  // m_cfg.nBinsY, m_cfg.nBinsY));
-}
+      m_nHits(m_cfg.nBinsX * m_cfg.nBinsY, 0.0f),
+      m_nLayers(m_cfg.nBinsX * m_cfg.nBinsY, 0.0f),
+      m_cellOfBin(m_cfg.nBinsX * m_cfg.nBinsY, s_noCell) {}
+
 template <class identifier_t>
 void Acts::HoughTransformUtils::HoughPlane<identifier_t>::fillBin(
     std::size_t binX, std::size_t binY, const identifier_t& identifier,
     unsigned layer, double w) {
+  checkIndices(binX, binY);
+  const std::size_t bin = globalBin({binX, binY});
   // mark that this bin was filled with non trivial content
-
-  m_touchedBins.insert(globalBin({binX, binY}));
+  std::uint32_t& cell = m_cellOfBin[bin];
+  bool newLayer = true;
+  if (cell == s_noCell) {
+    cell = static_cast<std::uint32_t>(m_touchedBins.size());
+    m_touchedBins.push_back(bin);
+    m_lastEntryOfCell.push_back(m_entries.size());
+  } else {
+    const Entry& last = m_entries[m_lastEntryOfCell[cell]];
+    // the same hit filled twice in a row is only counted once
+    if (last.identifier == identifier) {
+      return;
+    }
+    // and a layer is only counted when it differs from the previous hit
+    newLayer = last.layer != layer;
+    m_lastEntryOfCell[cell] = m_entries.size();
+  }
+  m_entries.push_back(Entry{cell, newLayer, layer, identifier});
+  m_cellLists.valid.store(false, std::memory_order_relaxed);
 
   // add content to the cell
-  m_houghHist.atLocalBins({binX, binY}).fill(identifier, layer, w);
+  m_nHits[bin] += w;
+  if (newLayer) {
+    m_nLayers[bin] += w;
+  }
   // and update our cached maxima
-  YieldType layers = nLayers(binX, binY);
-  YieldType hits = nHits(binX, binY);
-  if (layers > m_maxLayers) {
-    m_maxLayers = layers;
+  if (m_nLayers[bin] > m_maxLayers) {
+    m_maxLayers = m_nLayers[bin];
     m_maxLocLayers = {binX, binY};
   }
-  if (hits > m_maxHits) {
-    m_maxHits = hits;
+  if (m_nHits[bin] > m_maxHits) {
+    m_maxHits = m_nHits[bin];
     m_maxLocHits = {binX, binY};
   }
 }
@@ -137,16 +155,63 @@ template <class identifier_t>
 void Acts::HoughTransformUtils::HoughPlane<identifier_t>::reset() {
   // reset all bins that were previously filled
   // avoid calling this on empty cells to save time
-  for (auto bin : getNonEmptyBins()) {
-    m_houghHist.at(bin).reset();
+  for (const std::size_t bin : m_touchedBins) {
+    m_nHits[bin] = 0.;
+    m_nLayers[bin] = 0.;
+    m_cellOfBin[bin] = s_noCell;
   }
   // don't forget to reset our cached maxima
   m_maxHits = 0.;
   m_maxLayers = 0.;
-  // and reset the list of nontrivial bins
-  m_iBin = 0;
+  // and reset the list of nontrivial bins. The buffers keep their capacity
   m_touchedBins.clear();
+  m_lastEntryOfCell.clear();
+  m_entries.clear();
+  m_cellLists.valid.store(false, std::memory_order_relaxed);
 }
+
+template <class identifier_t>
+void Acts::HoughTransformUtils::HoughPlane<identifier_t>::buildCellLists()
+    const {
+  if (m_cellLists.valid.load(std::memory_order_acquire)) {
+    return;
+  }
+  std::lock_guard lock(m_cellLists.mutex);
+  if (m_cellLists.valid.load(std::memory_order_relaxed)) {
+    return;
+  }
+  // count the hits and layers per cell, shifted by one to turn the
+  // counts into offsets by a running sum
+  const std::size_t nCells = m_touchedBins.size();
+  m_hitOffsets.assign(nCells + 1, 0);
+  m_layerOffsets.assign(nCells + 1, 0);
+  for (const Entry& entry : m_entries) {
+    ++m_hitOffsets[entry.cell + 1];
+    if (entry.newLayer) {
+      ++m_layerOffsets[entry.cell + 1];
+    }
+  }
+  std::partial_sum(m_hitOffsets.begin(), m_hitOffsets.end(),
+                   m_hitOffsets.begin());
+  std::partial_sum(m_layerOffsets.begin(), m_layerOffsets.end(),
+                   m_layerOffsets.begin());
+
+  // scatter the entries into their cells, keeping the fill order per cell
+  m_hitList.resize(m_hitOffsets.back());
+  m_fillCursor.assign(m_hitOffsets.begin(), m_hitOffsets.end() - 1);
+  for (const Entry& entry : m_entries) {
+    m_hitList[m_fillCursor[entry.cell]++] = entry.identifier;
+  }
+  m_layerList.resize(m_layerOffsets.back());
+  m_fillCursor.assign(m_layerOffsets.begin(), m_layerOffsets.end() - 1);
+  for (const Entry& entry : m_entries) {
+    if (entry.newLayer) {
+      m_layerList[m_fillCursor[entry.cell]++] = entry.layer;
+    }
+  }
+  m_cellLists.valid.store(true, std::memory_order_release);
+}
+
 template <class identifier_t>
 void Acts::HoughTransformUtils::HoughPlane<identifier_t>::checkIndices(
     std::size_t xBin, std::size_t yBin) const {
@@ -268,7 +333,7 @@ Acts::HoughTransformUtils::PeakFinders::IslandsAroundMax<
   // and obtain the fraction of the max that is our cutoff for island formation
   YieldType min = std::max(m_cfg.threshold, m_cfg.fractionCutoff * max);
   // book a list for the candidates and the maxima
-  const std::unordered_set<std::size_t>& nonEmptyBins{plane.getNonEmptyBins()};
+  const std::vector<std::size_t>& nonEmptyBins{plane.getNonEmptyBins()};
   std::vector<std::size_t> candidates;
   candidates.reserve(nonEmptyBins.size());
   std::vector<Maximum> maxima;
@@ -504,12 +569,15 @@ Acts::HoughTransformUtils::PeakFinders::slidingWindowPeaks(
     const Acts::HoughTransformUtils::PeakFinders::SlidingWindowConfig& config) {
   using IndexType = Acts::HoughTransformUtils::HoughPlane<identifier_t>::Index;
   std::vector<IndexType> output;
+  // scan the flat count array directly, the window checks are only needed
+  // for the few cells above threshold
+  const std::span<const YieldType> counts = plane.hitCounts();
 
   for (std::size_t x = config.xWindowSize;
        x < plane.nBinsX() - config.xWindowSize; ++x) {
     for (std::size_t y = config.yWindowSize;
          y < plane.nBinsY() - config.yWindowSize; ++y) {
-      if (plane.nHits(x, y) >= config.threshold) {
+      if (counts[plane.globalBin({x, y})] >= config.threshold) {
         const IndexType index({x, y});
         if (passWindow(index, plane, config)) {
           output.push_back(config.recenter
@@ -159,6 +159,15 @@ class HoughAccumulatorSection {
   bool isLineInside(F &&function) const &
     requires std::invocable<F, float>;
 
+  /// @brief true if the line with given values at the section edges passes the section
+  /// @param yLeft - value of the line at the left side of the section
+  /// @param yRight - value of the line at the right side of the section
+  /// @return true if the line passes the section
+  bool isLineInside(float yLeft, float yRight) const & {
+    return (yRight > yLeft) ? yLeft < m_yBegin + m_ySize && yRight > m_yBegin
+                            : yLeft > m_yBegin && yRight < m_yBegin + m_ySize;
+  }
+
   /// @brief check if the lines cross inside the section
   /// @param line1 - functional form of line 1
   /// @param line2 - functional form of line 2
@@ -214,10 +223,7 @@ template <typename F>
 inline bool HoughAccumulatorSection::isLineInside(F &&function) const &
   requires std::invocable<F, float>
 {
-  const float yB = function(m_xBegin);
-  const float yE = function(m_xBegin + m_xSize);
-  return (yE > yB) ? yB < m_yBegin + m_ySize && yE > m_yBegin
-                   : yB > m_yBegin && yE < m_yBegin + m_ySize;
+  return isLineInside(function(m_xBegin), function(m_xBegin + m_xSize));
 }
 
 template <typename F>
@@ -331,72 +337,169 @@ struct HoughExplorationOptions {
   DecisionFunctor decisionFunctor;
 };
 
+/// @brief pool of index vectors of sections that are no longer needed
+/// Allows the exploration to reuse their memory for new sections.
+/// Not thread safe, each thread should use its own pool.
+class HoughSectionPool {
+ public:
+  /// @brief provide an empty vector of indices, reusing released memory if possible
+  /// @return empty vector
+  std::vector<std::uint32_t> acquire() {
+    if (m_free.empty()) {
+      return {};
+    }
+    std::vector<std::uint32_t> indices = std::move(m_free.back());
+    m_free.pop_back();
+    indices.clear();
+    return indices;
+  }
+
+  /// @brief give back the indices of a section that is not used anymore
+  /// @param indices - vector which memory can be reused
+  void release(std::vector<std::uint32_t> &&indices) {
+    if (indices.capacity() > 0) {
+      m_free.push_back(std::move(indices));
+    }
+  }
+
+ private:
+  std::vector<std::vector<std::uint32_t>> m_free;
+};
+
+/// @brief split one section and distribute the subsections according to the decision
+/// @tparam Measurement - type of measurements
+/// @param section - the section to split, its indices are released to the pool
+/// @param measurements - measurements to which indices are kept in HoughAccumulatorSection
+/// @param opt - exploration directives
+/// @param pool - source of memory for the indices of the subsections
+/// @param toExplore - subsections to be split further are appended here
+/// @param results - subsections that satisfied acceptance criteria are appended here
+template <typename Measurement>
+void splitHoughSection(HoughAccumulatorSection &&section,
+                       const std::vector<Measurement> &measurements,
+                       const HoughExplorationOptions<Measurement> &opt,
+                       HoughSectionPool &pool,
+                       std::vector<HoughAccumulatorSection> &toExplore,
+                       std::vector<HoughAccumulatorSection> &results) {
+  std::array<HoughAccumulatorSection, 4> newSections;
+  std::size_t nNew = 0;
+  const bool splitX = section.xSize() > opt.xMinBinSize;
+  const bool splitY = section.ySize() > opt.yMinBinSize;
+  if (splitX && splitY) {
+    // Split into 4 sections
+    newSections[nNew++] = section.bottomLeft();
+    newSections[nNew++] = section.topLeft();
+    newSections[nNew++] = section.bottomRight();
+    newSections[nNew++] = section.topRight();
+  } else if (!splitX && splitY) {
+    // Split into 2 sections horizontally
+    newSections[nNew++] = section.bottom();
+    newSections[nNew++] = section.top();
+  } else if (splitX && !splitY) {
+    // Split into 2 sections vertically
+    newSections[nNew++] = section.left();
+    newSections[nNew++] = section.right();
+  }
+
+  if (section.decision() ==
+      HoughAccumulatorSection::Decision::DrillAndExpand) {
+    for (std::size_t i = 0; i < nNew; ++i) {
+      newSections[i].expand(opt.expandX, opt.expandY);
+    }
+  }
+
+  // the subsections share their sides, so each line only needs to be
+  // evaluated once per distinct side position
+  std::array<float, 8> sides{};
+  std::array<std::array<std::size_t, 2>, 4> sidesOf{};
+  std::size_t nSides = 0;
+  const auto sideIndex = [&sides, &nSides](float x) {
+    for (std::size_t k = 0; k < nSides; ++k) {
+      if (sides[k] == x) {
+        return k;
+      }
+    }
+    sides[nSides] = x;
+    return nSides++;
+  };
+  for (std::size_t i = 0; i < nNew; ++i) {
+    const HoughAccumulatorSection &s = newSections[i];
+    sidesOf[i] = {sideIndex(s.xBegin()), sideIndex(s.xBegin() + s.xSize())};
+    newSections[i].indices() = pool.acquire();
+  }
+
+  std::array<float, 8> ySides{};
+  for (const std::uint32_t idx : section.indices()) {
+    const auto &m = measurements[idx];
+    for (std::size_t k = 0; k < nSides; ++k) {
+      ySides[k] = opt.lineFunctor(m, sides[k]);
+    }
+    for (std::size_t i = 0; i < nNew; ++i) {
+      if (newSections[i].isLineInside(ySides[sidesOf[i][0]],
+                                      ySides[sidesOf[i][1]])) {
+        newSections[i].indices().push_back(idx);
+      }
+    }
+  }
+  pool.release(std::move(section.indices()));
+
+  for (std::size_t i = 0; i < nNew; ++i) {
+    HoughAccumulatorSection &s = newSections[i];
+    s.updateDecision(opt.decisionFunctor(s, measurements));
+    if (s.decision() == HoughAccumulatorSection::Decision::Accept) {
+      results.push_back(std::move(s));
+    } else if (s.decision() == HoughAccumulatorSection::Decision::Drill ||
+               s.decision() ==
+                   HoughAccumulatorSection::Decision::DrillAndExpand) {
+      toExplore.push_back(std::move(s));
+    } else {
+      pool.release(std::move(s.indices()));
+    }
+  }
+}
+
 /// @brief function that walks through the section splitting them (depth-first) and
+/// collects the accepted ones.
+/// The sections are taken from the back of the stack, so the results are the
+/// same as when exploring each section of the stack on its own, starting from
+/// the last one, and concatenating the results in that order.
 /// @tparam Measurement - type of measurements
-/// @tparam Functor - for translation from measurements to Hough space
 /// @param sectionsStack - the stacks to consider
 /// @param measurements - measurements to which indices are kept in HoughAccumulatorSection
 /// @param opt - exploration directives
 /// @param results - sectoins that satisfied acceptance criteria
+/// @param pool - memory for the indices of the sections, reused between splits
 template <typename Measurement>
 void exploreHoughParametersSpace(
     std::vector<HoughAccumulatorSection> &sectionsStack,
     const std::vector<Measurement> &measurements,
     const HoughExplorationOptions<Measurement> &opt,
-    std::vector<HoughAccumulatorSection> &results) {
+    std::vector<HoughAccumulatorSection> &results, HoughSectionPool &pool) {
   while (!sectionsStack.empty()) {
     HoughAccumulatorSection thisSection = std::move(sectionsStack.back());
     sectionsStack.pop_back();
-
-    std::vector<HoughAccumulatorSection> newSections;
-    const bool splitX = thisSection.xSize() > opt.xMinBinSize;
-    const bool splitY = thisSection.ySize() > opt.yMinBinSize;
-    if (splitX && splitY) {
-      // Split into 4 sections
-      newSections.push_back(thisSection.bottomLeft());
-      newSections.push_back(thisSection.topLeft());
-      newSections.push_back(thisSection.bottomRight());
-      newSections.push_back(thisSection.topRight());
-    } else if (!splitX && splitY) {
-      // Split into 2 sections horizontally
-      newSections.push_back(thisSection.bottom());
-      newSections.push_back(thisSection.top());
-    } else if (splitX && !splitY) {
-      // Split into 2 sections vertically
-      newSections.push_back(thisSection.left());
-      newSections.push_back(thisSection.right());
-    }
-
-    if (thisSection.decision() ==
-        HoughAccumulatorSection::Decision::DrillAndExpand) {
-      for (HoughAccumulatorSection &s : newSections) {
-        s.expand(opt.expandX, opt.expandY);
-      }
-    }
-
-    for (const std::uint32_t idx : thisSection.indices()) {
-      const auto &m = measurements[idx];
-      const auto line = [&](float x) { return opt.lineFunctor(m, x); };
-
-      for (HoughAccumulatorSection &s : newSections) {
-        if (s.isLineInside(line)) {
-          s.indices().push_back(idx);
-        }
-      }
-    }
-    for (HoughAccumulatorSection &s : newSections) {
-      s.updateDecision(opt.decisionFunctor(s, measurements));
-      if (s.decision() == HoughAccumulatorSection::Decision::Accept) {
-        results.push_back(std::move(s));
-      } else if (s.decision() == HoughAccumulatorSection::Decision::Drill ||
-                 s.decision() ==
-                     HoughAccumulatorSection::Decision::DrillAndExpand) {
-        sectionsStack.push_back(std::move(s));
-      }
-    }
+    splitHoughSection(std::move(thisSection), measurements, opt, pool,
+                      sectionsStack, results);
   }
 }
 
+/// @brief function that walks through the section splitting them (depth-first) and
+/// collects the accepted ones, @see above
+/// @tparam Measurement - type of measurements
+/// @param sectionsStack - the stacks to consider
+/// @param measurements - measurements to which indices are kept in HoughAccumulatorSection
+/// @param opt - exploration directives
+/// @param results - sectoins that satisfied acceptance criteria
+template <typename Measurement>
+void exploreHoughParametersSpace(
+    std::vector<HoughAccumulatorSection> &sectionsStack,
+    const std::vector<Measurement> &measurements,
+    const HoughExplorationOptions<Measurement> &opt,
+    std::vector<HoughAccumulatorSection> &results) {
+  HoughSectionPool pool;
+  exploreHoughParametersSpace(sectionsStack, measurements, opt, results, pool);
+}
+
 /// @brief Helper for fast check if there is enough line crossings within HoughAccumulatorSection
 /// @tparam Measurement
 /// @tparam Functor
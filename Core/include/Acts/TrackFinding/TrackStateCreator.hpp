@@ -27,10 +27,14 @@ namespace Acts {
 ///   track states. The track states of these branches still lack the filtered
 ///    data which is to be filled by the next stage e.g. the
 ///    CombinatorialKalmanFilter.
-/// All track states, the temporary track states and track states for selected
-/// measurements, are created in the given trajectory. The resulting container
-/// may become big. Thus, it is advisable to copy selected tracks and their
-/// track states to a separate container after each track finding step.
+/// By default all track states, the temporary track states and track states
+/// for selected measurements, are created in the given trajectory. The
+/// resulting container may become big. Thus, it is advisable to copy selected
+/// tracks and their track states to a separate container after each track
+/// finding step. Alternatively a separate candidate trajectory can be
+/// configured, which holds the temporary track states of one surface at a
+/// time and is reused for all surfaces, so that only the track states of the
+/// selected measurements and outliers are added to the given trajectory.
 ///
 template <typename source_link_iterator_t, typename track_container_t>
 struct TrackStateCreator {
@@ -84,6 +88,14 @@ struct TrackStateCreator {
   MeasurementSelector measurementSelector{
       DelegateFuncTag<voidMeasurementSelector>{}};
 
+  /// Optional container for the temporary track states of the measurement
+  /// candidates on a surface. It is cleared for every surface, which keeps
+  /// its storage, so that the calibration and selection do not grow the
+  /// trajectory of the track finding. If not set, the temporary track states
+  /// are created in the trajectory of the track finding.
+  /// @note The container must not be shared between concurrent track findings
+  TrackStateContainerBackend* candidateTrajectory = nullptr;
+
  public:
   /// @brief extend the trajectory onto the given surface.
   ///
@@ -153,6 +165,11 @@ struct TrackStateCreator {
     const auto& [boundParams, jacobian, pathLength] = boundState;
 
     trackStateCandidates.clear();
+    TrackStateContainerBackend& candidates =
+        candidateTrajectory != nullptr ? *candidateTrajectory : trajectory;
+    if (candidateTrajectory != nullptr) {
+      candidateTrajectory->clear();
+    }
     if constexpr (std::ranges::random_access_range<source_link_iterator_t>) {
       trackStateCandidates.reserve(std::distance(slBegin, slEnd));
     }
@@ -171,13 +188,14 @@ struct TrackStateCreator {
       }
 
       ACTS_VERBOSE("Create temp track state with mask: " << mask);
-      // Temporary and final track states are created in the same
-      // trajectory, which could lead to very large containers.
+      // Without a candidate trajectory temporary and final track states are
+      // created in the same trajectory, which could lead to very large
+      // containers.
 
       // CAREFUL! This trackstate has a previous index that is not in this
       // MultiTrajectory Visiting backwards from this track state will
       // fail!
-      auto ts = trajectory.makeTrackState(mask, prevTip);
+      auto ts = candidates.makeTrackState(mask, prevTip);
 
       if (it == slBegin) {
         // only set these for first
@@ -0,0 +1,215 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Utilities/Interpolation.hpp"
+#include "Acts/Utilities/detail/grid_helper.hpp"
+#include "Acts/Utilities/detail/interpolation_impl.hpp"
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+namespace Acts {
+
+/// @brief Read-only grid on top of externally owned bin values
+///
+/// This is the counterpart of @ref Acts::Grid for bin values which are not
+/// owned by the grid itself, e.g. values in a read-only memory mapping of a
+/// file which is shared between processes. The values are expected in the
+/// same global bin order as in @ref Acts::Grid, including the under- and
+/// overflow bins along every axis, so that both grids can be used
+/// interchangeably, e.g. for an @ref Acts::InterpolatedBFieldMap.
+///
+/// The grid keeps the owner of the values alive, copies of the grid share
+/// the same values.
+///
+/// @tparam T     type of values stored inside the bins of the grid
+/// @tparam Axes  parameter pack of axis types defining the grid
+template <typename T, class... Axes>
+class MappedGrid final {
+ public:
+  /// number of dimensions of the grid
+  static constexpr std::size_t DIM = sizeof...(Axes);
+
+  /// type of values stored
+  using value_type = T;
+  /// constant reference type to values stored
+  using const_reference = const value_type&;
+  /// type for points in d-dimensional grid space
+  using point_t = std::array<double, DIM>;
+  /// index type using local bin indices along each axis
+  using index_t = std::array<std::size_t, DIM>;
+
+  /// @brief Constructor from axes and externally owned values
+  ///
+  /// @param axes The axes of the grid
+  /// @param values The values of all bins including under- and overflow bins
+  /// @param owner Object owning the memory of @p values
+  MappedGrid(std::tuple<Axes...> axes, std::span<const T> values,
+             std::shared_ptr<const void> owner)
+      : m_axes(std::move(axes)),
+        m_values(values),
+        m_owner(std::move(owner)) {
+    if (m_values.size() != size()) {
+      throw std::invalid_argument(
+          "MappedGrid: number of values does not match the axes");
+    }
+  }
+
+  /// @brief access value stored in bin with given global bin number
+  ///
+  /// @param  [in] bin global bin number
+  /// @return const-reference to value stored in bin with given global bin
+  ///         number
+  const_reference at(std::size_t bin) const { return m_values[bin]; }
+
+  /// @brief access value stored in bin with given local bin numbers
+  ///
+  /// @param  [in] localBins local bin indices along each axis
+  /// @return const-reference to value stored in bin containing the given point
+  const_reference atLocalBins(const index_t& localBins) const {
+    return m_values[globalBinFromLocalBins(localBins)];
+  }
+
+  /// @brief get global bin indices for closest points on grid
+  ///
+  /// @param [in] position point of interest
+  /// @return Iterable that emits the indices of bins whose lower-left corners
+  ///         are the closest points on the grid to the input.
+  template <class Point>
+  detail::GlobalNeighborHoodIndices<DIM> closestPointsIndices(
+      const Point& position) const {
+    return detail::grid_helper::closestPointsIndices(
+        localBinsFromPosition(position), m_axes);
+  }
+
+  /// @brief determine global index for bin containing the given point
+  ///
+  /// @param  [in] point point to look up in the grid
+  /// @return global index for bin containing the given point
+  template <class Point>
+  std::size_t globalBinFromPosition(const Point& point) const {
+    return globalBinFromLocalBins(localBinsFromPosition(point));
+  }
+
+  /// @brief determine global bin index from local bin indices along each axis
+  ///
+  /// @param  [in] localBins local bin indices along each axis
+  /// @return global index for bin defined by the local bin indices
+  std::size_t globalBinFromLocalBins(const index_t& localBins) const {
+    return detail::grid_helper::getGlobalBin(localBins, m_axes);
+  }
+
+  /// @brief  determine local bin index for each axis from the given point
+  ///
+  /// @param  [in] point point to look up in the grid
+  /// @return array with local bin indices along each axis
+  template <class Point>
+  index_t localBinsFromPosition(const Point& point) const {
+    return detail::grid_helper::getLocalBinIndices(point, m_axes);
+  }
+
+  /// @brief retrieve lower-left bin edge from set of local bin indices
+  ///
+  /// @param  [in] localBins local bin indices along each axis
+  /// @return generalized lower-left bin edge position
+  point_t lowerLeftBinEdge(const index_t& localBins) const {
+    return detail::grid_helper::getLowerLeftBinEdge(localBins, m_axes);
+  }
+
+  /// @brief retrieve upper-right bin edge from set of local bin indices
+  ///
+  /// @param  [in] localBins local bin indices along each axis
+  /// @return generalized upper-right bin edge position
+  point_t upperRightBinEdge(const index_t& localBins) const {
+    return detail::grid_helper::getUpperRightBinEdge(localBins, m_axes);
+  }
+
+  /// @brief get number of bins along each specific axis
+  ///
+  /// @return array giving the number of bins along all axes
+  ///
+  /// @note Not including under- and overflow bins
+  index_t numLocalBins() const { return detail::grid_helper::getNBins(m_axes); }
+
+  /// @brief get the minimum value of all axes of one grid
+  ///
+  /// @return array returning the minima of all given axes
+  point_t minPosition() const { return detail::grid_helper::getMin(m_axes); }
+
+  /// @brief get the maximum value of all axes of one grid
+  ///
+  /// @return array returning the maxima of all given axes
+  point_t maxPosition() const { return detail::grid_helper::getMax(m_axes); }
+
+  /// @brief interpolate grid values to given position
+  ///
+  /// @param [in] point location to which to interpolate grid values. The
+  ///                   position must be within the grid dimensions and not
+  ///                   lie in an under-/overflow bin along any axis.
+  /// @return interpolated value at given position
+  ///
+  /// @note Bin values are interpreted as being the field values at the
+  /// lower-left corner of the corresponding hyper-box.
+  template <class Point>
+  T interpolate(const Point& point) const
+    requires(Concepts::interpolatable<T, Point, std::array<double, DIM>,
+                                      std::array<double, DIM>>)
+  {
+    constexpr std::size_t nCorners = 1 << DIM;
+    std::array<value_type, nCorners> neighbors{};
+
+    const auto& llIndices = localBinsFromPosition(point);
+    std::size_t i = 0;
+    for (std::size_t index :
+         detail::grid_helper::closestPointsIndices(llIndices, m_axes)) {
+      neighbors.at(i++) = at(index);
+    }
+
+    return Acts::interpolate(point, lowerLeftBinEdge(llIndices),
+                             upperRightBinEdge(llIndices), neighbors);
+  }
+
+  /// @brief check whether given point is inside grid limits
+  ///
+  /// @param position Point to check for inclusion within grid boundaries
+  /// @return @c true if the point is inside the grid limits along all axes
+  template <class Point>
+  bool isInside(const Point& position) const {
+    return detail::grid_helper::isInside(position, m_axes);
+  }
+
+  /// @brief total number of bins
+  ///
+  /// @return total number of bins in the grid including under- and overflow
+  ///         bins
+  std::size_t size() const {
+    std::size_t result = 1;
+    for (std::size_t n : numLocalBins()) {
+      result *= n + 2;
+    }
+    return result;
+  }
+
+  /// @brief get the axes of the grid
+  /// @return the axes tuple
+  const std::tuple<Axes...>& axesTuple() const { return m_axes; }
+
+ private:
+  std::tuple<Axes...> m_axes;
+  std::span<const T> m_values;
+  std::shared_ptr<const void> m_owner;
+};
+
+}  // namespace Acts
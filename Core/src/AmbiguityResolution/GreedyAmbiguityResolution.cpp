@@ -9,21 +9,118 @@
 #include "Acts/AmbiguityResolution/GreedyAmbiguityResolution.hpp"
 
 #include <algorithm>
+#include <cassert>
+#include <limits>
+#include <utility>
 
 namespace Acts {
 
 namespace {
 
+/// Binary heap of track indices which keeps track of the position of every
+/// track, so the priority of a track can be updated after it changed.
+///
+/// @tparam compare_t Returns true if the first track has to be on top of the
+///                   second one
+template <typename compare_t>
+class IndexedTrackHeap {
+ public:
+  IndexedTrackHeap(std::size_t numberOfTracks, compare_t compare)
+      : m_position(numberOfTracks, kInvalid), m_compare(std::move(compare)) {}
+
+  bool empty() const { return m_heap.empty(); }
+
+  std::size_t top() const {
+    assert(!empty());
+    return m_heap.front();
+  }
+
+  void push(std::size_t iTrack) {
+    m_position[iTrack] = m_heap.size();
+    m_heap.push_back(iTrack);
+    siftUp(m_heap.size() - 1);
+  }
+
+  void erase(std::size_t iTrack) {
+    std::size_t pos = m_position[iTrack];
+    assert(pos != kInvalid);
+    std::size_t last = m_heap.size() - 1;
+    if (pos != last) {
+      swapNodes(pos, last);
+    }
+    m_heap.pop_back();
+    m_position[iTrack] = kInvalid;
+    if (pos < m_heap.size()) {
+      siftUp(pos);
+      siftDown(pos);
+    }
+  }
+
+  /// Restores the heap order after the priority of a track changed
+  void update(std::size_t iTrack) {
+    std::size_t pos = m_position[iTrack];
+    if (pos == kInvalid) {
+      return;
+    }
+    siftUp(pos);
+    siftDown(pos);
+  }
+
+ private:
+  static constexpr std::size_t kInvalid =
+      std::numeric_limits<std::size_t>::max();
+
+  void swapNodes(std::size_t a, std::size_t b) {
+    std::swap(m_heap[a], m_heap[b]);
+    m_position[m_heap[a]] = a;
+    m_position[m_heap[b]] = b;
+  }
+
+  void siftUp(std::size_t pos) {
+    while (pos > 0) {
+      std::size_t parent = (pos - 1) / 2;
+      if (!m_compare(m_heap[pos], m_heap[parent])) {
+        break;
+      }
+      swapNodes(pos, parent);
+      pos = parent;
+    }
+  }
+
+  void siftDown(std::size_t pos) {
+    while (true) {
+      std::size_t best = pos;
+      for (std::size_t child : {2 * pos + 1, 2 * pos + 2}) {
+        if (child < m_heap.size() && m_compare(m_heap[child], m_heap[best])) {
+          best = child;
+        }
+      }
+      if (best == pos) {
+        break;
+      }
+      swapNodes(pos, best);
+      pos = best;
+    }
+  }
+
+  std::vector<std::size_t> m_heap;
+  std::vector<std::size_t> m_position;
+  compare_t m_compare;
+};
+
 /// Removes a track from the state which has to be done for multiple properties
-/// because of redundancy.
-static void removeTrack(GreedyAmbiguityResolution::State& state,
-                        std::size_t iTrack) {
+/// because of redundancy. The callback is invoked for every track which lost a
+/// shared measurement.
+template <typename callback_t>
+void removeTrack(GreedyAmbiguityResolution::State& state, std::size_t iTrack,
+                 callback_t&& onSharedMeasurementRemoved) {
   for (auto iMeasurement : state.measurementsPerTrack[iTrack]) {
     state.tracksPerMeasurement[iMeasurement].erase(iTrack);
 
     if (state.tracksPerMeasurement[iMeasurement].size() == 1) {
       auto jTrack = *state.tracksPerMeasurement[iMeasurement].begin();
       --state.sharedMeasurementsPerTrack[jTrack];
+      onSharedMeasurementRemoved(jTrack);
     }
   }
 
@@ -32,14 +129,30 @@ static void removeTrack(GreedyAmbiguityResolution::State& state,
 
 }  // namespace
 
-void GreedyAmbiguityResolution::resolve(State& state) const {
-  /// Compares two tracks based on the number of shared measurements in order to
-  /// decide if we already met the final state.
-  auto sharedMeasurementsComperator = [&state](std::size_t a, std::size_t b) {
-    return state.sharedMeasurementsPerTrack[a] <
-           state.sharedMeasurementsPerTrack[b];
-  };
+void GreedyAmbiguityResolution::computeSharedMeasurements(State& state) const {
+  // Now we relate measurements to tracks
+  for (std::size_t iTrack = 0; iTrack < state.numberOfTracks; ++iTrack) {
+    for (auto iMeasurement : state.measurementsPerTrack[iTrack]) {
+      if (iMeasurement >= state.tracksPerMeasurement.size()) {
+        state.tracksPerMeasurement.resize(iMeasurement + 1);
+      }
+      state.tracksPerMeasurement[iMeasurement].insert(iTrack);
+    }
+  }
 
+  // Finally, we can accumulate the number of shared measurements per track
+  state.sharedMeasurementsPerTrack =
+      std::vector<std::size_t>(state.trackTips.size(), 0);
+  for (std::size_t iTrack = 0; iTrack < state.numberOfTracks; ++iTrack) {
+    for (auto iMeasurement : state.measurementsPerTrack[iTrack]) {
+      if (state.tracksPerMeasurement[iMeasurement].size() > 1) {
+        ++state.sharedMeasurementsPerTrack[iTrack];
+      }
+    }
+  }
+}
+
+void GreedyAmbiguityResolution::resolve(State& state) const {
   /// Compares two tracks in order to find the one which should be evicted.
   /// First we compare the relative amount of shared measurements. If that is
   /// indecisive we use the chi2.
@@ -68,34 +181,63 @@ void GreedyAmbiguityResolution::resolve(State& state) const {
            state.measurementsPerTrack[b].size();
   };
 
+  /// Puts the "worst" track on top of the heap. Equivalent tracks are ordered
+  /// by their index to keep the result independent of the heap layout.
+  auto evictBefore = [&trackComperator](std::size_t a, std::size_t b) {
+    if (trackComperator(b, a)) {
+      return true;
+    }
+    return !trackComperator(a, b) && a < b;
+  };
+
+  IndexedTrackHeap heap(state.numberOfTracks, evictBefore);
+
+  // Number of selected tracks which exceed the shared measurement criteria,
+  // we are done once there is none left.
+  std::size_t nAmbiguousTracks = 0;
+  for (std::size_t iTrack : state.selectedTracks) {
+    heap.push(iTrack);
+    if (state.sharedMeasurementsPerTrack[iTrack] >= m_cfg.maximumSharedHits) {
+      ++nAmbiguousTracks;
+    }
+  }
+
   for (std::size_t i = 0; i < m_cfg.maximumIterations; ++i) {
     // Lazy out if there is nothing to filter on.
-    if (state.selectedTracks.empty()) {
+    if (heap.empty()) {
       ACTS_VERBOSE("no tracks left - exit loop");
       break;
     }
 
-    // Find the maximum amount of shared measurements per track to decide if we
-    // are done or not.
-    auto maximumSharedMeasurements = *std::ranges::max_element(
-        state.selectedTracks, sharedMeasurementsComperator);
-    ACTS_VERBOSE(
-        "maximum shared measurements "
-        << state.sharedMeasurementsPerTrack[maximumSharedMeasurements]);
-    if (state.sharedMeasurementsPerTrack[maximumSharedMeasurements] <
-        m_cfg.maximumSharedHits) {
+    ACTS_VERBOSE("tracks with at least " << m_cfg.maximumSharedHits
+                                         << " shared measurements "
+                                         << nAmbiguousTracks);
+    if (nAmbiguousTracks == 0) {
       break;
     }
 
-    // Find the "worst" track by comparing them to each other
-    auto badTrack =
-        *std::ranges::max_element(state.selectedTracks, trackComperator);
+    // The "worst" track is on top of the heap
+    auto badTrack = heap.top();
     ACTS_VERBOSE("remove track "
                  << badTrack << " nMeas "
                  << state.measurementsPerTrack[badTrack].size() << " nShared "
                  << state.sharedMeasurementsPerTrack[badTrack] << " chi2 "
                  << state.trackChi2[badTrack]);
-    removeTrack(state, badTrack);
+
+    heap.erase(badTrack);
+    if (state.sharedMeasurementsPerTrack[badTrack] >=
+        m_cfg.maximumSharedHits) {
+      --nAmbiguousTracks;
+    }
+
+    // Only tracks sharing a measurement with the removed track change
+    removeTrack(state, badTrack, [&](std::size_t jTrack) {
+      if (state.sharedMeasurementsPerTrack[jTrack] + 1 ==
+          m_cfg.maximumSharedHits) {
+        --nAmbiguousTracks;
+      }
+      heap.update(jTrack);
+    });
   }
 }
 
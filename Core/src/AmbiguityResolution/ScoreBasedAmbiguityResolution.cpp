@@ -8,9 +8,40 @@
 
 #include "Acts/AmbiguityResolution/ScoreBasedAmbiguityResolution.hpp"
 
-bool Acts::ScoreBasedAmbiguityResolution::etaBasedCuts(
-    const DetectorConfig& detector, const TrackFeatures& trackFeatures,
-    const double& eta) const {
+#include <algorithm>
+
+void Acts::ScoreBasedAmbiguityResolution::TrackFeatureTable::reset(
+    std::size_t nTracks_, std::size_t nDetectors_) {
+  nTracks = nTracks_;
+  nDetectors = nDetectors_;
+
+  const std::size_t nCounts = nTracks * nDetectors;
+  nHits.assign(nCounts, 0);
+  nHoles.assign(nCounts, 0);
+  nOutliers.assign(nCounts, 0);
+  nSharedHits.assign(nCounts, 0);
+
+  eta.assign(nTracks, 0);
+  pT.assign(nTracks, 0);
+  chi2.assign(nTracks, 0);
+  nDoF.assign(nTracks, 0);
+}
+
+Acts::ScoreBasedAmbiguityResolution::TrackFeatures
+Acts::ScoreBasedAmbiguityResolution::TrackFeatureTable::features(
+    std::size_t iTrack, std::size_t iDetector) const {
+  const std::size_t i = index(iTrack, iDetector);
+  TrackFeatures result;
+  result.nHits = nHits[i];
+  result.nHoles = nHoles[i];
+  result.nOutliers = nOutliers[i];
+  result.nSharedHits = nSharedHits[i];
+  return result;
+}
+
+bool Acts::ScoreBasedAmbiguityResolution::rejectedByEtaCuts(
+    const DetectorConfig& detector, double eta, std::size_t nHits,
+    std::size_t nHoles, std::size_t nOutliers, std::size_t nSharedHits) {
   const auto& etaBins = detector.etaBins;
 
   auto it = std::ranges::upper_bound(etaBins, eta);
@@ -18,8 +49,93 @@ bool Acts::ScoreBasedAmbiguityResolution::etaBasedCuts(
     return false;  // eta out of range
   }
   std::size_t etaBin = std::distance(etaBins.begin(), it) - 1;
-  return (trackFeatures.nHits < detector.minHitsPerEta[etaBin] ||
-          trackFeatures.nHoles > detector.maxHolesPerEta[etaBin] ||
-          trackFeatures.nOutliers > detector.maxOutliersPerEta[etaBin] ||
-          trackFeatures.nSharedHits > detector.maxSharedHitsPerEta[etaBin]);
+  return (nHits < detector.minHitsPerEta[etaBin] ||
+          nHoles > detector.maxHolesPerEta[etaBin] ||
+          nOutliers > detector.maxOutliersPerEta[etaBin] ||
+          nSharedHits > detector.maxSharedHitsPerEta[etaBin]);
+}
+
+bool Acts::ScoreBasedAmbiguityResolution::etaBasedCuts(
+    const DetectorConfig& detector, const TrackFeatures& trackFeatures,
+    const double& eta) const {
+  return rejectedByEtaCuts(detector, eta, trackFeatures.nHits,
+                           trackFeatures.nHoles, trackFeatures.nOutliers,
+                           trackFeatures.nSharedHits);
+}
+
+void Acts::ScoreBasedAmbiguityResolution::applyDetectorCuts(
+    const TrackFeatureTable& table, std::vector<std::uint8_t>& rejected) const {
+  for (std::size_t iDetector = 0; iDetector < table.nDetectors; ++iDetector) {
+    const auto& detector = m_cfg.detectorConfigs.at(iDetector);
+
+    const std::size_t offset = table.index(0, iDetector);
+    const std::uint32_t* nHits = table.nHits.data() + offset;
+    const std::uint32_t* nHoles = table.nHoles.data() + offset;
+    const std::uint32_t* nOutliers = table.nOutliers.data() + offset;
+    const std::uint32_t* nSharedHits = table.nSharedHits.data() + offset;
+
+    for (std::size_t iTrack = 0; iTrack < table.nTracks; ++iTrack) {
+      bool reject = rejectedByEtaCuts(detector, table.eta[iTrack],
+                                      nHits[iTrack], nHoles[iTrack],
+                                      nOutliers[iTrack], nSharedHits[iTrack]);
+      rejected[iTrack] |= static_cast<std::uint8_t>(reject);
+    }
+  }
+}
+
+void Acts::ScoreBasedAmbiguityResolution::addDetectorScores(
+    const TrackFeatureTable& table, std::vector<double>& scores) const {
+  for (std::size_t iDetector = 0; iDetector < table.nDetectors; ++iDetector) {
+    const auto& detector = m_cfg.detectorConfigs.at(iDetector);
+    const double hitsWeight = detector.hitsScoreWeight;
+    const double holesWeight = detector.holesScoreWeight;
+    const double outliersWeight = detector.outliersScoreWeight;
+    const double otherWeight = detector.otherScoreWeight;
+
+    const std::size_t offset = table.index(0, iDetector);
+    const std::uint32_t* nHits = table.nHits.data() + offset;
+    const std::uint32_t* nHoles = table.nHoles.data() + offset;
+    const std::uint32_t* nOutliers = table.nOutliers.data() + offset;
+    const std::uint32_t* nSharedHits = table.nSharedHits.data() + offset;
+
+    for (std::size_t iTrack = 0; iTrack < table.nTracks; ++iTrack) {
+      double& score = scores[iTrack];
+      score += nHits[iTrack] * hitsWeight;
+      score += nHoles[iTrack] * holesWeight;
+      score += nOutliers[iTrack] * outliersWeight;
+      score += nSharedHits[iTrack] * otherWeight;
+    }
+  }
+}
+
+void Acts::ScoreBasedAmbiguityResolution::applyDetectorFactors(
+    const TrackFeatureTable& table, const std::vector<std::uint8_t>& rejected,
+    std::vector<double>& scores) const {
+  for (std::size_t iDetector = 0; iDetector < table.nDetectors; ++iDetector) {
+    const auto& detector = m_cfg.detectorConfigs.at(iDetector);
+    const std::size_t offset = table.index(0, iDetector);
+
+    for (std::size_t iTrack = 0; iTrack < table.nTracks; ++iTrack) {
+      if (rejected[iTrack] != 0) {
+        continue;
+      }
+      double& score = scores[iTrack];
+
+      std::size_t nHits = table.nHits[offset + iTrack];
+      if (nHits > detector.maxHits) {
+        // hits are good !
+        score = score * static_cast<double>(nHits - detector.maxHits + 1);
+        nHits = detector.maxHits;
+      }
+      score = score * detector.factorHits[nHits];
+
+      std::size_t iHoles = table.nHoles[offset + iTrack];
+      if (iHoles > detector.maxHoles) {
+        // holes are bad !
+        score /= static_cast<double>(iHoles - detector.maxHoles + 1);
+        iHoles = detector.maxHoles;
+      }
+      score = score * detector.factorHoles[iHoles];
+    }
+  }
 }
@@ -12,9 +12,12 @@
 #include "Acts/EventData/TrackStatePropMask.hpp"
 #include "Acts/Utilities/Helpers.hpp"
 
+#include <algorithm>
 #include <format>
 #include <ostream>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 #include <boost/histogram.hpp>
 #include <boost/histogram/axis/category.hpp>
@@ -294,6 +297,159 @@ void VectorMultiTrajectory::reserve(std::size_t n) {
   }
 }
 
+namespace {
+
+using detail_vmt::kInvalid;
+
+/// Assign consecutive new indices to the marked entries of a pool
+TrackIndexType assignPoolIndices(std::vector<TrackIndexType>& poolMap) {
+  TrackIndexType n = 0;
+  for (TrackIndexType& entry : poolMap) {
+    if (entry != kInvalid) {
+      entry = n++;
+    }
+  }
+  return n;
+}
+
+/// Move the kept entries of a column to their new indices and shrink it
+template <typename column_t>
+void compactColumn(column_t& column,
+                   const std::vector<TrackIndexType>& indexMap,
+                   TrackIndexType newSize) {
+  for (std::size_t i = 0; i < indexMap.size(); ++i) {
+    if (indexMap[i] != kInvalid && indexMap[i] != i) {
+      column[indexMap[i]] = std::move(column[i]);
+    }
+  }
+  column.resize(newSize);
+}
+
+TrackIndexType remapIndex(const std::vector<TrackIndexType>& indexMap,
+                          TrackIndexType i) {
+  return i < indexMap.size() ? indexMap[i] : kInvalid;
+}
+
+}  // namespace
+
+auto VectorMultiTrajectory::compact(std::span<const IndexType> tips)
+    -> std::vector<IndexType> {
+  const std::size_t nStates = m_index.size();
+
+  // Mark all track states which are reachable from the tips. Track states are
+  // shared between branches, so the walk stops at the first marked state.
+  std::vector<IndexType> stateMap(nStates, kInvalid);
+  for (IndexType tip : tips) {
+    for (IndexType i = tip; i != kInvalid && i < nStates &&
+                            stateMap[i] == kInvalid;
+         i = m_previous[i]) {
+      stateMap[i] = 0;
+    }
+  }
+  const IndexType nKept = assignPoolIndices(stateMap);
+
+  // Mark the pool entries which are used by the kept track states
+  std::vector<IndexType> paramsMap(m_params.size(), kInvalid);
+  std::vector<IndexType> jacMap(m_jac.size(), kInvalid);
+  std::vector<IndexType> sourceLinkMap(m_sourceLinks.size(), kInvalid);
+  std::vector<IndexType> projectorMap(m_projectors.size(), kInvalid);
+  auto mark = [](std::vector<IndexType>& poolMap, IndexType i) {
+    if (i != kInvalid) {
+      poolMap[i] = 0;
+    }
+  };
+  // Calibrated measurements are not shared, collect their blocks by offset
+  std::vector<std::pair<IndexType, IndexType>> measBlocks;
+  for (IndexType i = 0; i < nStates; ++i) {
+    if (stateMap[i] == kInvalid) {
+      continue;
+    }
+    const IndexData& data = m_index[i];
+    mark(paramsMap, data.ipredicted);
+    mark(paramsMap, data.ifiltered);
+    mark(paramsMap, data.ismoothed);
+    mark(jacMap, data.ijacobian);
+    mark(sourceLinkMap, data.iUncalibrated);
+    mark(sourceLinkMap, data.iCalibratedSourceLink);
+    mark(projectorMap, data.iprojector);
+    if (m_measOffset[i] != kInvalid && m_measCovOffset[i] != kInvalid) {
+      measBlocks.emplace_back(m_measOffset[i], i);
+    }
+  }
+
+  const IndexType nParams = assignPoolIndices(paramsMap);
+  compactColumn(m_params, paramsMap, nParams);
+  compactColumn(m_cov, paramsMap, nParams);
+  compactColumn(m_jac, jacMap, assignPoolIndices(jacMap));
+  compactColumn(m_sourceLinks, sourceLinkMap,
+                assignPoolIndices(sourceLinkMap));
+  compactColumn(m_projectors, projectorMap, assignPoolIndices(projectorMap));
+
+  // Move the measurement blocks down in the order of their offsets, so that
+  // no block is overwritten before it is moved
+  std::ranges::sort(measBlocks);
+  std::size_t measSize = 0;
+  for (const auto& [offset, i] : measBlocks) {
+    const std::size_t dim = m_index[i].measdim;
+    std::copy_n(m_meas.begin() + offset, dim, m_meas.begin() + measSize);
+    m_measOffset[i] = static_cast<IndexType>(measSize);
+    measSize += dim;
+  }
+  m_meas.resize(measSize);
+  std::ranges::sort(measBlocks, {}, [this](const auto& block) {
+    return m_measCovOffset[block.second];
+  });
+  std::size_t measCovSize = 0;
+  for (const auto& block : measBlocks) {
+    const IndexType i = block.second;
+    const std::size_t dim = m_index[i].measdim;
+    std::copy_n(m_measCov.begin() + m_measCovOffset[i], dim * dim,
+                m_measCov.begin() + measCovSize);
+    m_measCovOffset[i] = static_cast<IndexType>(measCovSize);
+    measCovSize += dim * dim;
+  }
+  m_measCov.resize(measCovSize);
+
+  // Remap the indices of the kept track states and move them down
+  for (IndexType i = 0; i < nStates; ++i) {
+    if (stateMap[i] == kInvalid) {
+      continue;
+    }
+    IndexData& data = m_index[i];
+    data.ipredicted = remapIndex(paramsMap, data.ipredicted);
+    data.ifiltered = remapIndex(paramsMap, data.ifiltered);
+    data.ismoothed = remapIndex(paramsMap, data.ismoothed);
+    data.ijacobian = remapIndex(jacMap, data.ijacobian);
+    data.iUncalibrated = remapIndex(sourceLinkMap, data.iUncalibrated);
+    data.iCalibratedSourceLink =
+        remapIndex(sourceLinkMap, data.iCalibratedSourceLink);
+    data.iprojector = remapIndex(projectorMap, data.iprojector);
+
+    // The previous index of a candidate track state may point outside of
+    // this container, the next track state may have been removed
+    m_previous[i] = remapIndex(stateMap, m_previous[i]);
+    m_next[i] = remapIndex(stateMap, m_next[i]);
+  }
+
+  compactColumn(m_index, stateMap, nKept);
+  compactColumn(m_previous, stateMap, nKept);
+  compactColumn(m_next, stateMap, nKept);
+  compactColumn(m_measOffset, stateMap, nKept);
+  compactColumn(m_measCovOffset, stateMap, nKept);
+  compactColumn(m_referenceSurfaces, stateMap, nKept);
+
+  for (const auto& [key, column] : m_dynamic) {
+    for (IndexType i = 0; i < nStates; ++i) {
+      if (stateMap[i] != kInvalid && stateMap[i] != i) {
+        column->copyFrom(stateMap[i], *column, i);
+      }
+    }
+    column->resize(nKept);
+  }
+
+  return stateMap;
+}
+
 void VectorMultiTrajectory::copyDynamicFrom_impl(IndexType dstIdx,
                                                  HashedString key,
                                                  const std::any& srcPtr) {
@@ -17,7 +17,9 @@
 #include "Acts/Material/ProtoVolumeMaterial.hpp"
 #include "Acts/Surfaces/Surface.hpp"
 
+#include <algorithm>
 #include <cstddef>
+#include <functional>
 
 namespace Acts {
 
@@ -222,6 +224,23 @@ TrackingGeometry::TrackingGeometry(
 
   m_volumesById.rehash(0);
   m_surfacesById.rehash(0);
+
+  // Assign a dense index to the sensitive surfaces, ordered by identifier so
+  // the index is reproducible independent of the hash map iteration order
+  for (const auto& [id, surface] : m_surfacesById) {
+    if (id.sensitive() != 0) {
+      m_sensitiveSurfaces.push_back(surface);
+    }
+  }
+  std::ranges::sort(m_sensitiveSurfaces, std::less{},
+                    [](const Surface* s) { return s->geometryId(); });
+  m_sensitiveIndexById.reserve(m_sensitiveSurfaces.size());
+  for (std::size_t i = 0; i < m_sensitiveSurfaces.size(); ++i) {
+    m_sensitiveIndexById.emplace(m_sensitiveSurfaces[i]->geometryId(), i);
+  }
+
+  ACTS_DEBUG("Indexed " << m_sensitiveSurfaces.size()
+                        << " sensitive surfaces");
 }
 
 TrackingGeometry::~TrackingGeometry() = default;
@@ -275,6 +294,31 @@ TrackingGeometry::geoIdSurfaceMap() const {
   return m_surfacesById;
 }
 
+std::size_t TrackingGeometry::numSensitiveSurfaces() const {
+  return m_sensitiveSurfaces.size();
+}
+
+const Surface* TrackingGeometry::surfaceByIndex(std::size_t index) const {
+  if (index >= m_sensitiveSurfaces.size()) {
+    return nullptr;
+  }
+  return m_sensitiveSurfaces[index];
+}
+
+std::optional<std::size_t> TrackingGeometry::indexOf(
+    GeometryIdentifier id) const {
+  auto it = m_sensitiveIndexById.find(id);
+  if (it == m_sensitiveIndexById.end()) {
+    return std::nullopt;
+  }
+  return it->second;
+}
+
+const std::vector<const Surface*>& TrackingGeometry::sensitiveSurfaces()
+    const {
+  return m_sensitiveSurfaces;
+}
+
 void TrackingGeometry::visualize(IVisualization3D& helper,
                                  const GeometryContext& gctx,
                                  const ViewConfig& viewConfig,
@@ -27,9 +27,12 @@ namespace Acts {
 using VectorHelpers::perp;
 using VectorHelpers::phi;
 
-InterpolatedBFieldMap<
-    Grid<Vector2, Axis<AxisType::Equidistant>, Axis<AxisType::Equidistant>>>
-fieldMapRZ(const std::function<std::size_t(std::array<std::size_t, 2> binsRZ,
+template <BuiltinBFieldMapStorage storage_t>
+InterpolatedBFieldMap<Grid<typename storage_t::template value_type<2>,
+                           Axis<AxisType::Equidistant>,
+                           Axis<AxisType::Equidistant>>>
+fieldMapRZ(const storage_t& storage,
+           const std::function<std::size_t(std::array<std::size_t, 2> binsRZ,
                                            std::array<std::size_t, 2> nBinsRZ)>&
                localToGlobalBin,
            std::vector<double> rPos, std::vector<double> zPos,
@@ -52,14 +55,15 @@ fieldMapRZ(const std::function<std::size_t(std::array<std::size_t, 2> binsRZ,
   Axis zAxis(zMin * lengthUnit, zMax * lengthUnit, nBinsZ);
 
   // Create the grid
-  Grid grid(Type<Vector2>, std::move(rAxis), std::move(zAxis));
+  Grid grid(Type<typename storage_t::template value_type<2>>, std::move(rAxis),
+            std::move(zAxis));
   using Grid_t = decltype(grid);
 
   // [2] Set the bField values
   const std::array<std::size_t, 2> nIndices = {{rBinCount, zBinCount}};
   for (std::size_t i = 1; i <= nBinsR; ++i) {
     for (std::size_t j = 1; j <= nBinsZ; ++j) {
-      Grid_t::index_t indices = {{i, j}};
+      typename Grid_t::index_t indices = {{i, j}};
       // std::vectors begin with 0 and we do not want the user needing to take
       // underflow or overflow bins in account this is why we need to subtract
       // by one
@@ -67,16 +71,16 @@ fieldMapRZ(const std::function<std::size_t(std::array<std::size_t, 2> binsRZ,
         std::size_t n = std::abs(static_cast<std::ptrdiff_t>(j) -
                                  static_cast<std::ptrdiff_t>(zBinCount));
 
-        grid.atLocalBins(indices) =
-            bField.at(localToGlobalBin({{i - 1, n}}, nIndices)) * BFieldUnit;
+        grid.atLocalBins(indices) = storage.encode(Vector2(
+            bField.at(localToGlobalBin({{i - 1, n}}, nIndices)) * BFieldUnit));
       } else {
-        grid.atLocalBins(indices) =
+        grid.atLocalBins(indices) = storage.encode(Vector2(
             bField.at(localToGlobalBin({{i - 1, j - 1}}, nIndices)) *
-            BFieldUnit;
+            BFieldUnit));
       }
     }
   }
-  grid.setExteriorBins(Vector2::Zero());
+  grid.setExteriorBins(storage.encode(Vector2(Vector2::Zero())));
 
   // [3] Create the transformation for the position map (x,y,z) -> (r,z)
   auto transformPos = [](const Vector3& pos) {
@@ -84,7 +88,9 @@ fieldMapRZ(const std::function<std::size_t(std::array<std::size_t, 2> binsRZ,
   };
 
   // [4] Create the transformation for the bField map (Br,Bz) -> (Bx,By,Bz)
-  auto transformBField = [](const Vector2& field, const Vector3& pos) {
+  auto transformBField = [storage](const typename Grid_t::value_type& value,
+                                   const Vector3& pos) {
+    const Vector2 field = storage.decode(value);
     const double rSinTheta2 = pos.x() * pos.x() + pos.y() * pos.y();
     double cosPhi = 1.;
     double sinPhi = 0.;
@@ -103,10 +109,13 @@ fieldMapRZ(const std::function<std::size_t(std::array<std::size_t, 2> binsRZ,
       {transformPos, transformBField, std::move(grid)});
 }
 
-InterpolatedBFieldMap<
-    Grid<Vector3, Axis<AxisType::Equidistant>, Axis<AxisType::Equidistant>,
-         Axis<AxisType::Equidistant>>>
+template <BuiltinBFieldMapStorage storage_t>
+InterpolatedBFieldMap<Grid<typename storage_t::template value_type<3>,
+                           Axis<AxisType::Equidistant>,
+                           Axis<AxisType::Equidistant>,
+                           Axis<AxisType::Equidistant>>>
 fieldMapXYZ(
+    const storage_t& storage,
     const std::function<std::size_t(std::array<std::size_t, 3> binsXYZ,
                                     std::array<std::size_t, 3> nBinsXYZ)>&
         localToGlobalBin,
@@ -135,8 +144,8 @@ fieldMapXYZ(
   Axis yAxis(yMin * lengthUnit, yMax * lengthUnit, nBinsY);
   Axis zAxis(zMin * lengthUnit, zMax * lengthUnit, nBinsZ);
   // Create the grid
-  Grid grid(Type<Vector3>, std::move(xAxis), std::move(yAxis),
-            std::move(zAxis));
+  Grid grid(Type<typename storage_t::template value_type<3>>, std::move(xAxis),
+            std::move(yAxis), std::move(zAxis));
   using Grid_t = decltype(grid);
 
   // [2] Set the bField values
@@ -151,7 +160,7 @@ fieldMapXYZ(
   for (std::size_t i = 1; i <= nBinsX; ++i) {
     for (std::size_t j = 1; j <= nBinsY; ++j) {
       for (std::size_t k = 1; k <= nBinsZ; ++k) {
-        Grid_t::index_t indices = {{i, j, k}};
+        typename Grid_t::index_t indices = {{i, j, k}};
         // std::vectors begin with 0 and we do not want the user needing to take
         // underflow or overflow bins in account this is why we need to subtract
         // by one
@@ -160,24 +169,25 @@ fieldMapXYZ(
           const std::size_t m = calcAbsDiff(j, yBinCount);
           const std::size_t n = calcAbsDiff(k, zBinCount);
 
-          grid.atLocalBins(indices) =
-              bField.at(localToGlobalBin({{l, m, n}}, nIndices)) * BFieldUnit;
+          grid.atLocalBins(indices) = storage.encode(Vector3(
+              bField.at(localToGlobalBin({{l, m, n}}, nIndices)) * BFieldUnit));
         } else {
-          grid.atLocalBins(indices) =
+          grid.atLocalBins(indices) = storage.encode(Vector3(
               bField.at(localToGlobalBin({{i - 1, j - 1, k - 1}}, nIndices)) *
-              BFieldUnit;
+              BFieldUnit));
         }
       }
     }
   }
-  grid.setExteriorBins(Vector3::Zero());
+  grid.setExteriorBins(storage.encode(Vector3(Vector3::Zero())));
 
   // [3] Create the transformation for the position map (x,y,z) -> (r,z)
   auto transformPos = [](const Vector3& pos) { return pos; };
 
   // [4] Create the transformation for the BField map (Bx,By,Bz) -> (Bx,By,Bz)
-  auto transformBField = [](const Vector3& field, const Vector3& /*pos*/) {
-    return field;
+  auto transformBField = [storage](const typename Grid_t::value_type& value,
+                                   const Vector3& /*pos*/) {
+    return Vector3(storage.decode(value));
   };
 
   // [5] Create the mapper & BField Service create field mapping
@@ -185,6 +195,59 @@ fieldMapXYZ(
       {transformPos, transformBField, std::move(grid)});
 }
 
+InterpolatedBFieldMap<
+    Grid<Vector2, Axis<AxisType::Equidistant>, Axis<AxisType::Equidistant>>>
+fieldMapRZ(const std::function<std::size_t(std::array<std::size_t, 2> binsRZ,
+                                           std::array<std::size_t, 2> nBinsRZ)>&
+               localToGlobalBin,
+           std::vector<double> rPos, std::vector<double> zPos,
+           const std::vector<Vector2>& bField, double lengthUnit,
+           double BFieldUnit, bool firstQuadrant) {
+  return fieldMapRZ(DoubleBFieldStorage{}, localToGlobalBin, std::move(rPos),
+                    std::move(zPos), bField, lengthUnit, BFieldUnit,
+                    firstQuadrant);
+}
+
+InterpolatedBFieldMap<
+    Grid<Vector3, Axis<AxisType::Equidistant>, Axis<AxisType::Equidistant>,
+         Axis<AxisType::Equidistant>>>
+fieldMapXYZ(
+    const std::function<std::size_t(std::array<std::size_t, 3> binsXYZ,
+                                    std::array<std::size_t, 3> nBinsXYZ)>&
+        localToGlobalBin,
+    std::vector<double> xPos, std::vector<double> yPos,
+    std::vector<double> zPos, const std::vector<Vector3>& bField,
+    double lengthUnit, double BFieldUnit, bool firstOctant) {
+  return fieldMapXYZ(DoubleBFieldStorage{}, localToGlobalBin, std::move(xPos),
+                     std::move(yPos), std::move(zPos), bField, lengthUnit,
+                     BFieldUnit, firstOctant);
+}
+
+#define ACTS_INSTANTIATE_FIELD_MAPS(storage_t)                                \
+  template InterpolatedBFieldMap<                                             \
+      Grid<typename storage_t::template value_type<2>,                        \
+           Axis<AxisType::Equidistant>, Axis<AxisType::Equidistant>>>         \
+  fieldMapRZ(const storage_t&,                                                \
+             const std::function<std::size_t(std::array<std::size_t, 2>,      \
+                                             std::array<std::size_t, 2>)>&,   \
+             std::vector<double>, std::vector<double>,                        \
+             const std::vector<Vector2>&, double, double, bool);              \
+  template InterpolatedBFieldMap<                                             \
+      Grid<typename storage_t::template value_type<3>,                        \
+           Axis<AxisType::Equidistant>, Axis<AxisType::Equidistant>,          \
+           Axis<AxisType::Equidistant>>>                                      \
+  fieldMapXYZ(const storage_t&,                                               \
+              const std::function<std::size_t(std::array<std::size_t, 3>,     \
+                                              std::array<std::size_t, 3>)>&,  \
+              std::vector<double>, std::vector<double>, std::vector<double>,  \
+              const std::vector<Vector3>&, double, double, bool)
+
+ACTS_INSTANTIATE_FIELD_MAPS(DoubleBFieldStorage);
+ACTS_INSTANTIATE_FIELD_MAPS(FloatBFieldStorage);
+ACTS_INSTANTIATE_FIELD_MAPS(Int16BFieldStorage);
+
+#undef ACTS_INSTANTIATE_FIELD_MAPS
+
 InterpolatedBFieldMap<
     Grid<Vector2, Axis<AxisType::Equidistant>, Axis<AxisType::Equidistant>>>
 solenoidFieldMap(const std::pair<double, double>& rLim,
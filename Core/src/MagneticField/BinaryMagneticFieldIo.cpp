@@ -0,0 +1,255 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Acts/MagneticField/BinaryMagneticFieldIo.hpp"
+
+#include "Acts/Utilities/VectorHelpers.hpp"
+
+#include <array>
+#include <cerrno>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+using namespace Acts;
+
+constexpr std::array<char, 8> kMagic = {'A', 'C', 'T', 'S',
+                                        'B', 'M', 'A', 'P'};
+constexpr std::uint32_t kByteOrderMarker = 0x01020304;
+
+enum class GridType : std::uint32_t { rz = 0, xyz = 1 };
+
+struct Header {
+  std::array<char, 8> magic = kMagic;
+  std::uint32_t version = s_binaryBFieldMapVersion;
+  std::uint32_t byteOrder = kByteOrderMarker;
+  GridType gridType = GridType::xyz;
+  /// number of axes of the grid
+  std::uint32_t nAxes = 0;
+  /// size of one stored field value in bytes
+  std::uint64_t valueSize = 0;
+  /// offset of the first field value from the start of the file
+  std::uint64_t dataOffset = s_binaryBFieldMapAlignment;
+  /// number of stored field values including under- and overflow bins
+  std::uint64_t nValues = 0;
+  std::array<std::uint64_t, 3> nBins{};
+  std::array<double, 3> min{};
+  std::array<double, 3> max{};
+};
+static_assert(std::is_trivially_copyable_v<Header>);
+static_assert(sizeof(Header) <= s_binaryBFieldMapAlignment);
+
+template <typename grid_t>
+void writeGrid(const grid_t& grid, GridType gridType,
+               const std::string& fieldMapFile) {
+  using value_t = typename grid_t::value_type;
+  constexpr std::size_t nAxes = grid_t::DIM;
+
+  Header header;
+  header.gridType = gridType;
+  header.nAxes = nAxes;
+  header.valueSize = sizeof(value_t);
+  header.nValues = grid.size();
+  const auto nBins = grid.numLocalBins();
+  const auto min = grid.minPosition();
+  const auto max = grid.maxPosition();
+  for (std::size_t i = 0; i < nAxes; ++i) {
+    header.nBins[i] = nBins[i];
+    header.min[i] = min[i];
+    header.max[i] = max[i];
+  }
+
+  // Write to a temporary file and rename it afterwards, so that concurrent
+  // readers either see the complete previous or the complete new file
+  const std::filesystem::path path(fieldMapFile);
+  std::filesystem::path tmpPath = path;
+  tmpPath += ".tmp" + std::to_string(::getpid());
+  {
+    std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+    if (!file) {
+      throw std::runtime_error("Could not open '" + tmpPath.string() +
+                               "' for writing");
+    }
+
+    std::vector<char> headerBlock(header.dataOffset, 0);
+    std::memcpy(headerBlock.data(), &header, sizeof(Header));
+    file.write(headerBlock.data(),
+               static_cast<std::streamsize>(headerBlock.size()));
+
+    for (std::size_t bin = 0; bin < grid.size(); ++bin) {
+      const value_t& value = grid.at(bin);
+      file.write(reinterpret_cast<const char*>(value.data()), sizeof(value_t));
+    }
+
+    if (!file) {
+      throw std::runtime_error("Could not write field map to '" +
+                               tmpPath.string() + "'");
+    }
+  }
+  std::filesystem::rename(tmpPath, path);
+}
+
+/// Read-only memory mapping of a file
+class FileMapping {
+ public:
+  explicit FileMapping(const std::string& fileName) {
+    const int fd = ::open(fileName.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+      throw std::runtime_error("Could not open '" + fileName +
+                               "': " + std::strerror(errno));
+    }
+    struct stat st{};
+    if (::fstat(fd, &st) != 0 || st.st_size <= 0) {
+      ::close(fd);
+      throw std::runtime_error("Could not determine the size of '" + fileName +
+                               "'");
+    }
+    m_size = static_cast<std::size_t>(st.st_size);
+    m_data = ::mmap(nullptr, m_size, PROT_READ, MAP_SHARED, fd, 0);
+    // the mapping stays valid after closing the file descriptor
+    ::close(fd);
+    if (m_data == MAP_FAILED) {
+      throw std::runtime_error("Could not map '" + fileName +
+                               "': " + std::strerror(errno));
+    }
+  }
+
+  FileMapping(const FileMapping&) = delete;
+  FileMapping& operator=(const FileMapping&) = delete;
+
+  ~FileMapping() { ::munmap(m_data, m_size); }
+
+  const char* data() const { return static_cast<const char*>(m_data); }
+  std::size_t size() const { return m_size; }
+
+ private:
+  void* m_data = nullptr;
+  std::size_t m_size = 0;
+};
+
+template <typename grid_t>
+grid_t readGrid(const std::string& fieldMapFile, GridType gridType) {
+  using value_t = typename grid_t::value_type;
+  constexpr std::size_t nAxes = grid_t::DIM;
+
+  auto mapping = std::make_shared<const FileMapping>(fieldMapFile);
+  const auto invalid = [&](const std::string& reason) {
+    return std::runtime_error("Invalid binary field map '" + fieldMapFile +
+                              "': " + reason);
+  };
+
+  Header header;
+  if (mapping->size() < sizeof(Header)) {
+    throw invalid("file too small");
+  }
+  std::memcpy(&header, mapping->data(), sizeof(Header));
+  if (header.magic != kMagic) {
+    throw invalid("not a binary field map");
+  }
+  if (header.byteOrder != kByteOrderMarker) {
+    throw invalid("unsupported byte order");
+  }
+  if (header.version != s_binaryBFieldMapVersion) {
+    throw invalid("unsupported version " + std::to_string(header.version));
+  }
+  if (header.gridType != gridType || header.nAxes != nAxes) {
+    throw invalid(gridType == GridType::rz ? "not an rz field map"
+                                           : "not an xyz field map");
+  }
+  if (header.valueSize != sizeof(value_t) ||
+      header.dataOffset % alignof(value_t) != 0 ||
+      header.dataOffset > mapping->size() ||
+      (mapping->size() - header.dataOffset) / sizeof(value_t) <
+          header.nValues) {
+    throw invalid("inconsistent field value block");
+  }
+
+  auto makeAxis = [&](std::size_t i) {
+    return Axis<AxisType::Equidistant>(
+        header.min[i], header.max[i],
+        static_cast<std::size_t>(header.nBins[i]));
+  };
+  auto axes = [&]() {
+    if constexpr (nAxes == 2) {
+      return std::tuple(makeAxis(0), makeAxis(1));
+    } else {
+      return std::tuple(makeAxis(0), makeAxis(1), makeAxis(2));
+    }
+  }();
+
+  std::span<const value_t> values(
+      reinterpret_cast<const value_t*>(mapping->data() + header.dataOffset),
+      static_cast<std::size_t>(header.nValues));
+  return grid_t(std::move(axes), values, std::move(mapping));
+}
+
+Vector2 transformPosRz(const Vector3& pos) {
+  return Vector2(VectorHelpers::perp(pos), pos.z());
+}
+
+Vector3 transformBFieldRz(const Vector2& field, const Vector3& pos) {
+  const double rSinTheta2 = pos.x() * pos.x() + pos.y() * pos.y();
+  double cosPhi = 1.;
+  double sinPhi = 0.;
+
+  if (rSinTheta2 > std::numeric_limits<double>::min()) {
+    const double invRsinTheta = 1. / std::sqrt(rSinTheta2);
+    cosPhi = pos.x() * invRsinTheta;
+    sinPhi = pos.y() * invRsinTheta;
+  }
+
+  return Vector3(field.x() * cosPhi, field.x() * sinPhi, field.y());
+}
+
+}  // namespace
+
+void Acts::writeMagneticFieldMapRzToBinary(
+    const InterpolatedBFieldMap<Grid<Vector2, Axis<AxisType::Equidistant>,
+                                     Axis<AxisType::Equidistant>>>& map,
+    const std::string& fieldMapFile) {
+  writeGrid(map.getGrid(), GridType::rz, fieldMapFile);
+}
+
+void Acts::writeMagneticFieldMapXyzToBinary(
+    const InterpolatedBFieldMap<
+        Grid<Vector3, Axis<AxisType::Equidistant>, Axis<AxisType::Equidistant>,
+             Axis<AxisType::Equidistant>>>& map,
+    const std::string& fieldMapFile) {
+  writeGrid(map.getGrid(), GridType::xyz, fieldMapFile);
+}
+
+Acts::MappedBFieldMapRz Acts::makeMagneticFieldMapRzFromBinary(
+    const std::string& fieldMapFile) {
+  using Grid_t = MappedBFieldMapRz::Grid;
+  return MappedBFieldMapRz(
+      {transformPosRz, transformBFieldRz,
+       readGrid<Grid_t>(fieldMapFile, GridType::rz)});
+}
+
+Acts::MappedBFieldMapXyz Acts::makeMagneticFieldMapXyzFromBinary(
+    const std::string& fieldMapFile) {
+  using Grid_t = MappedBFieldMapXyz::Grid;
+  return MappedBFieldMapXyz(
+      {[](const Vector3& pos) { return pos; },
+       [](const Vector3& field, const Vector3& /*pos*/) { return field; },
+       readGrid<Grid_t>(fieldMapFile, GridType::xyz)});
+}
@@ -10,6 +10,8 @@
 
 #include "Acts/MagneticField/MagneticFieldError.hpp"
 
+#include <cassert>
+
 namespace Acts {
 
 MultiRangeBField::Cache::Cache(const MagneticFieldContext& /*unused*/) {}
@@ -26,8 +28,8 @@ MagneticFieldProvider::Cache MultiRangeBField::makeCache(
   return MagneticFieldProvider::Cache(std::in_place_type<Cache>, mctx);
 }
 
-Result<Vector3> MultiRangeBField::getField(
-    const Vector3& position, MagneticFieldProvider::Cache& cache) const {
+std::optional<std::size_t> MultiRangeBField::findRange(
+    const Vector3& position, Cache& cache) const {
   // Because we assume that the regions are in increasing order of
   // precedence, we can iterate over the array, remembering the _last_
   // region that contained the given point. At the end of the loop, this
@@ -42,11 +44,10 @@ Result<Vector3> MultiRangeBField::getField(
   // can be relevant to the current access. Thus, we request the cache index
   // if it exists and perform a membership check on it; if that succeeds, we
   // remember the corresponding region as a candidate.
-  if (Cache& lCache = cache.as<Cache>();
-      lCache.index.has_value() &&
-      std::get<0>(fieldRanges[*lCache.index])
+  if (cache.index.has_value() &&
+      std::get<0>(fieldRanges[*cache.index])
           .contains({position[0], position[1], position[2]})) {
-    foundRange = *lCache.index;
+    foundRange = *cache.index;
   }
 
   // Now, we iterate over the ranges. If we already have a range candidate,
@@ -61,7 +62,14 @@ Result<Vector3> MultiRangeBField::getField(
   }
 
   // Update the cache using the result of this access.
-  cache.as<Cache>().index = foundRange;
+  cache.index = foundRange;
+  return foundRange;
+}
+
+Result<Vector3> MultiRangeBField::getField(
+    const Vector3& position, MagneticFieldProvider::Cache& cache) const {
+  std::optional<std::size_t> foundRange =
+      findRange(position, cache.as<Cache>());
 
   // If we found a valid range, return the corresponding vector; otherwise
   // return an out-of-bounds error.
@@ -72,4 +80,19 @@ Result<Vector3> MultiRangeBField::getField(
   }
 }
 
+Result<void> MultiRangeBField::getFieldBatch(
+    std::span<const Vector3> positions, std::span<Vector3> fields,
+    MagneticFieldProvider::Cache& cache) const {
+  assert(positions.size() == fields.size());
+  Cache& lCache = cache.as<Cache>();
+  for (std::size_t i = 0; i < positions.size(); ++i) {
+    std::optional<std::size_t> foundRange = findRange(positions[i], lCache);
+    if (!foundRange.has_value()) {
+      return Result<void>::failure(MagneticFieldError::OutOfBounds);
+    }
+    fields[i] = std::get<1>(fieldRanges[*foundRange]);
+  }
+  return Result<void>::success();
+}
+
 }  // namespace Acts
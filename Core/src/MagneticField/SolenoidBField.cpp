@@ -10,6 +10,7 @@
 
 #include "Acts/Utilities/VectorHelpers.hpp"
 
+#include <cassert>
 #include <cmath>
 #include <numbers>
 
@@ -55,6 +56,16 @@ Result<Vector3> SolenoidBField::getField(
   return Result<Vector3>::success(getField(position));
 }
 
+Result<void> SolenoidBField::getFieldBatch(
+    std::span<const Vector3> positions, std::span<Vector3> fields,
+    MagneticFieldProvider::Cache& /*cache*/) const {
+  assert(positions.size() == fields.size());
+  for (std::size_t i = 0; i < positions.size(); ++i) {
+    fields[i] = getField(positions[i]);
+  }
+  return Result<void>::success();
+}
+
 Vector2 SolenoidBField::getField(const Vector2& position) const {
   return multiCoilField(position, m_scale);
 }
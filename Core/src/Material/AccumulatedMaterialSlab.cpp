@@ -11,6 +11,16 @@
 #include "Acts/Material/Material.hpp"
 #include "Acts/Material/detail/AverageMaterials.hpp"
 
+Acts::AccumulatedMaterialSlab Acts::AccumulatedMaterialSlab::fromTotals(
+    const MaterialSlab& totalAverage, float totalVariance,
+    unsigned int totalCount) {
+  AccumulatedMaterialSlab accumulated;
+  accumulated.m_totalAverage = totalAverage;
+  accumulated.m_totalVariance = totalVariance;
+  accumulated.m_totalCount = totalCount;
+  return accumulated;
+}
+
 void Acts::AccumulatedMaterialSlab::accumulate(MaterialSlab slab,
                                                double pathCorrection) {
   // scale the recorded material to the equivalence contribution along the
@@ -58,6 +68,32 @@ void Acts::AccumulatedMaterialSlab::trackAverage(bool useEmptyTrack) {
   m_trackAverage = MaterialSlab();
 }
 
+void Acts::AccumulatedMaterialSlab::merge(
+    const AccumulatedMaterialSlab& other) {
+  if (other.m_totalCount == 0u) {
+    return;
+  }
+  if (m_totalCount == 0u) {
+    m_totalAverage = other.m_totalAverage;
+    m_totalVariance = other.m_totalVariance;
+    m_totalCount = other.m_totalCount;
+    return;
+  }
+
+  double totalCount = m_totalCount + static_cast<double>(other.m_totalCount);
+  double weightThis = m_totalCount / totalCount;
+  double weightOther = other.m_totalCount / totalCount;
+  // average such that each track contributes equally.
+  MaterialSlab fromThis(m_totalAverage.material(),
+                        weightThis * m_totalAverage.thickness());
+  MaterialSlab fromOther(other.m_totalAverage.material(),
+                         weightOther * other.m_totalAverage.thickness());
+  m_totalAverage = detail::combineSlabs(fromThis, fromOther);
+  m_totalVariance = static_cast<float>(weightThis * m_totalVariance +
+                                       weightOther * other.m_totalVariance);
+  m_totalCount += other.m_totalCount;
+}
+
 std::pair<Acts::MaterialSlab, unsigned int>
 Acts::AccumulatedMaterialSlab::totalAverage() const {
   return {m_totalAverage, m_totalCount};
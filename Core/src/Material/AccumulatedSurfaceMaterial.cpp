@@ -12,6 +12,7 @@
 #include "Acts/Material/HomogeneousSurfaceMaterial.hpp"
 #include "Acts/Utilities/ProtoAxisHelpers.hpp"
 
+#include <stdexcept>
 #include <utility>
 
 // Default Constructor - for homogeneous material
@@ -130,6 +131,34 @@ void Acts::AccumulatedSurfaceMaterial::trackAverage(
   }
 }
 
+// Merge the material accumulated from another set of tracks
+void Acts::AccumulatedSurfaceMaterial::merge(
+    const AccumulatedSurfaceMaterial& other) {
+  const AccumulatedMatrix& otherMaterial = other.m_accumulatedMaterial;
+  if (otherMaterial.size() != m_accumulatedMaterial.size()) {
+    throw std::invalid_argument(
+        "AccumulatedSurfaceMaterial: cannot merge material with different "
+        "binning");
+  }
+  for (std::size_t bin1 = 0; bin1 < m_accumulatedMaterial.size(); ++bin1) {
+    if (otherMaterial[bin1].size() != m_accumulatedMaterial[bin1].size()) {
+      throw std::invalid_argument(
+          "AccumulatedSurfaceMaterial: cannot merge material with different "
+          "binning");
+    }
+    for (std::size_t bin0 = 0; bin0 < m_accumulatedMaterial[bin1].size();
+         ++bin0) {
+      m_accumulatedMaterial[bin1][bin0].merge(otherMaterial[bin1][bin0]);
+    }
+  }
+}
+
+// Merge the material of a single bin
+void Acts::AccumulatedSurfaceMaterial::merge(
+    std::size_t bin0, std::size_t bin1, const AccumulatedMaterialSlab& slab) {
+  m_accumulatedMaterial.at(bin1).at(bin0).merge(slab);
+}
+
 /// Total average creates SurfaceMaterial
 std::unique_ptr<const Acts::ISurfaceMaterial>
 Acts::AccumulatedSurfaceMaterial::totalAverage() {
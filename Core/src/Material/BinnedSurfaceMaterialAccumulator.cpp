@@ -142,6 +142,24 @@ void Acts::BinnedSurfaceMaterialAccumulator::accumulate(
   }
 }
 
+void Acts::BinnedSurfaceMaterialAccumulator::merge(
+    ISurfaceMaterialAccumulator::State& state,
+    const ISurfaceMaterialAccumulator::State& other) const {
+  // Cast into the right state objects (guaranteed by upstream algorithm)
+  State* cState = static_cast<State*>(&state);
+  const State* oState = static_cast<const State*>(&other);
+
+  for (const auto& [geoId, accMaterial] : oState->accumulatedMaterial) {
+    auto target = cState->accumulatedMaterial.find(geoId);
+    if (target == cState->accumulatedMaterial.end()) {
+      ACTS_VERBOSE("Adding material for surface " << geoId);
+      cState->accumulatedMaterial.emplace(geoId, accMaterial);
+      continue;
+    }
+    target->second.merge(accMaterial);
+  }
+}
+
 std::map<Acts::GeometryIdentifier,
          std::shared_ptr<const Acts::ISurfaceMaterial>>
 Acts::BinnedSurfaceMaterialAccumulator::finalizeMaterial(
@@ -79,6 +79,13 @@ Acts::MaterialMapper::mapMaterial(State& state, const GeometryContext& gctx,
   return {mappedMaterial, unmappedMaterial};
 }
 
+void Acts::MaterialMapper::mergeStates(State& state,
+                                       const State& other) const {
+  m_cfg.surfaceMaterialAccumulator->merge(
+      *state.surfaceMaterialAccumulatorState,
+      *other.surfaceMaterialAccumulatorState);
+}
+
 Acts::TrackingGeometryMaterial Acts::MaterialMapper::finalizeMaps(
     const State& state, const GeometryContext& gctx) const {
   // The final maps
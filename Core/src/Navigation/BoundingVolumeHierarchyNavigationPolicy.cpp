@@ -0,0 +1,194 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Acts/Navigation/BoundingVolumeHierarchyNavigationPolicy.hpp"
+
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/Polyhedron.hpp"
+#include "Acts/Geometry/TrackingVolume.hpp"
+#include "Acts/Navigation/NavigationStream.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Surfaces/SurfaceBounds.hpp"
+#include "Acts/Utilities/Ray.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <stdexcept>
+
+namespace Acts {
+
+BoundingVolumeHierarchyNavigationPolicy::
+    BoundingVolumeHierarchyNavigationPolicy(const GeometryContext& gctx,
+                                            const TrackingVolume& volume,
+                                            const Logger& logger,
+                                            const Config& config)
+    : m_cfg{config}, m_volume(&volume) {
+  ACTS_VERBOSE("BoundingVolumeHierarchyNavigationPolicy created for volume "
+               << m_volume->volumeName());
+
+  if (m_cfg.maxLeafSize == 0) {
+    throw std::invalid_argument(
+        "BoundingVolumeHierarchyNavigationPolicy: maximum leaf size must be "
+        "positive");
+  }
+
+  const Vector3 envelope = Vector3::Constant(m_cfg.envelope);
+  for (const auto& surface : m_volume->surfaces()) {
+    bool isSensitive = surface.isSensitive();
+    if (!((m_cfg.passives && !isSensitive) ||
+          (m_cfg.sensitives && isSensitive))) {
+      continue;
+    }
+
+    if (surface.bounds().type() == SurfaceBounds::eBoundless) {
+      m_unbounded.push_back(&surface);
+      continue;
+    }
+
+    Polyhedron polyhedron =
+        surface.polyhedronRepresentation(gctx, m_cfg.quarterSegments);
+    Vector3 vmin = Vector3::Constant(std::numeric_limits<double>::max());
+    Vector3 vmax = Vector3::Constant(std::numeric_limits<double>::lowest());
+    for (const Vector3& vertex : polyhedron.vertices) {
+      vmin = vmin.cwiseMin(vertex);
+      vmax = vmax.cwiseMax(vertex);
+    }
+    m_boxes.emplace_back(&surface, vmin - envelope, vmax + envelope);
+  }
+
+  if (m_boxes.size() >= std::numeric_limits<std::uint32_t>::max()) {
+    throw std::invalid_argument(
+        "BoundingVolumeHierarchyNavigationPolicy: too many surfaces");
+  }
+
+  if (!m_boxes.empty()) {
+    m_nodes.reserve(2 * m_boxes.size() / m_cfg.maxLeafSize + 1);
+    build(0, static_cast<std::uint32_t>(m_boxes.size()));
+  }
+
+  ACTS_VERBOSE("~> " << m_boxes.size() << " surface boxes in "
+                     << m_nodes.size() << " nodes, " << m_unbounded.size()
+                     << " unbounded surfaces");
+}
+
+BoundingVolumeHierarchyNavigationPolicy::
+    BoundingVolumeHierarchyNavigationPolicy(const GeometryContext& gctx,
+                                            const TrackingVolume& volume,
+                                            const Logger& logger)
+    : BoundingVolumeHierarchyNavigationPolicy(gctx, volume, logger, {}) {}
+
+void BoundingVolumeHierarchyNavigationPolicy::build(
+    std::uint32_t first, std::uint32_t last) {
+  assert(first < last);
+
+  Vector3 vmin = m_boxes[first].min();
+  Vector3 vmax = m_boxes[first].max();
+  Vector3 cmin = m_boxes[first].center();
+  Vector3 cmax = cmin;
+  for (std::uint32_t i = first + 1; i < last; ++i) {
+    vmin = vmin.cwiseMin(m_boxes[i].min());
+    vmax = vmax.cwiseMax(m_boxes[i].max());
+    cmin = cmin.cwiseMin(m_boxes[i].center());
+    cmax = cmax.cwiseMax(m_boxes[i].center());
+  }
+
+  const auto index = static_cast<std::uint32_t>(m_nodes.size());
+  m_nodes.push_back(Node{.box = BoundingBox{nullptr, vmin, vmax}});
+
+  if (last - first <= m_cfg.maxLeafSize) {
+    m_nodes[index].first = first;
+    m_nodes[index].count = last - first;
+    m_nodes[index].skip = index + 1;
+    return;
+  }
+
+  // Split at the median of the box centers along the longest axis of the
+  // center distribution
+  Eigen::Index axis = 0;
+  (cmax - cmin).maxCoeff(&axis);
+  const std::uint32_t middle = first + (last - first) / 2;
+  std::nth_element(m_boxes.begin() + first, m_boxes.begin() + middle,
+                   m_boxes.begin() + last,
+                   [axis](const BoundingBox& a, const BoundingBox& b) {
+                     return a.center()[axis] < b.center()[axis];
+                   });
+
+  build(first, middle);
+  build(middle, last);
+  m_nodes[index].skip = static_cast<std::uint32_t>(m_nodes.size());
+}
+
+void BoundingVolumeHierarchyNavigationPolicy::initializeCandidates(
+    [[maybe_unused]] const GeometryContext& gctx,
+    const NavigationArguments& args, NavigationPolicyState& /*state*/,
+    AppendOnlyNavigationStream& stream, const Logger& logger) const {
+  ACTS_VERBOSE(
+      "BoundingVolumeHierarchyNavigationPolicy initializing candidates for "
+      "volume "
+      << m_volume->volumeName());
+  assert(m_volume != nullptr);
+
+  std::size_t numCandidates = 0;
+
+  if (m_cfg.portals) {
+    for (const auto& portal : m_volume->portals()) {
+      stream.addPortalCandidate(portal);
+      numCandidates++;
+    }
+  }
+
+  for (const Surface* surface : m_unbounded) {
+    stream.addSurfaceCandidate(*surface, args.tolerance);
+    numCandidates++;
+  }
+
+  const Ray3D ray(args.position, args.direction);
+  const auto nNodes = static_cast<std::uint32_t>(m_nodes.size());
+  std::uint32_t index = 0;
+  while (index < nNodes) {
+    const Node& node = m_nodes[index];
+    if (!node.box.intersect(ray)) {
+      index = node.skip;
+      continue;
+    }
+    for (std::uint32_t i = node.first; i < node.first + node.count; ++i) {
+      const BoundingBox& box = m_boxes[i];
+      if (box.intersect(ray)) {
+        stream.addSurfaceCandidate(*box.entity(), args.tolerance);
+        numCandidates++;
+      }
+    }
+    ++index;
+  }
+
+  ACTS_VERBOSE("BoundingVolumeHierarchyNavigationPolicy added "
+               << numCandidates << " candidates to the stream");
+}
+
+void BoundingVolumeHierarchyNavigationPolicy::connect(
+    NavigationDelegate& delegate) const {
+  connectDefault<BoundingVolumeHierarchyNavigationPolicy>(delegate);
+}
+
+const BoundingVolumeHierarchyNavigationPolicy::Config&
+BoundingVolumeHierarchyNavigationPolicy::config() const {
+  return m_cfg;
+}
+
+const std::vector<BoundingVolumeHierarchyNavigationPolicy::Node>&
+BoundingVolumeHierarchyNavigationPolicy::nodes() const {
+  return m_nodes;
+}
+
+const std::vector<BoundingVolumeHierarchyNavigationPolicy::BoundingBox>&
+BoundingVolumeHierarchyNavigationPolicy::boxes() const {
+  return m_boxes;
+}
+
+}  // namespace Acts
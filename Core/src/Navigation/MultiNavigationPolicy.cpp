@@ -8,6 +8,8 @@
 
 #include "Acts/Navigation/MultiNavigationPolicy.hpp"
 
+#include <algorithm>
+
 namespace Acts {
 
 MultiNavigationPolicy::MultiNavigationPolicy(
@@ -66,6 +68,12 @@ void MultiNavigationPolicy::visit(
   }
 }
 
+bool MultiNavigationPolicy::isQueryIndependent() const {
+  return std::ranges::all_of(m_policyPtrs, [](const auto& policy) {
+    return policy->isQueryIndependent();
+  });
+}
+
 void MultiNavigationPolicy::createState(
     const GeometryContext& gctx, const NavigationArguments& args,
     NavigationPolicyStateManager& stateManager, const Logger& logger) const {
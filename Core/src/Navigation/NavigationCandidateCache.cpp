@@ -0,0 +1,123 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Acts/Navigation/NavigationCandidateCache.hpp"
+
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Utilities/HashCombine.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numbers>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+namespace Acts {
+
+namespace {
+
+std::uint32_t clampedBin(double value, std::uint32_t nBins) {
+  const auto bin = static_cast<std::int64_t>(std::floor(value * nBins));
+  return static_cast<std::uint32_t>(
+      std::clamp<std::int64_t>(bin, 0, static_cast<std::int64_t>(nBins) - 1));
+}
+
+}  // namespace
+
+NavigationCandidateCache::NavigationCandidateCache(const Config& config)
+    : m_cfg(config) {
+  if (!(m_cfg.positionCellSize > 0)) {
+    throw std::invalid_argument(
+        "NavigationCandidateCache: position cell size must be positive");
+  }
+  if (m_cfg.nPhiBins == 0 || m_cfg.nCosThetaBins == 0) {
+    throw std::invalid_argument(
+        "NavigationCandidateCache: number of direction bins must be positive");
+  }
+  m_invCellSize = 1. / m_cfg.positionCellSize;
+}
+
+NavigationCandidateCache::Key NavigationCandidateCache::key(
+    const TrackingVolume& volume, const Vector3& position,
+    const Vector3& direction) const {
+  Key key;
+  key.volume = &volume;
+  key.cellX =
+      static_cast<std::int64_t>(std::floor(position.x() * m_invCellSize));
+  key.cellY =
+      static_cast<std::int64_t>(std::floor(position.y() * m_invCellSize));
+  key.cellZ =
+      static_cast<std::int64_t>(std::floor(position.z() * m_invCellSize));
+
+  const double phi = std::atan2(direction.y(), direction.x());
+  const std::uint32_t phiBin =
+      clampedBin((phi + std::numbers::pi) / (2 * std::numbers::pi),
+                 m_cfg.nPhiBins);
+  const std::uint32_t cosThetaBin =
+      clampedBin(0.5 * (direction.z() + 1.), m_cfg.nCosThetaBins);
+  key.directionBin = cosThetaBin * m_cfg.nPhiBins + phiBin;
+  return key;
+}
+
+const std::vector<NavigationTarget>* NavigationCandidateCache::find(
+    const Key& key) const {
+  auto it = m_entries.find(key);
+  return it != m_entries.end() ? &it->second : nullptr;
+}
+
+void NavigationCandidateCache::insert(
+    const Key& key, std::span<const NavigationTarget> candidates,
+    std::span<const NavigationTarget> ordered) {
+  if (m_entries.size() >= m_cfg.maxEntries) {
+    m_entries.clear();
+  }
+
+  // The rank of a candidate is the position of its surface in the ordered
+  // candidates, the first intersection of a surface counts
+  std::unordered_map<const Surface*, std::size_t> ranks;
+  ranks.reserve(ordered.size());
+  for (std::size_t i = 0; i < ordered.size(); ++i) {
+    ranks.try_emplace(&ordered[i].surface(), i);
+  }
+
+  constexpr std::size_t unranked = std::numeric_limits<std::size_t>::max();
+  std::vector<std::pair<std::size_t, NavigationTarget>> ranked;
+  ranked.reserve(candidates.size());
+  for (const NavigationTarget& candidate : candidates) {
+    auto it = ranks.find(&candidate.surface());
+    ranked.emplace_back(it != ranks.end() ? it->second : unranked, candidate);
+  }
+  std::ranges::stable_sort(ranked, std::less{},
+                           [](const auto& r) { return r.first; });
+
+  std::vector<NavigationTarget> entry;
+  entry.reserve(ranked.size());
+  for (const auto& [rank, candidate] : ranked) {
+    entry.push_back(candidate);
+  }
+
+  m_entries.insert_or_assign(key, std::move(entry));
+}
+
+void NavigationCandidateCache::clear() {
+  m_entries.clear();
+}
+
+std::size_t NavigationCandidateCache::size() const {
+  return m_entries.size();
+}
+
+std::size_t NavigationCandidateCache::KeyHash::operator()(
+    const Key& key) const {
+  return hashMixAndCombine(key.volume, key.cellX, key.cellY, key.cellZ,
+                           key.directionBin);
+}
+
+}  // namespace Acts
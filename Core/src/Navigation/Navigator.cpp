@@ -12,6 +12,7 @@
 #include "Acts/Geometry/BoundarySurfaceT.hpp"
 #include "Acts/Geometry/GeometryIdentifier.hpp"
 #include "Acts/Geometry/Portal.hpp"
+#include "Acts/Navigation/NavigationCandidateCache.hpp"
 #include "Acts/Propagator/NavigatorError.hpp"
 #include "Acts/Surfaces/Surface.hpp"
 #include "Acts/Utilities/Intersection.hpp"
@@ -20,7 +21,9 @@
 
 #include <algorithm>
 #include <cassert>
+#include <optional>
 #include <sstream>
+#include <vector>
 
 namespace Acts {
 std::ostream& operator<<(
@@ -581,9 +584,35 @@ void Navigator::resolveCandidates(State& state, const Vector3& position,
         "Navigator: No navigation policy found for current volume.");
   }
 
-  auto policyState = state.policyStateManager.currentState();
-  state.currentVolume->initializeNavigationCandidates(
-      state.options.geoContext, args, policyState, appendOnly, logger());
+  // The cache is only used for policies whose candidates do not depend on the
+  // query, which can therefore skip the policy on a cache hit
+  NavigationCandidateCache* cache = policy->isQueryIndependent()
+                                        ? state.options.candidateCache
+                                        : nullptr;
+  std::optional<NavigationCandidateCache::Key> cacheKey;
+  std::vector<NavigationTarget> policyCandidates;
+  const std::vector<NavigationTarget>* cached = nullptr;
+  if (cache != nullptr) {
+    cacheKey = cache->key(*state.currentVolume, position, direction);
+    cached = cache->find(*cacheKey);
+  }
+
+  if (cached != nullptr) {
+    ++state.statistics.nCandidateCacheHits;
+    ACTS_VERBOSE(volInfo(state) << "Reuse " << cached->size()
+                                << " cached navigation candidates.");
+    state.stream.candidates().assign(cached->begin(), cached->end());
+  } else {
+    auto policyState = state.policyStateManager.currentState();
+    state.currentVolume->initializeNavigationCandidates(
+        state.options.geoContext, args, policyState, appendOnly, logger());
+
+    if (cache != nullptr) {
+      ++state.statistics.nCandidateCacheMisses;
+      // Keep the policy candidates before they are intersected and pruned
+      policyCandidates = state.stream.candidates();
+    }
+  }
 
   ACTS_VERBOSE(volInfo(state) << "Found " << state.stream.candidates().size()
                               << " navigation candidates.");
@@ -621,6 +650,10 @@ void Navigator::resolveCandidates(State& state, const Vector3& position,
                           BoundaryTolerance::None(),
                           state.options.surfaceTolerance);
 
+  if (cacheKey.has_value() && cached == nullptr) {
+    cache->insert(*cacheKey, policyCandidates, state.stream.candidates());
+  }
+
   ACTS_VERBOSE(volInfo(state)
                << "Now " << state.stream.candidates().size()
                << " navigation candidates after initialization.\n"
@@ -70,6 +70,10 @@ void TryAllNavigationPolicy::connect(NavigationDelegate& delegate) const {
   connectDefault<TryAllNavigationPolicy>(delegate);
 }
 
+bool TryAllNavigationPolicy::isQueryIndependent() const {
+  return true;
+}
+
 const TryAllNavigationPolicy::Config& TryAllNavigationPolicy::config() const {
   return m_cfg;
 }
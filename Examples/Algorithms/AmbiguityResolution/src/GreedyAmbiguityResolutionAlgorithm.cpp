@@ -32,14 +32,10 @@ Acts::GreedyAmbiguityResolution::Config transformConfig(
   return result;
 }
 
-std::size_t sourceLinkHash(const Acts::SourceLink& a) {
+std::size_t sourceLinkIndex(const Acts::SourceLink& a) {
   return static_cast<std::size_t>(a.get<IndexSourceLink>().index());
 }
 
-bool sourceLinkEquality(const Acts::SourceLink& a, const Acts::SourceLink& b) {
-  return a.get<IndexSourceLink>().index() == b.get<IndexSourceLink>().index();
-}
-
 }  // namespace
 
 GreedyAmbiguityResolutionAlgorithm::GreedyAmbiguityResolutionAlgorithm(
@@ -64,8 +60,7 @@ ProcessCode GreedyAmbiguityResolutionAlgorithm::execute(
   ACTS_VERBOSE("Number of input tracks: " << tracks.size());
 
   Acts::GreedyAmbiguityResolution::State state;
-  m_core.computeInitialState(tracks, state, &sourceLinkHash,
-                             &sourceLinkEquality);
+  m_core.computeInitialState(tracks, state, &sourceLinkIndex);
 
   ACTS_VERBOSE("State initialized");
 
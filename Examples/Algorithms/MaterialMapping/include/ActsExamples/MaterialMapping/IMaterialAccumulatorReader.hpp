@@ -0,0 +1,32 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Material/interface/ISurfaceMaterialAccumulator.hpp"
+
+namespace ActsExamples {
+
+/// @class IMaterialAccumulatorReader
+///
+/// Interface definition for reading partially accumulated material, written
+/// by an @ref IMaterialAccumulatorWriter, back into an accumulator state.
+class IMaterialAccumulatorReader {
+ public:
+  /// Virtual Destructor
+  virtual ~IMaterialAccumulatorReader() = default;
+
+  /// Add the stored material to the accumulator state
+  ///
+  /// @param state the state of the surface material accumulator, created
+  ///        with the same configuration as the one that was written
+  virtual void readAccumulator(
+      Acts::ISurfaceMaterialAccumulator::State& state) const = 0;
+};
+
+}  // namespace ActsExamples
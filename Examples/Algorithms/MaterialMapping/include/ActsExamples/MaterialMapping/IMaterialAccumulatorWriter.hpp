@@ -0,0 +1,31 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Material/interface/ISurfaceMaterialAccumulator.hpp"
+
+namespace ActsExamples {
+
+/// @class IMaterialAccumulatorWriter
+///
+/// Interface definition for writing the partially accumulated material,
+/// i.e. the per-bin totals before the final averaging into material maps.
+class IMaterialAccumulatorWriter {
+ public:
+  /// Virtual Destructor
+  virtual ~IMaterialAccumulatorWriter() = default;
+
+  /// Write the accumulated material
+  ///
+  /// @param state the state of the surface material accumulator
+  virtual void writeAccumulator(
+      const Acts::ISurfaceMaterialAccumulator::State& state) = 0;
+};
+
+}  // namespace ActsExamples
@@ -13,6 +13,8 @@
 #include "ActsExamples/Framework/DataHandle.hpp"
 #include "ActsExamples/Framework/IAlgorithm.hpp"
 #include "ActsExamples/Framework/ProcessCode.hpp"
+#include "ActsExamples/MaterialMapping/IMaterialAccumulatorReader.hpp"
+#include "ActsExamples/MaterialMapping/IMaterialAccumulatorWriter.hpp"
 #include "ActsExamples/MaterialMapping/IMaterialWriter.hpp"
 
 #include <memory>
@@ -20,6 +22,11 @@
 #include <unordered_map>
 #include <vector>
 
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wold-style-cast"
+#include <tbb/enumerable_thread_specific.h>
+#pragma GCC diagnostic pop
+
 namespace ActsExamples {
 
 /// @class MaterialMapping
@@ -32,8 +39,16 @@ namespace ActsExamples {
 /// However, running it in one single event, puts enormous pressure onto
 /// the I/O structure.
 ///
-/// It therefore saves the mapping state/cache as a private member variable
-/// and is designed to be executed in a single threaded mode.
+/// It therefore keeps one mapping state/cache per thread as a private member
+/// variable. The states are filled independently and merged when the
+/// algorithm is finalized, before the maps are written out. The merged maps
+/// are statistically equivalent to the single threaded result, but not bit
+/// identical as the order of the averaging depends on the thread scheduling.
+///
+/// The merged state can also be written out before the final averaging with
+/// accumulator writers. This allows to split the mapping into several jobs,
+/// which only write their accumulated material, and to create the maps once
+/// from all of them with @ref mergeMaterialAccumulators.
 class MaterialMapping : public IAlgorithm {
  public:
   /// @class nested Config class
@@ -55,8 +70,13 @@ class MaterialMapping : public IAlgorithm {
     /// The ACTS material mapper from the core component
     std::shared_ptr<Acts::MaterialMapper> materialMapper = nullptr;
 
-    /// The writer of the material
+    /// The writer of the material, the maps are only finalized if at
+    /// least one writer is given
     std::vector<std::shared_ptr<IMaterialWriter>> materialWriters{};
+
+    /// The writers of the accumulated material before the final averaging
+    std::vector<std::shared_ptr<IMaterialAccumulatorWriter>>
+        accumulatorWriters{};
   };
 
   /// Constructor
@@ -71,9 +91,8 @@ class MaterialMapping : public IAlgorithm {
   /// @param context The algorithm context for event consistency
   ProcessCode execute(const AlgorithmContext& context) const override;
 
-  /// Destructor
-  /// - it also writes out the file
-  ~MaterialMapping() override;
+  /// Merge the per-thread states, finalize the maps and write them out
+  ProcessCode finalize() override;
 
   /// Readonly access to the config
   const Config& config() const { return m_cfg; }
@@ -81,7 +100,10 @@ class MaterialMapping : public IAlgorithm {
  private:
   Config m_cfg;  //!< internal config object
 
-  std::unique_ptr<Acts::MaterialMapper::State> m_mappingState{nullptr};
+  /// The mapping states, created lazily for every thread
+  mutable tbb::enumerable_thread_specific<
+      std::unique_ptr<Acts::MaterialMapper::State>>
+      m_mappingStates;
 
   ReadDataHandle<std::unordered_map<std::size_t, Acts::RecordedMaterialTrack>>
       m_inputMaterialTracks{this, "InputMaterialTracks"};
@@ -93,4 +115,18 @@ class MaterialMapping : public IAlgorithm {
       m_outputUnmappedMaterialTracks{this, "OutputUnmappedMaterialTracks"};
 };
 
+/// Create the material maps from partially accumulated material
+///
+/// @param materialMapper the mapper, configured as in the partial jobs
+/// @param gctx the geometry context
+/// @param readers the readers of the accumulated material
+/// @param materialWriters the writers of the final material maps
+///
+/// @return the merged material maps
+Acts::TrackingGeometryMaterial mergeMaterialAccumulators(
+    const Acts::MaterialMapper& materialMapper,
+    const Acts::GeometryContext& gctx,
+    const std::vector<std::shared_ptr<IMaterialAccumulatorReader>>& readers,
+    const std::vector<std::shared_ptr<IMaterialWriter>>& materialWriters = {});
+
 }  // namespace ActsExamples
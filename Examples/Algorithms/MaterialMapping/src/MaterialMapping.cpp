@@ -25,24 +25,59 @@ MaterialMapping::MaterialMapping(const MaterialMapping::Config& cfg,
   m_outputMappedMaterialTracks.initialize(m_cfg.mappedMaterialTracks);
   m_outputUnmappedMaterialTracks.initialize(m_cfg.unmappedMaterialTracks);
 
-  ACTS_LOG_WITH_LOGGER(this->logger(), Acts::Logging::INFO,
-                       "This algorithm requires inter-event information, "
-                           << "run in single-threaded mode!");
-
   if (m_cfg.materialMapper == nullptr) {
     throw std::invalid_argument("Missing material mapper");
   }
-  // Create the state object
-  m_mappingState = m_cfg.materialMapper->createState(m_cfg.geoContext);
 }
 
-MaterialMapping::~MaterialMapping() {
+ProcessCode MaterialMapping::finalize() {
+  // Merge the thread local states into a single one
+  auto mappingState = m_cfg.materialMapper->createState(m_cfg.geoContext);
+  std::size_t nStates = 0;
+  for (const auto& state : m_mappingStates) {
+    if (state == nullptr) {
+      continue;
+    }
+    m_cfg.materialMapper->mergeStates(*mappingState, *state);
+    ++nStates;
+  }
+  ACTS_DEBUG("Merged " << nStates << " thread local mapping states");
+  m_mappingStates.clear();
+
+  // Write the accumulated material before averaging
+  for (auto& imaw : m_cfg.accumulatorWriters) {
+    imaw->writeAccumulator(*mappingState->surfaceMaterialAccumulatorState);
+  }
+
+  if (m_cfg.materialWriters.empty()) {
+    return ProcessCode::SUCCESS;
+  }
+
   Acts::TrackingGeometryMaterial detectorMaterial =
-      m_cfg.materialMapper->finalizeMaps(*m_mappingState, m_cfg.geoContext);
+      m_cfg.materialMapper->finalizeMaps(*mappingState, m_cfg.geoContext);
   // Loop over the available writers and write the maps
   for (auto& imw : m_cfg.materialWriters) {
     imw->writeMaterial(detectorMaterial);
   }
+  return ProcessCode::SUCCESS;
+}
+
+Acts::TrackingGeometryMaterial mergeMaterialAccumulators(
+    const Acts::MaterialMapper& materialMapper,
+    const Acts::GeometryContext& gctx,
+    const std::vector<std::shared_ptr<IMaterialAccumulatorReader>>& readers,
+    const std::vector<std::shared_ptr<IMaterialWriter>>& materialWriters) {
+  auto mappingState = materialMapper.createState(gctx);
+  for (const auto& imar : readers) {
+    imar->readAccumulator(*mappingState->surfaceMaterialAccumulatorState);
+  }
+
+  Acts::TrackingGeometryMaterial detectorMaterial =
+      materialMapper.finalizeMaps(*mappingState, gctx);
+  for (const auto& imw : materialWriters) {
+    imw->writeMaterial(detectorMaterial);
+  }
+  return detectorMaterial;
 }
 
 ProcessCode MaterialMapping::execute(const AlgorithmContext& context) const {
@@ -57,9 +92,16 @@ ProcessCode MaterialMapping::execute(const AlgorithmContext& context) const {
   std::unordered_map<std::size_t, Acts::RecordedMaterialTrack>
       unmappedTrackCollection;
 
+  // The state of this thread, created on first use
+  std::unique_ptr<Acts::MaterialMapper::State>& mappingState =
+      m_mappingStates.local();
+  if (mappingState == nullptr) {
+    mappingState = m_cfg.materialMapper->createState(m_cfg.geoContext);
+  }
+
   for (const auto& [idTrack, mTrack] : mtrackCollection) {
     auto [mapped, unmapped] = m_cfg.materialMapper->mapMaterial(
-        *m_mappingState, context.geoContext, context.magFieldContext, mTrack);
+        *mappingState, context.geoContext, context.magFieldContext, mTrack);
 
     mappedTrackCollection.try_emplace(mappedTrackCollection.end(), idTrack,
                                       mapped);
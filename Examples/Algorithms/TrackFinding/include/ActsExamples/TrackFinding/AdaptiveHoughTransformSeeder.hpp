@@ -65,6 +65,13 @@ class AdaptiveHoughTransformSeeder final : public IAlgorithm {
                                 // find less solutions
     bool deduplicate = true;    // when adding solutions try avoiding duplicates
 
+    bool parallelExploration =
+        false;  // explore the sections of one event in parallel tasks, the
+                // solutions are kept in the order of the sequential search
+    unsigned parallelGrainSize =
+        64;  // sections with fewer lines are explored sequentially within one
+             // task
+
     double inverseA =
         1.0 / 3.0e-4;  // Assume B = 2T constant. Can apply corrections to
                        // this with fieldCorrection function
@@ -209,6 +216,18 @@ class AdaptiveHoughTransformSeeder final : public IAlgorithm {
 
   void deduplicate(
       std::vector<Acts::Experimental::HoughAccumulatorSection> &input) const;
+
+  /// @brief explore the sections on the stack, sequentially or in parallel
+  /// tasks depending on the configuration
+  /// @param input is the stack of sections to consider, empty afterwards
+  /// @param output is the output set of sections
+  /// @param measurements are input measurements
+  /// @param opt are the exploration directives
+  void exploreSections(
+      std::vector<Acts::Experimental::HoughAccumulatorSection> &input,
+      std::vector<Acts::Experimental::HoughAccumulatorSection> &output,
+      const std::vector<PreprocessedMeasurement> &measurements,
+      const ExplorationOptions &opt) const;
 };
 
 }  // namespace ActsExamples
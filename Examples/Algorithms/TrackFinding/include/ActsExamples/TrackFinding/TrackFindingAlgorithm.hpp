@@ -115,6 +115,22 @@ class TrackFindingAlgorithm final : public IAlgorithm {
     bool computeSharedHits = false;
     /// Whether to trim the tracks
     bool trimTracks = true;
+    /// Whether to drop the track states of stopped branches after the first
+    /// pass, before the track candidates are copied and the second pass runs
+    bool compactTrackStates = false;
+    /// Whether to process the seeds of an event in parallel. The seeds are
+    /// processed in batches and the tracks are merged in seed order, so the
+    /// output does not depend on the number of threads.
+    bool parallelSeeds = false;
+    /// Number of seeds per batch in the parallel mode. Seeds covered by tracks
+    /// of earlier batches are skipped before being processed, seeds covered
+    /// by earlier seeds of the same batch are dropped when merging. The output
+    /// is identical to the sequential processing for any batch size.
+    std::size_t seedBatchSize = 1024;
+    /// Whether to cache the navigation candidates of volumes with a query
+    /// independent navigation policy. The cache is shared by the propagations
+    /// of all seeds processed by the same thread within an event.
+    bool navigationCandidateCache = false;
 
     /// Whether to use the Joseph formulation for the Kalman filter update. This
     /// is typically more stable but also more computationally expensive.
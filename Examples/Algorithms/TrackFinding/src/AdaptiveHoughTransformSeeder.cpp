@@ -21,6 +21,9 @@
 #include <ostream>
 #include <stdexcept>
 
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/task_group.h>
+
 namespace ActsExamples {
 
 AdaptiveHoughTransformSeeder::AdaptiveHoughTransformSeeder(
@@ -216,16 +219,18 @@ void AdaptiveHoughTransformSeeder::processStackQOverPtPhi(
     int discardedByThresholdCut{};
     int discardedByCrossingCut{};
   };
-  std::map<int, Stats> sStat;
+  // the decision functor may be called from several tasks at once
+  tbb::enumerable_thread_specific<std::map<int, Stats>> sStatPerThread;
   ExplorationOptions opt;
   opt.xMinBinSize = m_cfg.phiMinBinSize;
   opt.yMinBinSize = m_cfg.qOverPtMinBinSize;
   opt.lineFunctor = m_qOverPtPhiLineParams;
   opt.decisionFunctor =
-      [&sStat, &cfg = m_cfg, &opt, this](
+      [&sStatPerThread, &cfg = m_cfg, &opt, this](
           const Acts::Experimental::HoughAccumulatorSection &section,
           const std::vector<PreprocessedMeasurement> &mes) {
         using enum HoughAccumulatorSection::Decision;
+        std::map<int, Stats> &sStat = sStatPerThread.local();
 
         if (section.divisionLevel() <= 8) {
           return Drill;
@@ -255,12 +260,23 @@ void AdaptiveHoughTransformSeeder::processStackQOverPtPhi(
         return Drill;
       };
 
-  exploreHoughParametersSpace(input, measurements, opt, output);
+  exploreSections(input, output, measurements, opt);
   const unsigned nl = std::accumulate(
       output.begin(), output.end(), 0,
       [](unsigned sum, const Acts::Experimental::HoughAccumulatorSection &s) {
         return sum + s.count();
       });
+  std::map<int, Stats> sStat;
+  for (const std::map<int, Stats> &threadStat : sStatPerThread) {
+    for (const auto &[div, stats] : threadStat) {
+      Stats &total = sStat[div];
+      total.area += stats.area;
+      total.nSections += stats.nSections;
+      total.nLines += stats.nLines;
+      total.discardedByThresholdCut += stats.discardedByThresholdCut;
+      total.discardedByCrossingCut += stats.discardedByCrossingCut;
+    }
+  }
   ACTS_DEBUG("size " << sStat.size());
   for (const auto &[div, stats] : sStat) {
     ACTS_DEBUG("Area in used by div: "
@@ -297,7 +313,7 @@ void AdaptiveHoughTransformSeeder::processStackZCotTheta(
         return Drill;
       };
 
-  exploreHoughParametersSpace(input, measurements, opt, output);
+  exploreSections(input, output, measurements, opt);
   const unsigned nl = std::accumulate(
       output.begin(), output.end(), 0,
       [](unsigned sum, const Acts::Experimental::HoughAccumulatorSection &s) {
@@ -331,7 +347,7 @@ void AdaptiveHoughTransformSeeder::processStackZCotThetaSplit(
         return Drill;
       };
 
-  exploreHoughParametersSpace(input, measurements, opt, output);
+  exploreSections(input, output, measurements, opt);
   const unsigned nl = std::accumulate(
       output.begin(), output.end(), 0,
       [](unsigned sum, const Acts::Experimental::HoughAccumulatorSection &s) {
@@ -341,6 +357,91 @@ void AdaptiveHoughTransformSeeder::processStackZCotThetaSplit(
              << output.size() << " included measurements " << nl);
 }
 
+namespace {
+
+/// Solutions found below one section, kept such that they can be collected
+/// in the order of the sequential depth-first search
+struct ExploredSubtree {
+  /// solutions found when splitting the section itself
+  std::vector<Acts::Experimental::HoughAccumulatorSection> accepted;
+  /// subsections to be explored further, in the order the sequential search
+  /// visits them
+  std::vector<ExploredSubtree> below;
+};
+
+void exploreSubtree(
+    Acts::Experimental::HoughAccumulatorSection &&section,
+    const std::vector<
+        AdaptiveHoughTransformSeeder::PreprocessedMeasurement> &measurements,
+    const AdaptiveHoughTransformSeeder::ExplorationOptions &opt,
+    std::size_t grainSize,
+    tbb::enumerable_thread_specific<Acts::Experimental::HoughSectionPool>
+        &pools,
+    ExploredSubtree &subtree) {
+  Acts::Experimental::HoughSectionPool &pool = pools.local();
+  std::vector<Acts::Experimental::HoughAccumulatorSection> toExplore;
+  if (section.count() < grainSize) {
+    toExplore.push_back(std::move(section));
+    Acts::Experimental::exploreHoughParametersSpace(
+        toExplore, measurements, opt, subtree.accepted, pool);
+    return;
+  }
+
+  Acts::Experimental::splitHoughSection(std::move(section), measurements, opt,
+                                        pool, toExplore, subtree.accepted);
+  // the sequential search takes the last subsection from the stack first
+  subtree.below.resize(toExplore.size());
+  tbb::task_group group;
+  for (std::size_t i = 0; i < toExplore.size(); ++i) {
+    group.run([&, i]() {
+      exploreSubtree(std::move(toExplore[toExplore.size() - 1 - i]),
+                     measurements, opt, grainSize, pools, subtree.below[i]);
+    });
+  }
+  group.wait();
+}
+
+void collectSolutions(
+    ExploredSubtree &subtree,
+    std::vector<Acts::Experimental::HoughAccumulatorSection> &output) {
+  std::ranges::move(subtree.accepted, std::back_inserter(output));
+  for (ExploredSubtree &below : subtree.below) {
+    collectSolutions(below, output);
+  }
+}
+
+}  // namespace
+
+void AdaptiveHoughTransformSeeder::exploreSections(
+    std::vector<Acts::Experimental::HoughAccumulatorSection> &input,
+    std::vector<Acts::Experimental::HoughAccumulatorSection> &output,
+    const std::vector<PreprocessedMeasurement> &measurements,
+    const ExplorationOptions &opt) const {
+  if (!m_cfg.parallelExploration) {
+    exploreHoughParametersSpace(input, measurements, opt, output);
+    return;
+  }
+
+  // Every section is explored in its own task, subsections with enough lines
+  // spawn further tasks. The solutions are collected afterwards in the order
+  // in which the sequential search would have found them.
+  tbb::enumerable_thread_specific<Acts::Experimental::HoughSectionPool> pools;
+  std::vector<ExploredSubtree> subtrees(input.size());
+  tbb::task_group group;
+  for (std::size_t i = 0; i < input.size(); ++i) {
+    group.run([&, i]() {
+      exploreSubtree(std::move(input[input.size() - 1 - i]), measurements, opt,
+                     m_cfg.parallelGrainSize, pools, subtrees[i]);
+    });
+  }
+  group.wait();
+  input.clear();
+
+  for (ExploredSubtree &subtree : subtrees) {
+    collectSolutions(subtree, output);
+  }
+}
+
 void AdaptiveHoughTransformSeeder::makeSeeds(
     SeedContainer &seeds,
     const std::vector<Acts::Experimental::HoughAccumulatorSection> &solutions,
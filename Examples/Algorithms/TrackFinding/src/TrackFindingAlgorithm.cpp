@@ -18,6 +18,7 @@
 #include "Acts/EventData/VectorMultiTrajectory.hpp"
 #include "Acts/EventData/VectorTrackContainer.hpp"
 #include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/Navigation/NavigationCandidateCache.hpp"
 #include "Acts/Propagator/MaterialInteractor.hpp"
 #include "Acts/Propagator/Navigator.hpp"
 #include "Acts/Propagator/Propagator.hpp"
@@ -39,7 +40,9 @@
 #include "ActsExamples/EventData/Track.hpp"
 #include "ActsExamples/Framework/AlgorithmContext.hpp"
 #include "ActsExamples/Framework/ProcessCode.hpp"
+#include "ActsExamples/Utilities/tbbWrap.hpp"
 
+#include <algorithm>
 #include <functional>
 #include <memory>
 #include <optional>
@@ -47,6 +50,13 @@
 #include <stdexcept>
 #include <unordered_map>
 #include <utility>
+#include <vector>
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wold-style-cast"
+#include <tbb/blocked_range.h>
+#include <tbb/enumerable_thread_specific.h>
+#pragma GCC diagnostic pop
 
 // Specialize std::hash for SeedIdentifier
 // This is required to use SeedIdentifier as a key in an `std::unordered_map`.
@@ -251,6 +261,91 @@ class BranchStopper {
   const TrackFindingAlgorithm::Config& m_cfg;
 };
 
+/// Tracks and statistics of a single seed
+struct SeedResult {
+  /// Indices of the selected tracks in the output container
+  std::vector<Acts::TrackIndexType> tracks;
+
+  std::size_t nFailedSeeds = 0;
+  std::size_t nFailedSmoothing = 0;
+  std::size_t nFailedExtrapolation = 0;
+  std::size_t nFoundTracks = 0;
+  std::size_t nSkippedSecondPass = 0;
+};
+
+/// Mutable state used to process seeds, one instance is used per thread
+class SeedProcessingState {
+ public:
+  using TrackStateCreatorType =
+      Acts::TrackStateCreator<IndexSourceLinkAccessor::Iterator,
+                              TrackContainer>;
+
+  SeedProcessingState(
+      const TrackFindingAlgorithm::Config& config,
+      const IndexSourceLinkAccessor& slAccessor,
+      const MeasurementCalibratorAdapter& calibrator,
+      const TrackFindingAlgorithm::TrackFinderOptions& firstOptions_,
+      const TrackFindingAlgorithm::TrackFinderOptions& secondOptions_)
+      : measSel{Acts::MeasurementSelector(config.measurementSelectorCfg)},
+        firstOptions(firstOptions_),
+        secondOptions(secondOptions_),
+        tracksTemp(std::make_shared<Acts::VectorTrackContainer>(),
+                   std::make_shared<Acts::VectorMultiTrajectory>()),
+        tracksOutput(std::make_shared<Acts::VectorTrackContainer>(),
+                     std::make_shared<Acts::VectorMultiTrajectory>()) {
+    trackStateCreator.sourceLinkAccessor
+        .template connect<&IndexSourceLinkAccessor::range>(&slAccessor);
+    trackStateCreator.calibrator
+        .template connect<&MeasurementCalibratorAdapter::calibrate>(
+            &calibrator);
+    trackStateCreator.measurementSelector
+        .template connect<&MeasurementSelector::select>(&measSel);
+    // Keep the temporary measurement candidates out of the output trajectory
+    trackStateCreator.candidateTrajectory = &candidateTrajectory;
+
+    if (config.navigationCandidateCache) {
+      navigationCache.emplace(Acts::NavigationCandidateCache::Config{});
+      firstOptions.propagatorPlainOptions.navigation.candidateCache =
+          &*navigationCache;
+      secondOptions.propagatorPlainOptions.navigation.candidateCache =
+          &*navigationCache;
+    }
+
+    firstOptions.extensions.createTrackStates
+        .template connect<&TrackStateCreatorType::createTrackStates>(
+            &trackStateCreator);
+    secondOptions.extensions.createTrackStates
+        .template connect<&TrackStateCreatorType::createTrackStates>(
+            &trackStateCreator);
+
+    // Note that not all backends support PODs as column types
+    tracksTemp.addColumn<BranchStopper::BranchState>("MyBranchState");
+    tracksOutput.addColumn<BranchStopper::BranchState>("MyBranchState");
+
+    tracksTemp.addColumn<unsigned int>("trackGroup");
+    tracksOutput.addColumn<unsigned int>("trackGroup");
+  }
+
+  SeedProcessingState(const SeedProcessingState&) = delete;
+  SeedProcessingState& operator=(const SeedProcessingState&) = delete;
+
+  MeasurementSelector measSel;
+  TrackContainer::TrackStateContainerBackend candidateTrajectory;
+  TrackStateCreatorType trackStateCreator;
+
+  TrackFindingAlgorithm::TrackFinderOptions firstOptions;
+  TrackFindingAlgorithm::TrackFinderOptions secondOptions;
+
+  /// Navigation candidates shared by the propagations of this state
+  std::optional<Acts::NavigationCandidateCache> navigationCache;
+
+  /// Scratch container for the branches of the current seed
+  TrackContainer tracksTemp;
+  /// Selected tracks of the seeds processed in parallel, before they are
+  /// merged into the event output
+  TrackContainer tracksOutput;
+};
+
 }  // namespace
 
 TrackFindingAlgorithm::TrackFindingAlgorithm(
@@ -320,30 +415,18 @@ ProcessCode TrackFindingAlgorithm::execute(const AlgorithmContext& ctx) const {
   using Extensions = Acts::CombinatorialKalmanFilterExtensions<TrackContainer>;
 
   BranchStopper branchStopper(m_cfg);
-  MeasurementSelector measSel{
-      Acts::MeasurementSelector(m_cfg.measurementSelectorCfg)};
 
   IndexSourceLinkAccessor slAccessor;
   slAccessor.container = &measurements.orderedIndices();
-
-  using TrackStateCreatorType =
-      Acts::TrackStateCreator<IndexSourceLinkAccessor::Iterator,
-                              TrackContainer>;
-  TrackStateCreatorType trackStateCreator;
-  trackStateCreator.sourceLinkAccessor
-      .template connect<&IndexSourceLinkAccessor::range>(&slAccessor);
-  trackStateCreator.calibrator
-      .template connect<&MeasurementCalibratorAdapter::calibrate>(&calibrator);
-  trackStateCreator.measurementSelector
-      .template connect<&MeasurementSelector::select>(&measSel);
+  if (m_cfg.trackingGeometry != nullptr) {
+    // bucket once per event so the per-surface lookup in the CKF is O(1)
+    slAccessor.bucketBySurfaceIndex(*m_cfg.trackingGeometry);
+  }
 
   Extensions extensions;
   extensions.updater.connect<&Acts::GainMatrixUpdater::operator()<
       typename TrackContainer::TrackStateContainerBackend>>(&kfUpdater);
   extensions.branchStopper.connect<&BranchStopper::operator()>(&branchStopper);
-  extensions.createTrackStates
-      .template connect<&TrackStateCreatorType ::createTrackStates>(
-          &trackStateCreator);
 
   Acts::PropagatorPlainOptions firstPropOptions(ctx.geoContext,
                                                 ctx.magFieldContext);
@@ -394,19 +477,12 @@ ProcessCode TrackFindingAlgorithm::execute(const AlgorithmContext& ctx) const {
   auto trackContainer = std::make_shared<Acts::VectorTrackContainer>();
   auto trackStateContainer = std::make_shared<Acts::VectorMultiTrajectory>();
 
-  auto trackContainerTemp = std::make_shared<Acts::VectorTrackContainer>();
-  auto trackStateContainerTemp =
-      std::make_shared<Acts::VectorMultiTrajectory>();
-
   TrackContainer tracks(trackContainer, trackStateContainer);
-  TrackContainer tracksTemp(trackContainerTemp, trackStateContainerTemp);
 
   // Note that not all backends support PODs as column types
   tracks.addColumn<BranchStopper::BranchState>("MyBranchState");
-  tracksTemp.addColumn<BranchStopper::BranchState>("MyBranchState");
 
   tracks.addColumn<unsigned int>("trackGroup");
-  tracksTemp.addColumn<unsigned int>("trackGroup");
   Acts::ProxyAccessor<unsigned int> seedNumber("trackGroup");
 
   unsigned int nSeed = 0;
@@ -414,34 +490,6 @@ ProcessCode TrackFindingAlgorithm::execute(const AlgorithmContext& ctx) const {
   // A map indicating whether a seed has been discovered already
   std::unordered_map<SeedIdentifier, bool> discoveredSeeds;
 
-  auto addTrack = [&](const TrackProxy& track) {
-    ++m_nFoundTracks;
-
-    // trim the track if requested
-    if (m_cfg.trimTracks) {
-      Acts::trimTrack(track, true, true, true, true);
-    }
-    Acts::calculateTrackQuantities(track);
-
-    if (m_trackSelector.has_value() && !m_trackSelector->isValidTrack(track)) {
-      return;
-    }
-
-    // flag seeds which are covered by the track
-    visitSeedIdentifiers(track, [&](const SeedIdentifier& seedIdentifier) {
-      if (auto it = discoveredSeeds.find(seedIdentifier);
-          it != discoveredSeeds.end()) {
-        it->second = true;
-      }
-    });
-
-    ++m_nSelectedTracks;
-
-    auto destProxy = tracks.makeTrack();
-    // make sure we copy track states!
-    destProxy.copyFrom(track);
-  };
-
   if (seeds != nullptr && m_cfg.seedDeduplication) {
     // Index the seeds for deduplication
     for (const auto& seed : *seeds) {
@@ -450,26 +498,45 @@ ProcessCode TrackFindingAlgorithm::execute(const AlgorithmContext& ctx) const {
     }
   }
 
-  for (std::size_t iSeed = 0; iSeed < initialParameters.size(); ++iSeed) {
-    m_nTotalSeeds++;
+  // check if the seed has been discovered already
+  auto isDiscovered = [&](std::size_t iSeed) {
+    if (seeds == nullptr || !m_cfg.seedDeduplication) {
+      return false;
+    }
+    SeedIdentifier seedIdentifier = makeSeedIdentifier(seeds->at(iSeed));
+    auto it = discoveredSeeds.find(seedIdentifier);
+    return it != discoveredSeeds.end() && it->second;
+  };
 
-    if (seeds != nullptr) {
-      const ConstSeedProxy seed = seeds->at(iSeed);
+  // Find the tracks of a single seed and copy the selected ones to `output`
+  auto processSeed = [&](std::size_t iSeed, SeedProcessingState& state,
+                         TrackContainer& output) {
+    SeedResult result;
 
-      if (m_cfg.seedDeduplication) {
-        SeedIdentifier seedIdentifier = makeSeedIdentifier(seed);
-        // check if the seed has been discovered already
-        if (auto it = discoveredSeeds.find(seedIdentifier);
-            it != discoveredSeeds.end() && it->second) {
-          m_nDeduplicatedSeeds++;
-          ACTS_VERBOSE("Skipping seed " << iSeed << " due to deduplication.");
-          continue;
-        }
+    auto& tracksTemp = state.tracksTemp;
+
+    auto addTrack = [&](const TrackProxy& track) {
+      ++result.nFoundTracks;
+
+      // trim the track if requested
+      if (m_cfg.trimTracks) {
+        Acts::trimTrack(track, true, true, true, true);
       }
+      Acts::calculateTrackQuantities(track);
 
-      if (m_cfg.stayOnSeed) {
-        measSel.setSeed(seed);
+      if (m_trackSelector.has_value() &&
+          !m_trackSelector->isValidTrack(track)) {
+        return;
       }
+
+      auto destProxy = output.makeTrack();
+      // make sure we copy track states!
+      destProxy.copyFrom(track);
+      result.tracks.push_back(destProxy.index());
+    };
+
+    if (seeds != nullptr && m_cfg.stayOnSeed) {
+      state.measSel.setSeed(seeds->at(iSeed));
     }
 
     // Clear trackContainerTemp and trackStateContainerTemp
@@ -481,18 +548,27 @@ ProcessCode TrackFindingAlgorithm::execute(const AlgorithmContext& ctx) const {
                                     << firstInitialParameters);
 
     auto firstRootBranch = tracksTemp.makeTrack();
-    auto firstResult = (*m_cfg.findTracks)(firstInitialParameters, firstOptions,
-                                           tracksTemp, firstRootBranch);
-    nSeed++;
+    auto firstResult =
+        (*m_cfg.findTracks)(firstInitialParameters, state.firstOptions,
+                            tracksTemp, firstRootBranch);
 
     if (!firstResult.ok()) {
-      m_nFailedSeeds++;
+      ++result.nFailedSeeds;
       ACTS_WARNING("Track finding failed for seed " << iSeed << " with error"
                                                     << firstResult.error());
-      continue;
+      return result;
     }
 
     auto& firstTracksForSeed = firstResult.value();
+    if (m_cfg.compactTrackStates) {
+      std::vector<Acts::TrackIndexType> firstTrackIndices;
+      firstTrackIndices.reserve(firstTracksForSeed.size());
+      for (const auto& firstTrack : firstTracksForSeed) {
+        firstTrackIndices.push_back(firstTrack.index());
+      }
+      tracksTemp.compactTrackStates(firstTrackIndices);
+    }
+
     for (auto& firstTrack : firstTracksForSeed) {
       // TODO a copy of the track should not be necessary but is the safest way
       //      with the current EDM
@@ -504,7 +580,7 @@ ProcessCode TrackFindingAlgorithm::execute(const AlgorithmContext& ctx) const {
       Acts::Result<void> firstSmoothingResult{
           Acts::smoothTrack(ctx.geoContext, trackCandidate, logger())};
       if (!firstSmoothingResult.ok()) {
-        m_nFailedSmoothing++;
+        ++result.nFailedSmoothing;
         ACTS_ERROR("First smoothing for seed "
                    << iSeed << " and track " << firstTrack.index()
                    << " failed with error " << firstSmoothingResult.error());
@@ -514,10 +590,6 @@ ProcessCode TrackFindingAlgorithm::execute(const AlgorithmContext& ctx) const {
       // number of second tracks found
       std::size_t nSecond = 0;
 
-      // Set the seed number, this number decrease by 1 since the seed number
-      // has already been updated
-      seedNumber(trackCandidate) = nSeed - 1;
-
       if (m_cfg.twoWay) {
         std::optional<Acts::VectorMultiTrajectory::TrackStateProxy>
             firstMeasurementOpt;
@@ -541,7 +613,7 @@ ProcessCode TrackFindingAlgorithm::execute(const AlgorithmContext& ctx) const {
 
           if (!secondInitialParameters.referenceSurface().insideBounds(
                   secondInitialParameters.localPosition())) {
-            m_nSkippedSecondPass++;
+            ++result.nSkippedSecondPass;
             ACTS_DEBUG(
                 "Smoothing of first pass fit produced out-of-bounds parameters "
                 "relative to the surface. Skipping second pass.");
@@ -551,7 +623,7 @@ ProcessCode TrackFindingAlgorithm::execute(const AlgorithmContext& ctx) const {
           auto secondRootBranch = tracksTemp.makeTrack();
           secondRootBranch.copyFromWithoutStates(trackCandidate);
           auto secondResult =
-              (*m_cfg.findTracks)(secondInitialParameters, secondOptions,
+              (*m_cfg.findTracks)(secondInitialParameters, state.secondOptions,
                                   tracksTemp, secondRootBranch);
 
           if (!secondResult.ok()) {
@@ -602,7 +674,7 @@ ProcessCode TrackFindingAlgorithm::execute(const AlgorithmContext& ctx) const {
                 auto secondSmoothingResult =
                     Acts::smoothTrack(ctx.geoContext, trackCandidate, logger());
                 if (!secondSmoothingResult.ok()) {
-                  m_nFailedSmoothing++;
+                  ++result.nFailedSmoothing;
                   ACTS_ERROR("Second smoothing for seed "
                              << iSeed << " and track " << secondTrack.index()
                              << " failed with error "
@@ -620,7 +692,7 @@ ProcessCode TrackFindingAlgorithm::execute(const AlgorithmContext& ctx) const {
                         extrapolationOptions, m_cfg.extrapolationStrategy,
                         logger());
                 if (!secondExtrapolationResult.ok()) {
-                  m_nFailedExtrapolation++;
+                  ++result.nFailedExtrapolation;
                   ACTS_ERROR("Second extrapolation for seed "
                              << iSeed << " and track " << secondTrack.index()
                              << " failed with error "
@@ -654,7 +726,7 @@ ProcessCode TrackFindingAlgorithm::execute(const AlgorithmContext& ctx) const {
                 trackCandidate, *pSurface, extrapolator, extrapolationOptions,
                 m_cfg.extrapolationStrategy, logger());
         if (!firstExtrapolationResult.ok()) {
-          m_nFailedExtrapolation++;
+          ++result.nFailedExtrapolation;
           ACTS_ERROR("Extrapolation for seed "
                      << iSeed << " and track " << firstTrack.index()
                      << " failed with error "
@@ -665,6 +737,122 @@ ProcessCode TrackFindingAlgorithm::execute(const AlgorithmContext& ctx) const {
         addTrack(trackCandidate);
       }
     }
+
+    return result;
+  };
+
+  // Move the selected tracks of a seed to the output, flag the seeds which are
+  // covered by them and update the statistics
+  auto acceptSeed = [&](const SeedResult& result, TrackContainer& source) {
+    // The seed number counts all seeds which were not deduplicated
+    const unsigned int iSeedNumber = nSeed++;
+
+    for (Acts::TrackIndexType iTrack : result.tracks) {
+      auto track = source.getTrack(iTrack);
+      if (&source != &tracks) {
+        auto destProxy = tracks.makeTrack();
+        // make sure we copy track states!
+        destProxy.copyFrom(track);
+        track = destProxy;
+      }
+      seedNumber(track) = iSeedNumber;
+
+      // flag seeds which are covered by the track
+      visitSeedIdentifiers(track, [&](const SeedIdentifier& seedIdentifier) {
+        if (auto it = discoveredSeeds.find(seedIdentifier);
+            it != discoveredSeeds.end()) {
+          it->second = true;
+        }
+      });
+    }
+
+    m_nFailedSeeds += result.nFailedSeeds;
+    m_nFailedSmoothing += result.nFailedSmoothing;
+    m_nFailedExtrapolation += result.nFailedExtrapolation;
+    m_nFoundTracks += result.nFoundTracks;
+    m_nSelectedTracks += result.tracks.size();
+    m_nSkippedSecondPass += result.nSkippedSecondPass;
+  };
+
+  auto makeState = [&]() {
+    return std::make_unique<SeedProcessingState>(
+        m_cfg, slAccessor, calibrator, firstOptions, secondOptions);
+  };
+
+  if (!m_cfg.parallelSeeds) {
+    auto state = makeState();
+
+    for (std::size_t iSeed = 0; iSeed < initialParameters.size(); ++iSeed) {
+      m_nTotalSeeds++;
+
+      if (isDiscovered(iSeed)) {
+        m_nDeduplicatedSeeds++;
+        ACTS_VERBOSE("Skipping seed " << iSeed << " due to deduplication.");
+        continue;
+      }
+
+      acceptSeed(processSeed(iSeed, *state, tracks), tracks);
+    }
+  } else {
+    tbb::enumerable_thread_specific<std::unique_ptr<SeedProcessingState>>
+        states(makeState);
+
+    const std::size_t batchSize = std::max<std::size_t>(m_cfg.seedBatchSize, 1);
+    std::vector<std::size_t> batchSeeds;
+    std::vector<SeedResult> batchResults;
+    std::vector<TrackContainer*> batchOutputs;
+
+    for (std::size_t batchBegin = 0; batchBegin < initialParameters.size();
+         batchBegin += batchSize) {
+      const std::size_t batchEnd =
+          std::min(batchBegin + batchSize, initialParameters.size());
+
+      // Seeds covered by tracks of earlier batches are not processed at all
+      batchSeeds.clear();
+      for (std::size_t iSeed = batchBegin; iSeed < batchEnd; ++iSeed) {
+        m_nTotalSeeds++;
+
+        if (isDiscovered(iSeed)) {
+          m_nDeduplicatedSeeds++;
+          ACTS_VERBOSE("Skipping seed " << iSeed << " due to deduplication.");
+          continue;
+        }
+
+        batchSeeds.push_back(iSeed);
+      }
+
+      batchResults.assign(batchSeeds.size(), SeedResult{});
+      batchOutputs.assign(batchSeeds.size(), nullptr);
+
+      tbbWrap::parallel_for(
+          tbb::blocked_range<std::size_t>(0, batchSeeds.size()),
+          [&](const tbb::blocked_range<std::size_t>& range) {
+            SeedProcessingState& state = *states.local();
+            for (std::size_t i = range.begin(); i != range.end(); ++i) {
+              batchResults[i] =
+                  processSeed(batchSeeds[i], state, state.tracksOutput);
+              batchOutputs[i] = &state.tracksOutput;
+            }
+          });
+
+      // Merge in seed order. Seeds covered by tracks of earlier seeds in the
+      // same batch are dropped here, as the sequential loop would have
+      // skipped them.
+      for (std::size_t i = 0; i < batchSeeds.size(); ++i) {
+        if (isDiscovered(batchSeeds[i])) {
+          m_nDeduplicatedSeeds++;
+          ACTS_VERBOSE("Skipping seed " << batchSeeds[i]
+                                        << " due to deduplication.");
+          continue;
+        }
+
+        acceptSeed(batchResults[i], *batchOutputs[i]);
+      }
+
+      for (auto& state : states) {
+        state->tracksOutput.clear();
+      }
+    }
   }
 
   // Compute shared hits from all the reconstructed tracks
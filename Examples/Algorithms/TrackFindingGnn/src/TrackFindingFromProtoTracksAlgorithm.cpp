@@ -108,6 +108,9 @@ ProcessCode TrackFindingFromProtoTracksAlgorithm::execute(
       .connect<&MeasurementCalibratorAdapter::calibrate>(&calibrator);
   trackStateCreator.measurementSelector.connect<&MeasurementSelector::select<
       typename TrackContainer::TrackStateContainerBackend>>(&measSel);
+  // Keep the temporary measurement candidates out of the output trajectory
+  TrackContainer::TrackStateContainerBackend candidateTrajectory;
+  trackStateCreator.candidateTrajectory = &candidateTrajectory;
 
   CombinatorialKalmanFilterExtensions<TrackContainer> extensions;
   extensions.updater.connect<&GainMatrixUpdater::operator()<
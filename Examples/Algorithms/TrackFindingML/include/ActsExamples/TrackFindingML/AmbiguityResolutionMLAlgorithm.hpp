@@ -38,6 +38,13 @@ class AmbiguityResolutionMLAlgorithm final : public IAlgorithm {
     std::string outputTracks;
     /// Minimum number of measurement to form a track.
     std::size_t nMeasurementsMin = 7;
+    /// Combine the network inputs of concurrent events into shared batches
+    bool batchedInference = false;
+    /// Maximum number of tracks per batched inference call
+    std::size_t maxBatchSize = 4096;
+    /// Maximum time in milliseconds an event waits for other events to join
+    /// its inference batch
+    double maxBatchLatency = 1.;
     /// Construct the ML ambiguity resolution configuration.
     AmbiguityResolution::Config toAmbiguityResolutionMLConfig() const {
       return {inputDuplicateNN, nMeasurementsMin};
@@ -57,6 +64,9 @@ class AmbiguityResolutionMLAlgorithm final : public IAlgorithm {
   /// @return a process code indication success or failure
   ProcessCode execute(const AlgorithmContext& ctx) const final;
 
+  /// Report the statistics of the batched inference
+  ProcessCode finalize() final;
+
   /// Const access to the config
   const Config& config() const { return m_cfg; }
 
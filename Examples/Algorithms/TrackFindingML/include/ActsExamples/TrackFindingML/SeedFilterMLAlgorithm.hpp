@@ -51,6 +51,13 @@ class SeedFilterMLAlgorithm : public IAlgorithm {
     double clusteringWeighZ = 50.0;
     /// Clustering parameters weight for pT used before the DBSCAN
     double clusteringWeighPt = 1.0;
+    /// Combine the network inputs of concurrent events into shared batches
+    bool batchedInference = false;
+    /// Maximum number of seeds per batched inference call
+    std::size_t maxBatchSize = 4096;
+    /// Maximum time in milliseconds an event waits for other events to join
+    /// its inference batch
+    double maxBatchLatency = 1.;
   };
 
   /// Construct the seed filter algorithm.
@@ -66,6 +73,9 @@ class SeedFilterMLAlgorithm : public IAlgorithm {
   /// @return a process code indication success or failure
   ProcessCode execute(const AlgorithmContext& ctx) const final;
 
+  /// Report the statistics of the batched inference
+  ProcessCode finalize() final;
+
   /// Const access to the config
   const Config& config() const { return m_cfg; }
 
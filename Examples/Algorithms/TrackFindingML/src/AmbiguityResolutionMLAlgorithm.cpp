@@ -12,6 +12,7 @@
 #include "ActsExamples/EventData/Measurement.hpp"
 #include "ActsExamples/Framework/ProcessCode.hpp"
 
+#include <chrono>
 #include <iterator>
 #include <map>
 
@@ -30,13 +31,31 @@ static bool sourceLinkEquality(const SourceLink& a, const SourceLink& b) {
   return a.get<IndexSourceLink>().index() == b.get<IndexSourceLink>().index();
 }
 
+template <typename ambiguity_resolution_t>
+ambiguity_resolution_t makeAmbiguityResolution(
+    const AmbiguityResolutionMLAlgorithm::Config& cfg,
+    std::unique_ptr<const Logger> logger) {
+  if (!cfg.batchedInference) {
+    return ambiguity_resolution_t(cfg.toAmbiguityResolutionMLConfig(),
+                                  std::move(logger));
+  }
+  OnnxInferenceService::Config batchConfig;
+  batchConfig.maxBatchSize = cfg.maxBatchSize;
+  batchConfig.maxLatency =
+      std::chrono::duration_cast<std::chrono::microseconds>(
+          std::chrono::duration<double, std::milli>(cfg.maxBatchLatency));
+  return ambiguity_resolution_t(cfg.toAmbiguityResolutionMLConfig(),
+                                std::move(logger), batchConfig);
+}
+
 }  // namespace
 
 AmbiguityResolutionMLAlgorithm::AmbiguityResolutionMLAlgorithm(
     const Config& cfg, std::unique_ptr<const Acts::Logger> logger)
     : IAlgorithm("AmbiguityResolutionMLAlgorithm", std::move(logger)),
       m_cfg(cfg),
-      m_ambiML(m_cfg.toAmbiguityResolutionMLConfig(), this->logger().clone()) {
+      m_ambiML(makeAmbiguityResolution<AmbiguityResolution>(
+          m_cfg, this->logger().clone())) {
   if (m_cfg.inputTracks.empty()) {
     throw std::invalid_argument("Missing trajectories input collection");
   }
@@ -81,4 +100,12 @@ ProcessCode AmbiguityResolutionMLAlgorithm::execute(
   return ProcessCode::SUCCESS;
 }
 
+ProcessCode AmbiguityResolutionMLAlgorithm::finalize() {
+  if (const auto* service = m_ambiML.network().inferenceService();
+      service != nullptr) {
+    ACTS_INFO("Batched inference: " << service->statistics());
+  }
+  return ProcessCode::SUCCESS;
+}
+
 }  // namespace ActsExamples
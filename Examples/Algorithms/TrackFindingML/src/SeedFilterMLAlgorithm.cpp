@@ -10,16 +10,34 @@
 
 #include "ActsExamples/TrackFindingML/SeedFilterDBScanClustering.hpp"
 
+#include <chrono>
+
 using namespace Acts;
 using namespace ActsPlugins;
 
 namespace ActsExamples {
 
+namespace {
+
+SeedClassifier makeSeedClassifier(const SeedFilterMLAlgorithm::Config& cfg) {
+  if (!cfg.batchedInference) {
+    return SeedClassifier(cfg.inputSeedFilterNN.c_str());
+  }
+  OnnxInferenceService::Config batchConfig;
+  batchConfig.maxBatchSize = cfg.maxBatchSize;
+  batchConfig.maxLatency =
+      std::chrono::duration_cast<std::chrono::microseconds>(
+          std::chrono::duration<double, std::milli>(cfg.maxBatchLatency));
+  return SeedClassifier(cfg.inputSeedFilterNN.c_str(), batchConfig);
+}
+
+}  // namespace
+
 SeedFilterMLAlgorithm::SeedFilterMLAlgorithm(
     const Config& cfg, std::unique_ptr<const Acts::Logger> logger)
     : IAlgorithm("SeedFilterMLAlgorithm", std::move(logger)),
       m_cfg(cfg),
-      m_seedClassifier(m_cfg.inputSeedFilterNN.c_str()) {
+      m_seedClassifier(makeSeedClassifier(m_cfg)) {
   if (m_cfg.inputTrackParameters.empty()) {
     throw std::invalid_argument("Missing track parameters input collection");
   }
@@ -105,4 +123,12 @@ ProcessCode SeedFilterMLAlgorithm::execute(const AlgorithmContext& ctx) const {
   return ProcessCode::SUCCESS;
 }
 
+ProcessCode SeedFilterMLAlgorithm::finalize() {
+  if (const auto* service = m_seedClassifier.inferenceService();
+      service != nullptr) {
+    ACTS_INFO("Batched inference: " << service->statistics());
+  }
+  return ProcessCode::SUCCESS;
+}
+
 }  // namespace ActsExamples
@@ -13,6 +13,9 @@
 #include "ActsExamples/DetectorCommons/AlignmentContext.hpp"
 
 #include <any>
+#include <atomic>
+#include <cstddef>
+#include <limits>
 
 namespace ActsExamples {
 
@@ -33,8 +36,7 @@ class Aligned : public DetectorElement {
     if (gctx.hasValue()) {
       const auto* alignmentContext = gctx.maybeGet<AlignmentContext>();
       if (alignmentContext != nullptr && alignmentContext->store != nullptr) {
-        const auto* transform =
-            alignmentContext->store->contextualTransform(this->surface());
+        const auto* transform = alignedTransform(*alignmentContext->store);
         // The store may only have a subset of surfaces registered
         if (transform != nullptr) {
           return *transform;
@@ -44,6 +46,27 @@ class Aligned : public DetectorElement {
     // If no alignment context is available, return the nominal transform
     return DetectorElement::nominalTransform();
   }
+
+ private:
+  static constexpr std::size_t s_noIndex =
+      std::numeric_limits<std::size_t>::max();
+
+  /// Look up the transform, by the cached dense index if the store has one
+  const Acts::Transform3* alignedTransform(const IAlignmentStore& store) const {
+    std::size_t index = m_denseIndex.load(std::memory_order_relaxed);
+    if (index == s_noIndex) {
+      const auto storeIndex = store.denseIndex(this->surface());
+      if (!storeIndex.has_value()) {
+        return store.contextualTransform(this->surface());
+      }
+      index = *storeIndex;
+      m_denseIndex.store(index, std::memory_order_relaxed);
+    }
+    return store.contextualTransformByIndex(this->surface(), index);
+  }
+
+  /// Dense index of the surface, resolved by the first indexed store
+  mutable std::atomic<std::size_t> m_denseIndex = s_noIndex;
 };
 
 }  // namespace ActsExamples
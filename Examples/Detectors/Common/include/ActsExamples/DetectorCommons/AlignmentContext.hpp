@@ -12,6 +12,8 @@
 #include "Acts/Geometry/GeometryIdentifier.hpp"
 #include "Acts/Surfaces/Surface.hpp"
 
+#include <cstddef>
+#include <optional>
 #include <unordered_map>
 
 namespace ActsExamples {
@@ -39,6 +41,32 @@ class IAlignmentStore {
   virtual const Acts::Transform3* contextualTransform(
       const Acts::Surface& surface) const = 0;
 
+  /// Dense index under which the store addresses a surface
+  ///
+  /// Detector elements may cache this index and pass it to the indexed
+  /// lookup below. The index only depends on the tracking geometry, so it is
+  /// the same for all stores of one geometry.
+  ///
+  /// @param surface the surface for which the index is requested
+  /// @return the index, or an empty optional if the store does not address
+  ///         surfaces by a dense index
+  virtual std::optional<std::size_t> denseIndex(
+      const Acts::Surface& surface) const {
+    static_cast<void>(surface);
+    return std::nullopt;
+  }
+
+  /// Retrieve the contextual transform for a surface by its dense index
+  ///
+  /// @param surface the surface for which the contextual transform is requested
+  /// @param index the dense index of the surface, as given by @ref denseIndex
+  /// @return a pointer to the transform if found, otherwise nullptr
+  virtual const Acts::Transform3* contextualTransformByIndex(
+      const Acts::Surface& surface, std::size_t index) const {
+    static_cast<void>(index);
+    return contextualTransform(surface);
+  }
+
   /// Visitor pattern to eventually generate an misalignment for demonstration
   /// purposes.
   /// @param visitor the visitor to be called with the store
@@ -52,6 +52,10 @@ class AlignmentDecorator : public IContextDecorator {
 
     /// Generation mode - this is for showcase examples where the alignment data
     /// is generated`
+    ///
+    /// Each generated IOV works on a clone of the nominal store, with a
+    /// DeltaAlignmentStore the clones share the blocks of transforms that
+    /// the generator does not modify.
     std::shared_ptr<IAlignmentStore> nominalStore =
         nullptr;  //!< The nominal alignment store
 
@@ -0,0 +1,123 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "ActsExamples/DetectorCommons/AlignmentContext.hpp"
+
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace Acts {
+class TrackingGeometry;
+}
+
+namespace ActsExamples {
+
+/// Alignment store that only holds the transforms of surfaces deviating from
+/// the nominal geometry.
+///
+/// The sensitive surfaces are addressed through the dense surface index of
+/// the tracking geometry. The transforms are stored in flat blocks of
+/// consecutive surfaces, and blocks without any aligned surface are not
+/// allocated at all. Surfaces without an aligned transform fall back to
+/// their nominal transform.
+///
+/// Cloning a store shares all blocks with the original, a block is only
+/// copied when one of its transforms is modified. Stores for different
+/// intervals of validity which are derived from a common store therefore
+/// only duplicate the blocks which actually differ.
+///
+/// Aligned detector elements cache their dense index on the first lookup,
+/// so that later lookups only access the block. A lookup by surface alone
+/// costs one hash of the geometry id into the dense index, as in the
+/// GeoIdAlignmentStore.
+class DeltaAlignmentStore final : public IAlignmentStore {
+ public:
+  /// Number of consecutive surfaces sharing one copy-on-write block
+  static constexpr std::size_t s_blockSize = 64;
+
+  /// Constructor of an empty store, i.e. the nominal geometry
+  /// @param trackingGeometry the geometry providing the dense surface index
+  explicit DeltaAlignmentStore(
+      std::shared_ptr<const Acts::TrackingGeometry> trackingGeometry);
+
+  /// Constructor from aligned transforms of sensitive surfaces
+  /// @param trackingGeometry the geometry providing the dense surface index
+  /// @param transformMap the aligned transforms by geometry id
+  DeltaAlignmentStore(
+      std::shared_ptr<const Acts::TrackingGeometry> trackingGeometry,
+      const std::unordered_map<Acts::GeometryIdentifier, Acts::Transform3>&
+          transformMap);
+
+  /// @copydoc IAlignmentStore::clone
+  std::shared_ptr<IAlignmentStore> clone() const override;
+
+  /// @copydoc IAlignmentStore::contextualTransform
+  const Acts::Transform3* contextualTransform(
+      const Acts::Surface& surface) const override;
+
+  /// @copydoc IAlignmentStore::denseIndex
+  std::optional<std::size_t> denseIndex(
+      const Acts::Surface& surface) const override;
+
+  /// @copydoc IAlignmentStore::contextualTransformByIndex
+  const Acts::Transform3* contextualTransformByIndex(
+      const Acts::Surface& surface, std::size_t index) const override;
+
+  /// Visit the transforms of all indexed sensitive surfaces
+  ///
+  /// Every surface is visited with a copy of its current transform, which is
+  /// the nominal one for surfaces without an aligned transform. Only
+  /// transforms changed by the visitor are stored, so blocks the visitor
+  /// leaves untouched stay shared with other stores.
+  ///
+  /// @param visitor the visitor to be called with the transforms
+  void visitStore(
+      const std::function<void(Acts::Transform3*)>& visitor) override;
+
+  /// Set the aligned transform of a sensitive surface
+  /// @param geometryId the geometry id of the surface
+  /// @param transform the aligned transform
+  void setTransform(Acts::GeometryIdentifier geometryId,
+                    const Acts::Transform3& transform);
+
+  /// Number of surfaces with an aligned transform
+  /// @return the number of aligned surfaces
+  std::size_t numAlignedSurfaces() const;
+
+  /// Number of allocated blocks, including those shared with other stores
+  /// @return the number of allocated blocks
+  std::size_t numBlocks() const;
+
+  /// Number of allocated blocks which are shared with other stores
+  /// @return the number of shared blocks
+  std::size_t numSharedBlocks() const;
+
+ private:
+  struct Block {
+    std::array<Acts::Transform3, s_blockSize> transforms;
+    std::bitset<s_blockSize> aligned;
+  };
+
+  /// Access a block for modification, copying it if it is shared
+  Block& mutableBlock(std::size_t blockIndex);
+
+  std::shared_ptr<const Acts::TrackingGeometry> m_trackingGeometry;
+  std::vector<std::shared_ptr<Block>> m_blocks;
+};
+
+}  // namespace ActsExamples
@@ -0,0 +1,149 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/DetectorCommons/DeltaAlignmentStore.hpp"
+
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/TrackingGeometry.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+
+namespace ActsExamples {
+
+DeltaAlignmentStore::DeltaAlignmentStore(
+    std::shared_ptr<const Acts::TrackingGeometry> trackingGeometry)
+    : m_trackingGeometry(std::move(trackingGeometry)) {
+  if (m_trackingGeometry == nullptr) {
+    throw std::invalid_argument("DeltaAlignmentStore: no tracking geometry");
+  }
+  const std::size_t nSurfaces = m_trackingGeometry->numSensitiveSurfaces();
+  m_blocks.resize((nSurfaces + s_blockSize - 1) / s_blockSize);
+}
+
+DeltaAlignmentStore::DeltaAlignmentStore(
+    std::shared_ptr<const Acts::TrackingGeometry> trackingGeometry,
+    const std::unordered_map<Acts::GeometryIdentifier, Acts::Transform3>&
+        transformMap)
+    : DeltaAlignmentStore(std::move(trackingGeometry)) {
+  for (const auto& [geometryId, transform] : transformMap) {
+    setTransform(geometryId, transform);
+  }
+}
+
+std::shared_ptr<IAlignmentStore> DeltaAlignmentStore::clone() const {
+  // Copies the block pointers only, the blocks are copied on write
+  return std::make_shared<DeltaAlignmentStore>(*this);
+}
+
+const Acts::Transform3* DeltaAlignmentStore::contextualTransform(
+    const Acts::Surface& surface) const {
+  const auto index = denseIndex(surface);
+  if (!index.has_value()) {
+    return nullptr;
+  }
+  return contextualTransformByIndex(surface, *index);
+}
+
+std::optional<std::size_t> DeltaAlignmentStore::denseIndex(
+    const Acts::Surface& surface) const {
+  return m_trackingGeometry->indexOf(surface.geometryId());
+}
+
+const Acts::Transform3* DeltaAlignmentStore::contextualTransformByIndex(
+    const Acts::Surface& /*surface*/, std::size_t index) const {
+  if (index >= m_trackingGeometry->numSensitiveSurfaces()) {
+    return nullptr;
+  }
+  const Block* block = m_blocks[index / s_blockSize].get();
+  const std::size_t slot = index % s_blockSize;
+  if (block == nullptr || !block->aligned.test(slot)) {
+    return nullptr;
+  }
+  return &block->transforms[slot];
+}
+
+void DeltaAlignmentStore::visitStore(
+    const std::function<void(Acts::Transform3*)>& visitor) {
+  const auto gctx = Acts::GeometryContext::dangerouslyDefaultConstruct();
+  const std::size_t nSurfaces = m_trackingGeometry->numSensitiveSurfaces();
+  for (std::size_t index = 0; index < nSurfaces; ++index) {
+    const std::size_t blockIndex = index / s_blockSize;
+    const std::size_t slot = index % s_blockSize;
+    const Block* block = m_blocks[blockIndex].get();
+    const bool aligned = block != nullptr && block->aligned.test(slot);
+
+    // Visit a copy, so that unchanged transforms neither copy a shared block
+    // nor allocate a new one
+    const Acts::Transform3 current =
+        aligned ? block->transforms[slot]
+                : m_trackingGeometry->surfaceByIndex(index)
+                      ->localToGlobalTransform(gctx);
+    Acts::Transform3 visited = current;
+    visitor(&visited);
+    if (visited.matrix() == current.matrix()) {
+      continue;
+    }
+
+    Block& mutated = mutableBlock(blockIndex);
+    mutated.transforms[slot] = visited;
+    mutated.aligned.set(slot);
+  }
+}
+
+void DeltaAlignmentStore::setTransform(Acts::GeometryIdentifier geometryId,
+                                       const Acts::Transform3& transform) {
+  const auto index = m_trackingGeometry->indexOf(geometryId);
+  if (!index.has_value()) {
+    std::stringstream msg;
+    msg << "DeltaAlignmentStore: " << geometryId
+        << " is not an indexed sensitive surface";
+    throw std::invalid_argument(msg.str());
+  }
+  Block& block = mutableBlock(*index / s_blockSize);
+  const std::size_t slot = *index % s_blockSize;
+  block.transforms[slot] = transform;
+  block.aligned.set(slot);
+}
+
+std::size_t DeltaAlignmentStore::numAlignedSurfaces() const {
+  std::size_t nAligned = 0;
+  for (const auto& block : m_blocks) {
+    if (block != nullptr) {
+      nAligned += block->aligned.count();
+    }
+  }
+  return nAligned;
+}
+
+std::size_t DeltaAlignmentStore::numBlocks() const {
+  return std::ranges::count_if(
+      m_blocks, [](const auto& block) { return block != nullptr; });
+}
+
+std::size_t DeltaAlignmentStore::numSharedBlocks() const {
+  return std::ranges::count_if(m_blocks, [](const auto& block) {
+    return block != nullptr && block.use_count() > 1;
+  });
+}
+
+DeltaAlignmentStore::Block& DeltaAlignmentStore::mutableBlock(
+    std::size_t blockIndex) {
+  std::shared_ptr<Block>& block = m_blocks[blockIndex];
+  if (block == nullptr) {
+    block = std::make_shared<Block>();
+  } else if (block.use_count() > 1) {
+    // Another store still refers to this block
+    block = std::make_shared<Block>(*block);
+  }
+  return *block;
+}
+
+}  // namespace ActsExamples
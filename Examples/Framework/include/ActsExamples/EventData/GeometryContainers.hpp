@@ -9,13 +9,16 @@
 #pragma once
 
 #include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/Geometry/TrackingGeometry.hpp"
 #include "Acts/Utilities/PointerTraits.hpp"
 #include "ActsExamples/Utilities/GroupBy.hpp"
 #include "ActsExamples/Utilities/Range.hpp"
 
 #include <algorithm>
 #include <cassert>
+#include <cstddef>
 #include <utility>
+#include <vector>
 
 #include <boost/bimap.hpp>
 #include <boost/container/flat_map.hpp>
@@ -250,6 +253,45 @@ groupByModule(const GeometryIdMultiset<T>& container) {
   return makeGroupBy(container, detail::GeometryIdGetter());
 }
 
+/// Bucket the elements by the dense sensitive surface index of a geometry.
+///
+/// `buckets` is resized to one entry per sensitive surface of the tracking
+/// geometry and entry `i` holds the elements on the surface with dense index
+/// `i`, see `Acts::TrackingGeometry::indexOf`. Only the entries listed in
+/// `occupied` are expected to be non-empty on input, they are reset first so
+/// the vectors can be reused between calls without touching every surface.
+/// On output `occupied` lists the dense indices of the surfaces with elements.
+/// The ranges point into the container and are invalidated together with its
+/// iterators.
+///
+/// @note Elements that do not belong to an indexed sensitive surface are not
+///   contained in any bucket.
+template <typename T>
+inline void bucketBySurfaceIndex(
+    const GeometryIdMultiset<T>& container,
+    const Acts::TrackingGeometry& geometry,
+    std::vector<std::size_t>& occupied,
+    std::vector<Range<typename GeometryIdMultiset<T>::const_iterator>>&
+        buckets) {
+  using Iterator = typename GeometryIdMultiset<T>::const_iterator;
+
+  const Range<Iterator> empty(Iterator{}, Iterator{});
+  if (buckets.size() != geometry.numSensitiveSurfaces()) {
+    buckets.assign(geometry.numSensitiveSurfaces(), empty);
+  } else {
+    for (std::size_t index : occupied) {
+      buckets[index] = empty;
+    }
+  }
+  occupied.clear();
+  for (auto [geoId, elements] : groupByModule(container)) {
+    if (auto index = geometry.indexOf(geoId); index.has_value()) {
+      buckets[*index] = elements;
+      occupied.push_back(*index);
+    }
+  }
+}
+
 /// The accessor for the GeometryIdMultiset container
 ///
 /// It wraps up a few lookup methods to be used in the Combinatorial Kalman
@@ -263,6 +305,42 @@ struct GeometryIdMultisetAccessor {
 
   // pointer to the container
   const Container* container = nullptr;
+  // optional geometry and per-surface buckets for constant time lookup
+  const Acts::TrackingGeometry* geometry = nullptr;
+  std::vector<std::size_t> occupied;
+  std::vector<Range<Iterator>> buckets;
+
+  /// Bucket the container by the dense surface index of the geometry.
+  ///
+  /// The lookup of an indexed sensitive surface is then a hash lookup of its
+  /// dense index and a vector access instead of a binary search over all
+  /// elements. Must be called after the container has been set and again
+  /// whenever it changes. Repeated calls with the same geometry only reset
+  /// the previously occupied buckets.
+  void bucketBySurfaceIndex(const Acts::TrackingGeometry& tGeometry) {
+    assert(container != nullptr);
+    if (geometry != &tGeometry) {
+      buckets.clear();
+    }
+    geometry = &tGeometry;
+    ActsExamples::bucketBySurfaceIndex(*container, tGeometry, occupied,
+                                       buckets);
+  }
+
+  // get the range of elements with requested geoId
+  Range<Iterator> rangeOf(Acts::GeometryIdentifier geoId) const {
+    assert(container != nullptr);
+    if (geometry != nullptr) {
+      if (auto index = geometry->indexOf(geoId); index.has_value()) {
+        const Range<Iterator>& bucket = buckets[*index];
+        if (bucket.empty()) {
+          return makeRange(container->end(), container->end());
+        }
+        return bucket;
+      }
+    }
+    return makeRange(container->equal_range(geoId));
+  }
 };
 
 /// A map that allows mapping back and forth between ACTS and Athena Geometry
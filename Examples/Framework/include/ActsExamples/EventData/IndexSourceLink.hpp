@@ -81,9 +81,8 @@ struct IndexSourceLinkAccessor : GeometryIdMultisetAccessor<IndexSourceLink> {
 
   // get the range of elements with requested geoId
   std::pair<Iterator, Iterator> range(const Acts::Surface& surface) const {
-    assert(container != nullptr);
-    auto [begin, end] = container->equal_range(surface.geometryId());
-    return {Iterator{begin}, Iterator{end}};
+    auto elements = rangeOf(surface.geometryId());
+    return {Iterator{elements.begin()}, Iterator{elements.end()}};
   }
 };
 
@@ -0,0 +1,103 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Utilities/Logger.hpp"
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Framework/IWriter.hpp"
+#include "ActsExamples/Framework/ProcessCode.hpp"
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace ActsExamples {
+
+class WhiteBoard;
+
+/// Event data writer that takes a concrete writer instance and moves its
+/// file I/O out of the event loop.
+///
+/// For every event, the content of the event store is snapshotted into a new
+/// white board, which only shares the stored objects and does not copy them.
+/// The snapshot is pushed into a bounded queue that is drained by a dedicated
+/// I/O thread calling the downstream writer. If the queue is full, the event
+/// loop waits until the I/O thread caught up. All queued events are written
+/// before the downstream writer is finalized.
+///
+/// @note The objects read by the downstream writer must not be consumed by
+///       a later sequence element, since consuming moves them out of the
+///       shared storage.
+class AsyncWriter final : public IWriter {
+ public:
+  struct Config {
+    /// The downstream writer that performs the actual I/O
+    std::shared_ptr<IWriter> downstreamWriter;
+
+    /// Maximum number of events waiting to be written
+    std::size_t queueSize = 16;
+  };
+
+  /// Construct the writer
+  AsyncWriter(const Config& config, Acts::Logging::Level level);
+
+  ~AsyncWriter() override;
+
+  /// Return the config
+  const Config& config() const { return m_cfg; }
+
+  /// Give the writer a understandable name
+  std::string name() const override {
+    return "Async" + m_cfg.downstreamWriter->name();
+  }
+
+  /// Initialize the downstream writer and start the I/O thread
+  ProcessCode initialize() override;
+
+  /// Write all queued events and finalize the downstream writer
+  ProcessCode finalize() override;
+
+  /// Forwarded to the downstream writer
+  ProcessCode beginEvent(std::size_t threadId) override;
+
+  /// Queue the event for writing
+  ProcessCode write(const AlgorithmContext& ctx) override;
+
+ private:
+  struct PendingEvent {
+    std::unique_ptr<WhiteBoard> store;
+    std::unique_ptr<AlgorithmContext> context;
+  };
+
+  /// Body of the I/O thread
+  void drainQueue();
+
+  /// Stop the I/O thread after it has written all queued events
+  void stopThread();
+
+  Config m_cfg;
+  std::unique_ptr<const Acts::Logger> m_logger;
+
+  std::mutex m_queueMutex;
+  std::condition_variable m_queueNotEmpty;
+  std::condition_variable m_queueNotFull;
+  std::deque<PendingEvent> m_queue;
+  bool m_stop = false;
+  std::exception_ptr m_error;
+  std::thread m_thread;
+
+  const Acts::Logger& logger() const { return *m_logger; }
+};
+
+}  // namespace ActsExamples
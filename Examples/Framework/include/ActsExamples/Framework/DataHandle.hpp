@@ -13,6 +13,7 @@
 #include "ActsExamples/Framework/SequenceElement.hpp"
 #include "ActsExamples/Framework/WhiteBoard.hpp"
 
+#include <optional>
 #include <stdexcept>
 #include <typeinfo>
 #include <unordered_map>
@@ -70,39 +71,77 @@ class DataHandleBase {
 
   std::string fullName() const { return m_parent->name() + "." + name(); }
 
+  /// Resolve the key to a slot index of white boards built with @p table.
+  ///
+  /// Access to such white boards then uses the slot directly instead of the
+  /// key. Handles without a key or whose key is not in the table keep using
+  /// the key.
+  void resolveSlot(const WhiteBoard::SlotTable& table) const;
+
  protected:
   void registerAsWriteHandle();
   void registerAsReadHandle();
 
+  /// The resolved slot if @p wb uses the table this handle was resolved with
+  std::optional<std::size_t> slotIn(const WhiteBoard& wb) const {
+    if (m_slotTable != nullptr && wb.slotTable() == m_slotTable) {
+      return m_slot;
+    }
+    return std::nullopt;
+  }
+
   // Trampoline functions to avoid having the WhiteBoard as a friend
   template <typename T>
   const T& add(WhiteBoard& wb, T&& object) const {
+    if (auto slot = slotIn(wb)) {
+      wb.addToSlot(*slot,
+                   std::make_shared<Acts::AnyMoveOnly>(std::forward<T>(object)),
+                   Acts::typeHash<T>());
+      return wb.getFromSlot<T>(*slot);
+    }
     return wb.add(m_key.value(), std::forward<T>(object));
   }
 
   template <typename T>
   const T& get(const WhiteBoard& wb) const {
+    if (auto slot = slotIn(wb)) {
+      return wb.getFromSlot<T>(*slot);
+    }
     return wb.get<T>(m_key.value());
   }
 
   template <typename T>
   T pop(WhiteBoard& wb) const {
+    if (auto slot = slotIn(wb)) {
+      return wb.popFromSlot<T>(*slot);
+    }
     return wb.pop<T>(m_key.value());
   }
 
   std::pair<Acts::AnyMoveOnly*, std::uint64_t> getHolder(
       const WhiteBoard& wb) const {
+    if (auto slot = slotIn(wb)) {
+      return wb.slotHolder(*slot);
+    }
     return wb.getHolder(m_key.value());
   }
 
   void addHolder(WhiteBoard& wb, std::unique_ptr<Acts::AnyMoveOnly> holder,
                  std::uint64_t typeHash) const {
+    if (auto slot = slotIn(wb)) {
+      wb.addToSlot(*slot, std::shared_ptr<Acts::AnyMoveOnly>(std::move(holder)),
+                   typeHash);
+      return;
+    }
     wb.addHolder(m_key.value(), std::move(holder), typeHash);
   }
 
   SequenceElement* m_parent{nullptr};
   std::string m_name;
   std::optional<std::string> m_key{};
+  // Resolved once by the sequencer before the event loop, hence mutable
+  mutable const WhiteBoard::SlotTable* m_slotTable = nullptr;
+  mutable std::size_t m_slot = 0;
 };
 
 /// Base class for write data handles.
@@ -50,6 +50,8 @@ class SequenceElement {
   friend class DataHandleBase;
 
   friend class BufferedReader;
+  friend class AsyncWriter;
+  friend class RootPerThreadWriter;
 
   std::vector<const DataHandleBase*> m_writeHandles;
   std::vector<const DataHandleBase*> m_readHandles;
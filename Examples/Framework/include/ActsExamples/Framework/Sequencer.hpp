@@ -51,6 +51,16 @@ class SequenceConfigurationException : public std::runtime_error {
 /// back to a file.
 class Sequencer {
  public:
+  /// Execution semantics of a stage in the pipelined event loop.
+  enum class StageMode {
+    /// Events are processed concurrently
+    Parallel,
+    /// One event at a time, in the order of the event numbers
+    SerialInOrder,
+    /// One event at a time, in any order
+    SerialOutOfOrder,
+  };
+
   struct FpeMask {
     std::string file;
     std::pair<std::size_t, std::size_t> lines;
@@ -88,6 +98,30 @@ class Sequencer {
     bool failOnUnmaskedFpe = true;
     /// The number of stack frames to include in the FPE report.
     std::size_t fpeStackTraceLength = 8;
+    /// If true, the sequence elements of one event are scheduled as a task
+    /// graph derived from their data handles, so that elements without a data
+    /// dependency on each other can run concurrently. Only has an effect in
+    /// multi-threaded mode.
+    bool dataFlowScheduling = false;
+    /// If non-zero, events are processed in a pipeline of a reader, an
+    /// algorithm and a writer stage with at most this many events in flight.
+    /// This bounds the number of white boards alive at the same time. Only has
+    /// an effect in multi-threaded mode and can not be combined with data flow
+    /// scheduling.
+    std::size_t maxInFlightEvents = 0;
+    /// Execution semantics of the reader stage in pipeline mode
+    StageMode readerStageMode = StageMode::Parallel;
+    /// Execution semantics of the algorithm stage in pipeline mode
+    StageMode algorithmStageMode = StageMode::Parallel;
+    /// Execution semantics of the writer stage in pipeline mode. Serial
+    /// writing avoids that worker threads block on the writer mutexes.
+    StageMode writerStageMode = StageMode::SerialInOrder;
+    /// If true, all data handle keys are resolved to fixed white board slots
+    /// before the event loop and the per-event white boards are allocated
+    /// once per concurrently processed event (or pipeline slot) and reused
+    /// for subsequent events.
+    /// This reduces the per-event overhead for small events.
+    bool whiteBoardSlots = false;
   };
 
   explicit Sequencer(const Config &cfg);
@@ -161,6 +195,19 @@ class Sequencer {
   /// [std::numeric_limits<std::size_t>::max(),
   /// std::numeric_limits<std::size_t>::max()) for error.
   std::pair<std::size_t, std::size_t> determineEventsRange() const;
+  /// Derive the data dependencies between the sequence elements from their
+  /// read, consume and write handles.
+  /// @return for each sequence element the indices of the elements that
+  ///         have to be executed before it
+  std::vector<std::vector<std::size_t>> buildDataFlowGraph() const;
+  /// Assign each sequence element to a stage of the pipelined event loop
+  /// (0: readers, 1: algorithms, 2: writers).
+  /// @throws SequenceConfigurationException if an element depends on an
+  ///         element in a later stage
+  std::vector<std::size_t> assignPipelineStages() const;
+  /// Assign a white board slot to every key written or read by the sequence
+  /// elements and resolve their data handles to these slots.
+  std::shared_ptr<const WhiteBoard::SlotTable> resolveWhiteBoardSlots() const;
 
   std::pair<std::string, std::size_t> fpeMaskCount(
       const boost::stacktrace::stacktrace &st, ActsPlugins::FpeType type) const;
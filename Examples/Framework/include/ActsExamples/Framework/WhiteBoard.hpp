@@ -13,8 +13,13 @@
 #include "Acts/Utilities/Logger.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -32,6 +37,17 @@ namespace ActsExamples {
 /// added to it. Once an object has been added, it can only be read but not
 /// be modified. Trying to replace an existing object is considered an error.
 /// Its lifetime is bound to the lifetime of the white board.
+///
+/// Adding, reading and removing objects is thread-safe, so that independent
+/// sequence elements of the same event can access the white board
+/// concurrently.
+///
+/// Optionally, the white board can be constructed with a slot table that
+/// assigns a fixed index to every key known in advance. Objects for these keys
+/// are kept in a preallocated vector of slots, which is accessed without
+/// locking, and data handles resolved against the same table skip the string
+/// lookup entirely. Such a white board can be cleared and reused for the next
+/// event. Keys not contained in the table use the string-keyed store.
 class WhiteBoard {
  public:
   struct StringHash {
@@ -50,10 +66,36 @@ class WhiteBoard {
   using AliasMapType = std::unordered_multimap<std::string, std::string,
                                                StringHash, std::equal_to<>>;
 
+  /// Fixed assignment of keys to slot indices, shared by all white boards of
+  /// a sequence.
+  struct SlotTable {
+    /// Slot index for every key, including aliases
+    std::unordered_map<std::string, std::size_t, StringHash, std::equal_to<>>
+        indices;
+    /// Key for every slot index
+    std::vector<std::string> names;
+    /// Alias slots that are filled together with each slot
+    std::vector<std::vector<std::size_t>> aliases;
+
+    /// Build the table for the given keys and their aliases.
+    ///
+    /// @param keys Keys that get a slot, duplicates are ignored
+    /// @param objectAliases Aliases of the keys, which get slots as well
+    static std::shared_ptr<const SlotTable> make(
+        const std::vector<std::string>& keys,
+        const AliasMapType& objectAliases);
+
+    /// Look up the slot index for a key, if it has one.
+    std::optional<std::size_t> find(std::string_view name) const;
+
+    std::size_t size() const { return names.size(); }
+  };
+
   explicit WhiteBoard(std::unique_ptr<const Acts::Logger> logger =
                           Acts::getDefaultLogger("WhiteBoard",
                                                  Acts::Logging::INFO),
-                      AliasMapType objectAliases = {});
+                      AliasMapType objectAliases = {},
+                      std::shared_ptr<const SlotTable> slotTable = nullptr);
 
   WhiteBoard(const WhiteBoard& other) = delete;
   WhiteBoard& operator=(const WhiteBoard&) = delete;
@@ -72,11 +114,65 @@ class WhiteBoard {
 
   std::vector<std::string> getKeys() const;
 
+  /// Remove all objects, so that the white board can be reused.
+  ///
+  /// The slots are kept allocated. Must not be called concurrently with any
+  /// other access.
+  void clear();
+
+  /// The slot table this white board was constructed with, can be null
+  const SlotTable* slotTable() const { return m_slotTable.get(); }
+
  private:
+  /// Slot state transitions: an empty slot is claimed for writing by a single
+  /// writer and published as filled once the holder is in place.
+  enum class SlotState : std::uint8_t { Empty, Busy, Filled };
+
+  struct Slot {
+    std::atomic<SlotState> state = SlotState::Empty;
+    std::shared_ptr<Acts::AnyMoveOnly> holder;
+    std::uint64_t typeHash = 0;
+  };
+
+  /// Store a value in a slot.
+  ///
+  /// @throws std::invalid_argument if the slot is already filled
+  void addToSlot(std::size_t slot,
+                 const std::shared_ptr<Acts::AnyMoveOnly>& holder,
+                 std::uint64_t typeHash);
+
+  /// Returns (pointer to stored value, type hash). Throws if not filled.
+  std::pair<Acts::AnyMoveOnly*, std::uint64_t> slotHolder(
+      std::size_t slot) const;
+
+  /// Take the value out of a slot and mark it empty. Throws if not filled.
+  std::shared_ptr<Acts::AnyMoveOnly> extractSlot(std::size_t slot);
+
+  template <typename T>
+  Acts::AnyMoveOnly* checkedHolder(const std::string& name,
+                                   Acts::AnyMoveOnly* holder,
+                                   std::uint64_t typeHash) const;
+
+  template <typename T>
+  const T& getFromSlot(std::size_t slot) const {
+    auto [holder, typeHash] = slotHolder(slot);
+    return checkedHolder<T>(m_slotTable->names[slot], holder, typeHash)
+        ->template as<T>();
+  }
+
+  template <typename T>
+  T popFromSlot(std::size_t slot) {
+    ACTS_VERBOSE("Pop object '" << m_slotTable->names[slot] << "'");
+    (void)getFromSlot<T>(slot);  // validates type and existence
+    return extractSlot(slot)->template take<T>();
+  }
+
+  [[noreturn]] void throwMissing(const std::string& name) const;
+
   /// Find similar names for suggestions with levenshtein-distance
-  std::vector<std::string_view> similarNames(const std::string_view& name,
-                                             int distThreshold,
-                                             std::size_t maxNumber) const;
+  std::vector<std::string> similarNames(const std::string_view& name,
+                                       int distThreshold,
+                                       std::size_t maxNumber) const;
 
   /// Store a value on the white board.
   ///
@@ -129,6 +225,14 @@ class WhiteBoard {
 
   AliasMapType m_objectAliases;
 
+  std::shared_ptr<const SlotTable> m_slotTable;
+  /// One slot per table entry; held by pointer since slots are not movable
+  std::unique_ptr<Slot[]> m_slots;
+
+  /// Guards the store; held by pointer to keep the white board movable
+  std::unique_ptr<std::shared_mutex> m_storeMutex =
+      std::make_unique<std::shared_mutex>();
+
   const Acts::Logger& logger() const { return *m_logger; }
 
   static std::string typeMismatchMessage(const std::string& name,
@@ -137,38 +241,38 @@ class WhiteBoard {
   friend class DataHandleBase;
 };
 
-inline WhiteBoard::WhiteBoard(std::unique_ptr<const Acts::Logger> logger,
-                              AliasMapType objectAliases)
-    : m_logger(std::move(logger)), m_objectAliases(std::move(objectAliases)) {}
-
 template <typename T>
-Acts::AnyMoveOnly* WhiteBoard::getHolder(const std::string& name) const {
-  auto it = m_store.find(name);
-  if (it == m_store.end()) {
-    const auto names = similarNames(name, 10, 3);
-
-    std::stringstream ss;
-    if (!names.empty()) {
-      ss << ", similar ones are: [ ";
-      for (std::size_t i = 0; i < std::min(3ul, names.size()); ++i) {
-        ss << "'" << names[i] << "' ";
-      }
-      ss << "]";
-    }
-
-    throw std::out_of_range("Object '" + name + "' does not exists" + ss.str());
-  }
-
-  auto& [holder, storedTypeHash] = it->second;
-  if (storedTypeHash != Acts::typeHash<T>()) {
+Acts::AnyMoveOnly* WhiteBoard::checkedHolder(const std::string& name,
+                                             Acts::AnyMoveOnly* holder,
+                                             std::uint64_t typeHash) const {
+  if (typeHash != Acts::typeHash<T>()) {
     const char* holderTypeName =
         holder->typeInfo() ? holder->typeInfo()->name() : "unknown";
     std::string msg =
         typeMismatchMessage(name, typeid(T).name(), holderTypeName);
     throw std::out_of_range(msg.c_str());
   }
+  return holder;
+}
+
+template <typename T>
+Acts::AnyMoveOnly* WhiteBoard::getHolder(const std::string& name) const {
+  if (m_slotTable != nullptr) {
+    if (auto slot = m_slotTable->find(name); slot.has_value()) {
+      auto [holder, typeHash] = slotHolder(*slot);
+      return checkedHolder<T>(name, holder, typeHash);
+    }
+  }
 
-  return holder.get();
+  std::shared_lock lock{*m_storeMutex};
+  auto it = m_store.find(name);
+  if (it == m_store.end()) {
+    lock.unlock();
+    throwMissing(name);
+  }
+
+  auto& [holder, storedTypeHash] = it->second;
+  return checkedHolder<T>(name, holder.get(), storedTypeHash);
 }
 
 template <typename T>
@@ -183,13 +287,34 @@ inline const T& WhiteBoard::get(const std::string& name) const {
 template <typename T>
 T WhiteBoard::pop(const std::string& name) {
   ACTS_VERBOSE("Pop object '" << name << "'");
-  (void)getHolder<T>(name);  // validates type and existence
-  auto node = m_store.extract(name);
+  if (m_slotTable != nullptr) {
+    if (auto slot = m_slotTable->find(name); slot.has_value()) {
+      return popFromSlot<T>(*slot);
+    }
+  }
+  // Check and extract under one lock, so that a concurrent pop of the same
+  // key cannot remove it in between
+  std::unique_lock lock{*m_storeMutex};
+  auto it = m_store.find(name);
+  if (it == m_store.end()) {
+    lock.unlock();
+    throwMissing(name);
+  }
+  (void)checkedHolder<T>(name, it->second.first.get(), it->second.second);
+  auto node = m_store.extract(it);
+  lock.unlock();
   return node.mapped().first->template take<T>();
 }
 
 inline bool WhiteBoard::exists(const std::string& name) const {
   // TODO remove this function?
+  if (m_slotTable != nullptr) {
+    if (auto slot = m_slotTable->find(name); slot.has_value()) {
+      return m_slots[*slot].state.load(std::memory_order_acquire) ==
+             SlotState::Filled;
+    }
+  }
+  std::shared_lock lock{*m_storeMutex};
   return m_store.contains(name);
 }
 
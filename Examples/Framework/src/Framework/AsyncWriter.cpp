@@ -0,0 +1,139 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Framework/AsyncWriter.hpp"
+
+#include "Acts/Utilities/Logger.hpp"
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Framework/WhiteBoard.hpp"
+
+#include <stdexcept>
+#include <utility>
+
+namespace ActsExamples {
+
+AsyncWriter::AsyncWriter(const Config& config, Acts::Logging::Level level)
+    : m_cfg(config) {
+  if (!m_cfg.downstreamWriter) {
+    throw std::invalid_argument("No downstream writer provided!");
+  }
+  if (m_cfg.queueSize == 0) {
+    throw std::invalid_argument("Queue size must be positive");
+  }
+  m_logger = Acts::getDefaultLogger(name(), level);
+
+  // Register write and read handles of the downstream writer
+  for (auto rh : m_cfg.downstreamWriter->readHandles()) {
+    registerReadHandle(*rh);
+  }
+
+  for (auto wh : m_cfg.downstreamWriter->writeHandles()) {
+    registerWriteHandle(*wh);
+  }
+}
+
+AsyncWriter::~AsyncWriter() {
+  stopThread();
+}
+
+ProcessCode AsyncWriter::initialize() {
+  if (auto code = m_cfg.downstreamWriter->initialize();
+      code != ProcessCode::SUCCESS) {
+    return code;
+  }
+
+  m_stop = false;
+  m_thread = std::thread([this]() { drainQueue(); });
+  return ProcessCode::SUCCESS;
+}
+
+ProcessCode AsyncWriter::beginEvent(std::size_t threadId) {
+  return m_cfg.downstreamWriter->beginEvent(threadId);
+}
+
+ProcessCode AsyncWriter::write(const AlgorithmContext& ctx) {
+  // Snapshot the event store, which only shares the stored objects
+  PendingEvent pending;
+  pending.store = std::make_unique<WhiteBoard>(m_logger->clone());
+  pending.store->copyFrom(ctx.eventStore);
+  pending.context = std::make_unique<AlgorithmContext>(
+      ctx.algorithmNumber, ctx.eventNumber, *pending.store, ctx.threadId);
+  pending.context->geoContext = ctx.geoContext;
+  pending.context->magFieldContext = ctx.magFieldContext;
+  pending.context->calibContext = ctx.calibContext;
+
+  std::unique_lock lock(m_queueMutex);
+  m_queueNotFull.wait(lock, [this]() {
+    return m_queue.size() < m_cfg.queueSize || m_error != nullptr;
+  });
+  if (m_error != nullptr) {
+    std::rethrow_exception(m_error);
+  }
+  ACTS_VERBOSE("Queue event " << ctx.eventNumber << ", " << m_queue.size()
+                              << " events pending");
+  m_queue.push_back(std::move(pending));
+  lock.unlock();
+  m_queueNotEmpty.notify_one();
+
+  return ProcessCode::SUCCESS;
+}
+
+ProcessCode AsyncWriter::finalize() {
+  stopThread();
+  if (m_error != nullptr) {
+    std::rethrow_exception(m_error);
+  }
+  return m_cfg.downstreamWriter->finalize();
+}
+
+void AsyncWriter::drainQueue() {
+  while (true) {
+    PendingEvent pending;
+    {
+      std::unique_lock lock(m_queueMutex);
+      m_queueNotEmpty.wait(lock,
+                           [this]() { return !m_queue.empty() || m_stop; });
+      if (m_queue.empty()) {
+        return;
+      }
+      pending = std::move(m_queue.front());
+      m_queue.pop_front();
+    }
+    m_queueNotFull.notify_one();
+
+    try {
+      ACTS_VERBOSE("Write event " << pending.context->eventNumber);
+      if (m_cfg.downstreamWriter->write(*pending.context) !=
+          ProcessCode::SUCCESS) {
+        throw std::runtime_error("Failed to write event " +
+                                 std::to_string(pending.context->eventNumber));
+      }
+    } catch (...) {
+      ACTS_ERROR("Asynchronous writing failed, stopping I/O thread");
+      std::lock_guard lock(m_queueMutex);
+      m_error = std::current_exception();
+      m_queue.clear();
+      m_queueNotFull.notify_all();
+      return;
+    }
+  }
+}
+
+void AsyncWriter::stopThread() {
+  if (!m_thread.joinable()) {
+    return;
+  }
+  {
+    std::lock_guard lock(m_queueMutex);
+    m_stop = true;
+  }
+  m_queueNotEmpty.notify_all();
+  m_thread.join();
+}
+
+}  // namespace ActsExamples
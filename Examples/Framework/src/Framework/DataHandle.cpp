@@ -82,6 +82,17 @@ void DataHandleBase::maybeInitialize(std::optional<std::string_view> key) {
   }
 }
 
+void DataHandleBase::resolveSlot(const WhiteBoard::SlotTable& table) const {
+  m_slotTable = nullptr;
+  if (!isInitialized()) {
+    return;
+  }
+  if (auto slot = table.find(key()); slot.has_value()) {
+    m_slotTable = &table;
+    m_slot = *slot;
+  }
+}
+
 bool WriteDataHandleBase::isCompatible(const DataHandleBase& other) const {
   return typeHash() == other.typeHash();
 }
@@ -31,11 +31,14 @@
 #include <functional>
 #include <iterator>
 #include <limits>
+#include <memory>
 #include <numeric>
+#include <optional>
 #include <ostream>
 #include <ratio>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
 
 #ifdef ACTS_BUILD_EXAMPLES_ROOT
 #include <TROOT.h>
@@ -43,6 +46,9 @@
 #include <boost/algorithm/string.hpp>
 #include <boost/algorithm/string/predicate.hpp>
 #include <boost/stacktrace/stacktrace.hpp>
+#include <tbb/concurrent_queue.h>
+#include <tbb/flow_graph.h>
+#include <tbb/parallel_pipeline.h>
 
 namespace ActsExamples {
 
@@ -78,6 +84,18 @@ std::optional<bool> parseBoolEnv(const char* envName) {
       "'. Supported values are: 0/1/false/true/no/yes/off/on");
 }
 
+tbb::filter_mode toFilterMode(Sequencer::StageMode mode) {
+  switch (mode) {
+    case Sequencer::StageMode::Parallel:
+      return tbb::filter_mode::parallel;
+    case Sequencer::StageMode::SerialInOrder:
+      return tbb::filter_mode::serial_in_order;
+    case Sequencer::StageMode::SerialOutOfOrder:
+      return tbb::filter_mode::serial_out_of_order;
+  }
+  throw std::invalid_argument("Unknown pipeline stage mode");
+}
+
 }  // namespace
 
 Sequencer::Sequencer(const Sequencer::Config& cfg)
@@ -282,6 +300,143 @@ std::pair<std::size_t, std::size_t> Sequencer::determineEventsRange() const {
   return {begSelected, endSelected};
 }
 
+std::vector<std::vector<std::size_t>> Sequencer::buildDataFlowGraph() const {
+  std::vector<std::vector<std::size_t>> predecessors(m_sequenceElements.size());
+
+  // Replay the white board state in sequence order and remember which element
+  // last wrote, read or consumed each object. Aliases share the object of
+  // their source key, so all keys are resolved to the source key first.
+  std::unordered_map<std::string, std::size_t> producers;
+  std::unordered_map<std::string, std::vector<std::size_t>> readers;
+  std::unordered_map<std::string, std::size_t> consumers;
+
+  std::unordered_map<std::string, std::string> aliasSources;
+  for (const auto& [objectName, aliasName] : m_whiteboardObjectAliases) {
+    aliasSources.try_emplace(aliasName, objectName);
+  }
+  auto sourceKey = [&](std::string key) {
+    // aliases can be aliased again, the bound guards against cycles
+    for (std::size_t n = 0; n < aliasSources.size(); ++n) {
+      auto it = aliasSources.find(key);
+      if (it == aliasSources.end()) {
+        break;
+      }
+      key = it->second;
+    }
+    return key;
+  };
+
+  for (std::size_t i = 0; i < m_sequenceElements.size(); ++i) {
+    const auto& element = *m_sequenceElements[i].sequenceElement;
+    auto& deps = predecessors[i];
+
+    for (const auto* handle : element.readHandles()) {
+      if (!handle->isInitialized()) {
+        continue;
+      }
+      const std::string key = sourceKey(handle->key());
+      if (auto it = producers.find(key); it != producers.end()) {
+        deps.push_back(it->second);
+      }
+
+      if (dynamic_cast<const ConsumeDataHandleBase*>(handle) == nullptr) {
+        readers[key].push_back(i);
+        continue;
+      }
+
+      // everybody reading the object has to be done before it is removed
+      if (auto it = readers.find(key); it != readers.end()) {
+        deps.insert(deps.end(), it->second.begin(), it->second.end());
+        readers.erase(it);
+      }
+      producers.erase(key);
+      consumers[key] = i;
+    }
+
+    for (const auto* handle : element.writeHandles()) {
+      if (!handle->isInitialized()) {
+        continue;
+      }
+      const std::string key = sourceKey(handle->key());
+      // a consumed key can be written again, but only after the consumer
+      if (auto it = consumers.find(key); it != consumers.end()) {
+        deps.push_back(it->second);
+      }
+      producers[key] = i;
+    }
+
+    std::erase(deps, i);
+    std::ranges::sort(deps);
+    auto [first, last] = std::ranges::unique(deps);
+    deps.erase(first, last);
+  }
+
+  return predecessors;
+}
+
+std::vector<std::size_t> Sequencer::assignPipelineStages() const {
+  std::vector<std::size_t> stages;
+  for (const auto& [alg, fpe] : m_sequenceElements) {
+    if (dynamic_cast<const IReader*>(alg.get()) != nullptr) {
+      stages.push_back(0);
+    } else if (dynamic_cast<const IWriter*>(alg.get()) != nullptr) {
+      stages.push_back(2);
+    } else {
+      stages.push_back(1);
+    }
+  }
+
+  // elements keep their relative order within a stage, so we only need to
+  // make sure that no element has to wait for a later stage
+  const auto predecessors = buildDataFlowGraph();
+  for (std::size_t i = 0; i < predecessors.size(); ++i) {
+    for (std::size_t dep : predecessors[i]) {
+      if (stages[dep] > stages[i]) {
+        const auto& alg = m_sequenceElements[i].sequenceElement;
+        const auto& depAlg = m_sequenceElements[dep].sequenceElement;
+        throw SequenceConfigurationException{
+            std::string{alg->typeName()} + " '" + alg->name() +
+            "' depends on " + std::string{depAlg->typeName()} + " '" +
+            depAlg->name() + "' which runs in a later pipeline stage"};
+      }
+    }
+  }
+
+  return stages;
+}
+
+std::shared_ptr<const WhiteBoard::SlotTable>
+Sequencer::resolveWhiteBoardSlots() const {
+  std::vector<std::string> keys;
+  for (const auto& [alg, fpe] : m_sequenceElements) {
+    for (const auto* handle : alg->writeHandles()) {
+      if (handle->isInitialized()) {
+        keys.push_back(handle->key());
+      }
+    }
+    for (const auto* handle : alg->readHandles()) {
+      if (handle->isInitialized()) {
+        keys.push_back(handle->key());
+      }
+    }
+  }
+
+  auto table = WhiteBoard::SlotTable::make(keys, m_whiteboardObjectAliases);
+
+  for (const auto& [alg, fpe] : m_sequenceElements) {
+    for (const auto* handle : alg->writeHandles()) {
+      handle->resolveSlot(*table);
+    }
+    for (const auto* handle : alg->readHandles()) {
+      handle->resolveSlot(*table);
+    }
+  }
+
+  ACTS_INFO("Resolved data handles to " << table->size()
+                                        << " white board slots");
+  return table;
+}
+
 // helpers for per-algorithm timing information
 namespace {
 using Clock = std::chrono::high_resolution_clock;
@@ -469,7 +624,320 @@ int Sequencer::run() {
 
   std::atomic<std::size_t> nextEvent = firstEvent;
 
+  const bool pipeline = m_cfg.maxInFlightEvents > 0 && m_cfg.numThreads != 1;
+  std::vector<std::size_t> pipelineStages;
+  if (pipeline) {
+    ACTS_INFO("Processing events in a pipeline with at most "
+              << m_cfg.maxInFlightEvents << " events in flight");
+    pipelineStages = assignPipelineStages();
+  } else if (m_cfg.maxInFlightEvents > 0) {
+    ACTS_WARNING(
+        "Pipelined event processing requires multi-threading, processing "
+        "events in a single loop");
+  }
+
+  const bool dataFlow =
+      m_cfg.dataFlowScheduling && m_cfg.numThreads != 1 && !pipeline;
+  if (m_cfg.dataFlowScheduling && pipeline) {
+    ACTS_WARNING(
+        "Data flow scheduling can not be combined with pipelined event "
+        "processing and is disabled");
+  }
+  std::shared_ptr<const WhiteBoard::SlotTable> slotTable;
+  if (m_cfg.whiteBoardSlots) {
+    slotTable = resolveWhiteBoardSlots();
+  }
+  auto makeEventStore = [&](const std::string& name) {
+    return std::make_unique<WhiteBoard>(
+        Acts::getDefaultLogger(name, m_cfg.logLevel),
+        m_whiteboardObjectAliases, slotTable);
+  };
+
+  std::vector<std::vector<std::size_t>> dataFlowGraph;
+  if (dataFlow) {
+    ACTS_INFO("Scheduling sequence elements as a data flow graph");
+    dataFlowGraph = buildDataFlowGraph();
+    for (std::size_t i = 0; i < dataFlowGraph.size(); ++i) {
+      const auto& alg = m_sequenceElements[i].sequenceElement;
+      ACTS_DEBUG("  " << alg->typeName() << ": " << alg->name()
+                      << " depends on " << dataFlowGraph[i].size()
+                      << " element(s)");
+      for (std::size_t dep : dataFlowGraph[i]) {
+        const auto& depAlg = m_sequenceElements[dep].sequenceElement;
+        ACTS_DEBUG("    <- " << depAlg->typeName() << ": " << depAlg->name());
+      }
+    }
+  } else if (m_cfg.dataFlowScheduling && !pipeline) {
+    ACTS_WARNING(
+        "Data flow scheduling requires multi-threading, executing sequence "
+        "elements in order");
+  }
+
+  // Execute one sequence element for one event, including FPE monitoring
+  auto executeElement = [&](SequenceElementWithFpeResult& element,
+                            AlgorithmContext& context,
+                            Duration& clock) -> ProcessCode {
+    auto& [alg, fpe] = element;
+    std::optional<ActsPlugins::FpeMonitor> mon;
+    if (m_cfg.trackFpes) {
+      mon.emplace();
+      context.fpeMonitor = &mon.value();
+    }
+    StopWatch sw(clock);
+    ACTS_VERBOSE("Execute " << alg->typeName() << ": " << alg->name());
+    try {
+      auto processCode = alg->internalExecute(context);
+      if (processCode == ProcessCode::SKIP) {
+        ACTS_VERBOSE("Skip event signal received from " << alg->typeName()
+                                                        << ": " << alg->name());
+        context.fpeMonitor = nullptr;
+        return ProcessCode::SKIP;
+      } else if (processCode != ProcessCode::SUCCESS) {
+        throw std::runtime_error("Failed to process event data");
+      }
+    } catch (const std::exception& e) {
+      ACTS_FATAL("Failed to execute " << alg->typeName() << " \""
+                                      << alg->name() << "\": " << e.what());
+      throw;
+    }
+    ACTS_VERBOSE("Completed " << alg->typeName() << ": " << alg->name());
+
+    if (mon) {
+      auto& local = fpe->local();
+
+      for (const auto& info : mon->result().stackTraces()) {
+        const auto count = info.count;
+        const auto type = info.type;
+        const auto& st = *info.st;
+        auto [maskLoc, nMasked] = fpeMaskCount(st, type);
+        if (nMasked < count) {
+          std::stringstream ss;
+          ss << "FPE of type " << type
+             << " exceeded configured per-event threshold of " << nMasked
+             << " (mask: " << maskLoc << ") (seen: " << count << " FPEs)\n"
+             << ActsPlugins::FpeMonitor::stackTraceToString(
+                    st, m_cfg.fpeStackTraceLength);
+
+          m_nUnmaskedFpe += (count - nMasked);
+
+          if (m_cfg.failOnFirstFpe && m_cfg.failOnUnmaskedFpe) {
+            ACTS_ERROR(ss.str());
+            local.merge(mon->result());  // merge so we get correct
+                                         // results after throwing
+            throw FpeFailure{ss.str()};
+          } else if (m_cfg.failOnUnmaskedFpe && !local.contains(info)) {
+            ACTS_INFO(ss.str());
+          }
+        }
+      }
+
+      local.merge(mon->result());
+    }
+    context.fpeMonitor = nullptr;
+    return ProcessCode::SUCCESS;
+  };
+
+  // Execute all sequence elements for one event as a task graph. Every
+  // element gets its own copy of the decorated context with the algorithm
+  // number it would have in sequential execution. Once an element signals to
+  // skip the event, elements that did not start yet are not executed.
+  auto executeDataFlowGraph = [&](const AlgorithmContext& context,
+                                  std::vector<Duration>& clocks,
+                                  std::size_t clockOffset) {
+    using Node = tbb::flow::continue_node<tbb::flow::continue_msg>;
+
+    std::atomic<bool> skipEvent = false;
+    std::vector<Duration> elementClocks(m_sequenceElements.size(),
+                                        Duration::zero());
+
+    tbb::flow::graph graph;
+    std::vector<std::unique_ptr<Node>> nodes;
+    nodes.reserve(m_sequenceElements.size());
+    for (std::size_t i = 0; i < m_sequenceElements.size(); ++i) {
+      nodes.push_back(std::make_unique<Node>(
+          graph, [&, i](const tbb::flow::continue_msg& msg) {
+            if (skipEvent) {
+              return msg;
+            }
+            AlgorithmContext elementContext = context;
+            elementContext.algorithmNumber += i + 1;
+            if (executeElement(m_sequenceElements[i], elementContext,
+                               elementClocks[i]) == ProcessCode::SKIP &&
+                !skipEvent.exchange(true)) {
+              m_nSkippedEvents++;
+            }
+            return msg;
+          }));
+    }
+    for (std::size_t i = 0; i < nodes.size(); ++i) {
+      for (std::size_t dep : dataFlowGraph[i]) {
+        tbb::flow::make_edge(*nodes[dep], *nodes[i]);
+      }
+    }
+    // Isolate the wait so this thread does not pick up another event while
+    // this one is in flight, which would break the thread ID bookkeeping.
+    tbb::this_task_arena::isolate([&] {
+      for (std::size_t i = 0; i < nodes.size(); ++i) {
+        if (dataFlowGraph[i].empty()) {
+          nodes[i]->try_put(tbb::flow::continue_msg{});
+        }
+      }
+      graph.wait_for_all();
+    });
+
+    for (std::size_t i = 0; i < elementClocks.size(); ++i) {
+      clocks[clockOffset + i] += elementClocks[i];
+    }
+  };
+
+  auto reportProgress = [&](std::size_t event) {
+    std::size_t nProcessed = ++nProcessedEvents;
+    if (logger().level() <= Acts::Logging::DEBUG) {
+      ACTS_DEBUG("finished event " << event);
+    } else if (nTotalEvents <= 100) {
+      ACTS_INFO("finished event " << event);
+    } else if (nProcessed % 100 == 0) {
+      ACTS_INFO(nProcessed << " / " << nTotalEvents << " events processed");
+    }
+  };
+
+  // Process the events as a pipeline of reader, algorithm and writer stages.
+  // Every event in flight owns one of `maxInFlightEvents` slots, which is used
+  // in place of the thread ID, since the stages of one event can run on
+  // different threads.
+  auto runPipeline = [&] {
+    struct InFlightEvent {
+      std::size_t slot = 0;
+      std::unique_ptr<WhiteBoard> ownedStore;
+      WhiteBoard* store = nullptr;
+      std::optional<AlgorithmContext> context;
+      std::vector<Duration> clocks;
+      bool skipped = false;
+    };
+    using EventPtr = std::unique_ptr<InFlightEvent>;
+
+    tbb::concurrent_queue<std::size_t> freeSlots;
+    for (std::size_t slot = 0; slot < m_cfg.maxInFlightEvents; ++slot) {
+      freeSlots.push(slot);
+    }
+    // white boards reused by the events in each slot, if enabled
+    std::vector<std::unique_ptr<WhiteBoard>> slotStores(
+        m_cfg.maxInFlightEvents);
+
+    auto runStage = [&](InFlightEvent& ev, std::size_t stage) {
+      for (std::size_t i = 0; i < m_sequenceElements.size(); ++i) {
+        if (ev.skipped) {
+          return;
+        }
+        if (pipelineStages[i] != stage) {
+          continue;
+        }
+        const std::size_t ialgo = m_decorators.size() + i;
+        ev.context->algorithmNumber = ialgo + 1;
+        if (executeElement(m_sequenceElements[i], *ev.context,
+                           ev.clocks[ialgo]) == ProcessCode::SKIP) {
+          m_nSkippedEvents++;
+          ev.skipped = true;
+        }
+      }
+    };
+
+    auto source = tbb::make_filter<void, EventPtr>(
+        tbb::filter_mode::serial_in_order,
+        [&](tbb::flow_control& fc) -> EventPtr {
+          if (nextEvent >= lastEvent) {
+            fc.stop();
+            return nullptr;
+          }
+          auto ev = std::make_unique<InFlightEvent>();
+          if (!freeSlots.try_pop(ev->slot)) {
+            throw std::logic_error("No free event slot in pipeline");
+          }
+          for (const auto& writer : m_writers) {
+            if (writer->beginEvent(ev->slot) != ProcessCode::SUCCESS) {
+              throw std::runtime_error("Failed to process event data");
+            }
+          }
+
+          std::size_t event = nextEvent++;
+          ACTS_DEBUG("start processing event " << event << " in slot "
+                                               << ev->slot);
+          m_cfg.iterationCallback();
+          if (slotTable != nullptr) {
+            auto& store = slotStores[ev->slot];
+            if (store == nullptr) {
+              store =
+                  makeEventStore("EventStore#slot" + std::to_string(ev->slot));
+            }
+            ev->store = store.get();
+          } else {
+            ev->ownedStore =
+                makeEventStore("EventStore#" + std::to_string(event));
+            ev->store = ev->ownedStore.get();
+          }
+          ev->context.emplace(0, event, *ev->store, ev->slot);
+          ev->clocks.assign(names.size(), Duration::zero());
+          return ev;
+        });
+
+    auto readers = tbb::make_filter<EventPtr, EventPtr>(
+        toFilterMode(m_cfg.readerStageMode), [&](EventPtr ev) {
+          std::size_t ialgo = 0;
+          for (auto& cdr : m_decorators) {
+            StopWatch sw(ev->clocks[ialgo++]);
+            ACTS_VERBOSE("Execute context decorator: " << cdr->name());
+            if (cdr->decorate(++*ev->context) != ProcessCode::SUCCESS) {
+              throw std::runtime_error("Failed to decorate event context");
+            }
+          }
+          runStage(*ev, 0);
+          return ev;
+        });
+
+    auto algorithms = tbb::make_filter<EventPtr, EventPtr>(
+        toFilterMode(m_cfg.algorithmStageMode), [&](EventPtr ev) {
+          runStage(*ev, 1);
+          return ev;
+        });
+
+    auto writers = tbb::make_filter<EventPtr, void>(
+        toFilterMode(m_cfg.writerStageMode), [&](EventPtr ev) {
+          runStage(*ev, 2);
+
+          {
+            tbbWrap::queuing_mutex::scoped_lock lock(clocksAlgorithmsMutex);
+            for (std::size_t i = 0; i < clocksAlgorithms.size(); ++i) {
+              clocksAlgorithms[i] += ev->clocks[i];
+            }
+          }
+
+          const std::size_t event = ev->context->eventNumber;
+          const std::size_t slot = ev->slot;
+          // release the white board before handing out the slot again
+          if (slotTable != nullptr) {
+            ev->store->clear();
+          }
+          ev.reset();
+          freeSlots.push(slot);
+          reportProgress(event);
+        });
+
+    tbb::parallel_pipeline(m_cfg.maxInFlightEvents,
+                           source & readers & algorithms & writers);
+  };
+
+  // white boards reused by later events, if enabled. An event acquires a
+  // white board for its whole lifetime instead of using one per thread, since
+  // a thread waiting for nested work of its event can pick up another event.
+  tbb::concurrent_queue<std::unique_ptr<WhiteBoard>> freeStores;
+  std::atomic<std::size_t> nStores = 0;
+
   m_taskArena.execute([&] {
+    if (pipeline) {
+      runPipeline();
+      return;
+    }
+
     tbbWrap::parallel_for(
         tbb::blocked_range<std::size_t>(firstEvent, lastEvent),
         [&](const tbb::blocked_range<std::size_t>& r) {
@@ -491,13 +959,18 @@ int Sequencer::run() {
             ACTS_DEBUG("start processing event " << event << " on thread "
                                                  << threadId);
             m_cfg.iterationCallback();
-            // Use per-event store
-            WhiteBoard eventStore(
-                Acts::getDefaultLogger("EventStore#" + std::to_string(event),
-                                       m_cfg.logLevel),
-                m_whiteboardObjectAliases);
-            // If we ever wanted to run algorithms in parallel, this needs to
-            // be changed to Algorithm context copies
+            // Use per-event store, or acquire a reused one for this event
+            std::unique_ptr<WhiteBoard> ownedStore;
+            if (slotTable == nullptr) {
+              ownedStore =
+                  makeEventStore("EventStore#" + std::to_string(event));
+            } else if (!freeStores.try_pop(ownedStore)) {
+              ownedStore =
+                  makeEventStore("EventStore#pool" + std::to_string(nStores++));
+            }
+            WhiteBoard& eventStore = *ownedStore;
+            // Data flow scheduling runs the sequence elements on copies of
+            // this context, see executeDataFlowGraph
             AlgorithmContext context(0, event, eventStore, threadId);
             std::size_t ialgo = 0;
 
@@ -512,79 +985,24 @@ int Sequencer::run() {
 
             ACTS_VERBOSE("Execute sequence elements");
 
-            for (auto& [alg, fpe] : m_sequenceElements) {
-              std::optional<ActsPlugins::FpeMonitor> mon;
-              if (m_cfg.trackFpes) {
-                mon.emplace();
-                context.fpeMonitor = &mon.value();
-              }
-              StopWatch sw(localClocksAlgorithms[ialgo++]);
-              ACTS_VERBOSE("Execute " << alg->typeName() << ": "
-                                      << alg->name());
-              try {
-                auto processCode = alg->internalExecute(++context);
-                if (processCode == ProcessCode::SKIP) {
-                  ACTS_VERBOSE("Skip event signal received from "
-                               << alg->typeName() << ": " << alg->name());
+            if (dataFlow) {
+              executeDataFlowGraph(context, localClocksAlgorithms, ialgo);
+            } else {
+              for (auto& element : m_sequenceElements) {
+                if (executeElement(element, ++context,
+                                   localClocksAlgorithms[ialgo++]) ==
+                    ProcessCode::SKIP) {
                   m_nSkippedEvents++;
                   break;
-                } else if (processCode != ProcessCode::SUCCESS) {
-                  throw std::runtime_error("Failed to process event data");
                 }
-              } catch (const std::exception& e) {
-                ACTS_FATAL("Failed to execute " << alg->typeName() << " \""
-                                                << alg->name()
-                                                << "\": " << e.what());
-                throw;
-              }
-              ACTS_VERBOSE("Completed " << alg->typeName() << ": "
-                                        << alg->name());
-
-              if (mon) {
-                auto& local = fpe->local();
-
-                for (const auto& info : mon->result().stackTraces()) {
-                  const auto count = info.count;
-                  const auto type = info.type;
-                  const auto& st = *info.st;
-                  auto [maskLoc, nMasked] = fpeMaskCount(st, type);
-                  if (nMasked < count) {
-                    std::stringstream ss;
-                    ss << "FPE of type " << type
-                       << " exceeded configured per-event threshold of "
-                       << nMasked << " (mask: " << maskLoc
-                       << ") (seen: " << count << " FPEs)\n"
-                       << ActsPlugins::FpeMonitor::stackTraceToString(
-                              st, m_cfg.fpeStackTraceLength);
-
-                    m_nUnmaskedFpe += (count - nMasked);
-
-                    if (m_cfg.failOnFirstFpe && m_cfg.failOnUnmaskedFpe) {
-                      ACTS_ERROR(ss.str());
-                      local.merge(mon->result());  // merge so we get correct
-                                                   // results after throwing
-                      throw FpeFailure{ss.str()};
-                    } else if (m_cfg.failOnUnmaskedFpe &&
-                               !local.contains(info)) {
-                      ACTS_INFO(ss.str());
-                    }
-                  }
-                }
-
-                local.merge(mon->result());
               }
-              context.fpeMonitor = nullptr;
             }
 
-            nProcessedEvents++;
-            if (logger().level() <= Acts::Logging::DEBUG) {
-              ACTS_DEBUG("finished event " << event);
-            } else if (nTotalEvents <= 100) {
-              ACTS_INFO("finished event " << event);
-            } else if (nProcessedEvents % 100 == 0) {
-              ACTS_INFO(nProcessedEvents << " / " << nTotalEvents
-                                         << " events processed");
+            if (slotTable != nullptr) {
+              eventStore.clear();
+              freeStores.push(std::move(ownedStore));
             }
+            reportProgress(event);
           }
 
           // add timing info to global information
@@ -60,13 +60,78 @@ inline int levenshteinDistance(const std::string_view &a,
 
 }  // namespace
 
-std::vector<std::string_view> WhiteBoard::similarNames(
+std::shared_ptr<const WhiteBoard::SlotTable> WhiteBoard::SlotTable::make(
+    const std::vector<std::string> &keys, const AliasMapType &objectAliases) {
+  auto table = std::make_shared<SlotTable>();
+
+  auto insert = [&](const std::string &key) {
+    auto [it, inserted] = table->indices.try_emplace(key, table->size());
+    if (inserted) {
+      table->names.push_back(key);
+      table->aliases.emplace_back();
+    }
+    return it->second;
+  };
+
+  for (const auto &key : keys) {
+    std::size_t slot = insert(key);
+    if (!table->aliases[slot].empty()) {
+      continue;  // duplicate key, aliases already assigned
+    }
+    auto range = objectAliases.equal_range(key);
+    for (auto it = range.first; it != range.second; ++it) {
+      std::size_t aliasSlot = insert(it->second);
+      table->aliases[slot].push_back(aliasSlot);
+    }
+  }
+
+  return table;
+}
+
+std::optional<std::size_t> WhiteBoard::SlotTable::find(
+    std::string_view name) const {
+  auto it = indices.find(name);
+  if (it == indices.end()) {
+    return std::nullopt;
+  }
+  return it->second;
+}
+
+WhiteBoard::WhiteBoard(std::unique_ptr<const Acts::Logger> logger,
+                       AliasMapType objectAliases,
+                       std::shared_ptr<const SlotTable> slotTable)
+    : m_logger(std::move(logger)),
+      m_objectAliases(std::move(objectAliases)),
+      m_slotTable(std::move(slotTable)) {
+  if (m_slotTable != nullptr) {
+    m_slots = std::make_unique<Slot[]>(m_slotTable->size());
+  }
+}
+
+std::vector<std::string> WhiteBoard::similarNames(
     const std::string_view &name, int distThreshold,
     std::size_t maxNumber) const {
-  std::vector<std::pair<int, std::string_view>> names;
-  for (const auto &[n, storeVal] : m_store) {
-    if (const auto d = levenshteinDistance(n, name); d < distThreshold) {
-      names.push_back({d, n});
+  // The names are copied, since the store can be modified concurrently once
+  // the lock is released
+  std::vector<std::pair<int, std::string>> names;
+  {
+    std::shared_lock lock{*m_storeMutex};
+    for (const auto &[n, storeVal] : m_store) {
+      if (const auto d = levenshteinDistance(n, name); d < distThreshold) {
+        names.push_back({d, n});
+      }
+    }
+  }
+  if (m_slotTable != nullptr) {
+    for (std::size_t i = 0; i < m_slotTable->size(); ++i) {
+      if (m_slots[i].state.load(std::memory_order_acquire) !=
+          SlotState::Filled) {
+        continue;
+      }
+      const std::string &n = m_slotTable->names[i];
+      if (const auto d = levenshteinDistance(n, name); d < distThreshold) {
+        names.push_back({d, n});
+      }
     }
   }
   for (const auto &[from, to] : m_objectAliases) {
@@ -77,9 +142,9 @@ std::vector<std::string_view> WhiteBoard::similarNames(
 
   std::ranges::sort(names, {}, [](const auto &n) { return n.first; });
 
-  std::vector<std::string_view> selected_names;
+  std::vector<std::string> selected_names;
   for (std::size_t i = 0; i < std::min(names.size(), maxNumber); ++i) {
-    selected_names.push_back(names[i].second);
+    selected_names.push_back(std::move(names[i].second));
   }
 
   return selected_names;
@@ -92,7 +157,35 @@ std::string WhiteBoard::typeMismatchMessage(const std::string &name,
                      boost::core::demangle(act)};
 }
 
+void WhiteBoard::throwMissing(const std::string &name) const {
+  const auto names = similarNames(name, 10, 3);
+
+  std::stringstream ss;
+  if (!names.empty()) {
+    ss << ", similar ones are: [ ";
+    for (std::size_t i = 0; i < std::min(3ul, names.size()); ++i) {
+      ss << "'" << names[i] << "' ";
+    }
+    ss << "]";
+  }
+
+  throw std::out_of_range("Object '" + name + "' does not exists" + ss.str());
+}
+
 void WhiteBoard::copyFrom(const WhiteBoard &other) {
+  if (other.m_slotTable != nullptr) {
+    for (std::size_t i = 0; i < other.m_slotTable->size(); ++i) {
+      const Slot &slot = other.m_slots[i];
+      if (slot.state.load(std::memory_order_acquire) != SlotState::Filled) {
+        continue;
+      }
+      addHolder(other.m_slotTable->names[i], slot.holder, slot.typeHash);
+      ACTS_VERBOSE("Copied key '" << other.m_slotTable->names[i]
+                                  << "' to whiteboard");
+    }
+  }
+
+  std::shared_lock lock{*other.m_storeMutex};
   for (auto &[key, val] : other.m_store) {
     addHolder(key, val.first, val.second);
     ACTS_VERBOSE("Copied key '" << key << "' to whiteboard");
@@ -110,7 +203,15 @@ void WhiteBoard::addHolder(const std::string &name,
     throw std::invalid_argument("Object '" + name + "' is nullptr");
   }
 
+  if (m_slotTable != nullptr) {
+    if (auto slot = m_slotTable->find(name); slot.has_value()) {
+      addToSlot(*slot, holder, typeHash);
+      return;
+    }
+  }
+
   StoreValue storeVal{holder, typeHash};
+  std::unique_lock lock{*m_storeMutex};
   auto [storeIt, success] = m_store.try_emplace(name, storeVal);
 
   if (!success) {
@@ -139,8 +240,85 @@ void WhiteBoard::addHolder(const std::string &name,
             typeHash);
 }
 
+void WhiteBoard::addToSlot(std::size_t slot,
+                           const std::shared_ptr<Acts::AnyMoveOnly> &holder,
+                           std::uint64_t typeHash) {
+  Slot &entry = m_slots[slot];
+  const std::string &name = m_slotTable->names[slot];
+
+  // Claim the slot, only one writer can succeed
+  SlotState expected = SlotState::Empty;
+  if (!entry.state.compare_exchange_strong(expected, SlotState::Busy,
+                                           std::memory_order_acquire)) {
+    throw std::invalid_argument("Object '" + name + "' already exists");
+  }
+  entry.holder = holder;
+  entry.typeHash = typeHash;
+  entry.state.store(SlotState::Filled, std::memory_order_release);
+  ACTS_VERBOSE("Added object '"
+               << name << "' of type '"
+               << boost::core::demangle(holder->typeInfo()
+                                            ? holder->typeInfo()->name()
+                                            : "unknown")
+               << "' to slot " << slot);
+
+  // Aliases are written together with the object, nobody else writes them
+  for (std::size_t aliasSlot : m_slotTable->aliases[slot]) {
+    Slot &alias = m_slots[aliasSlot];
+    alias.holder = holder;
+    alias.typeHash = typeHash;
+    alias.state.store(SlotState::Filled, std::memory_order_release);
+    ACTS_VERBOSE("Added alias object '" << m_slotTable->names[aliasSlot]
+                                        << "'");
+  }
+}
+
+std::pair<Acts::AnyMoveOnly *, std::uint64_t> WhiteBoard::slotHolder(
+    std::size_t slot) const {
+  const Slot &entry = m_slots[slot];
+  if (entry.state.load(std::memory_order_acquire) != SlotState::Filled) {
+    throwMissing(m_slotTable->names[slot]);
+  }
+  return {entry.holder.get(), entry.typeHash};
+}
+
+std::shared_ptr<Acts::AnyMoveOnly> WhiteBoard::extractSlot(std::size_t slot) {
+  Slot &entry = m_slots[slot];
+  SlotState expected = SlotState::Filled;
+  if (!entry.state.compare_exchange_strong(expected, SlotState::Busy,
+                                           std::memory_order_acq_rel)) {
+    throwMissing(m_slotTable->names[slot]);
+  }
+  auto holder = std::move(entry.holder);
+  entry.holder = nullptr;
+  entry.typeHash = 0;
+  entry.state.store(SlotState::Empty, std::memory_order_release);
+  return holder;
+}
+
+void WhiteBoard::clear() {
+  if (m_slotTable != nullptr) {
+    for (std::size_t i = 0; i < m_slotTable->size(); ++i) {
+      m_slots[i].holder = nullptr;
+      m_slots[i].typeHash = 0;
+      m_slots[i].state.store(SlotState::Empty, std::memory_order_relaxed);
+    }
+  }
+  std::unique_lock lock{*m_storeMutex};
+  m_store.clear();
+}
+
 std::vector<std::string> WhiteBoard::getKeys() const {
   std::vector<std::string> keys;
+  if (m_slotTable != nullptr) {
+    for (std::size_t i = 0; i < m_slotTable->size(); ++i) {
+      if (m_slots[i].state.load(std::memory_order_acquire) ==
+          SlotState::Filled) {
+        keys.push_back(m_slotTable->names[i]);
+      }
+    }
+  }
+  std::shared_lock lock{*m_storeMutex};
   for (const auto &[key, val] : m_store) {
     keys.push_back(key);
   }
@@ -149,9 +327,16 @@ std::vector<std::string> WhiteBoard::getKeys() const {
 
 std::pair<Acts::AnyMoveOnly *, std::uint64_t> WhiteBoard::getHolder(
     const std::string &name) const {
+  if (m_slotTable != nullptr) {
+    if (auto slot = m_slotTable->find(name); slot.has_value()) {
+      return slotHolder(*slot);
+    }
+  }
+  std::shared_lock lock{*m_storeMutex};
   auto it = m_store.find(name);
   if (it == m_store.end()) {
-    throw std::out_of_range("Object '" + name + "' does not exists");
+    lock.unlock();
+    throwMissing(name);
   }
   return {it->second.first.get(), it->second.second};
 }
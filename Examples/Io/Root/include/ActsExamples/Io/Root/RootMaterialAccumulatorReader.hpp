@@ -0,0 +1,67 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Utilities/Logger.hpp"
+#include "ActsExamples/MaterialMapping/IMaterialAccumulatorReader.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ActsExamples {
+
+/// @brief Reads accumulated surface material from root files
+///
+/// Reads the files written by the @ref RootMaterialAccumulatorWriter and
+/// merges their content bin by bin into the state of a binned surface
+/// material accumulator.
+class RootMaterialAccumulatorReader : public IMaterialAccumulatorReader {
+ public:
+  /// @class Config
+  ///
+  /// Configuration of the Reader
+  struct Config {
+    /// List of input files
+    std::vector<std::string> fileList;
+    /// The name of the input tree
+    std::string treeName = "material_accumulator";
+  };
+
+  /// Constructor
+  ///
+  /// @param config The configuration struct
+  /// @param level The log level
+  RootMaterialAccumulatorReader(const Config& config,
+                                Acts::Logging::Level level);
+
+  /// Add the material of all input files to the accumulator state
+  ///
+  /// @param state is the state of a binned surface material accumulator
+  ///
+  /// @throws std::invalid_argument if a surface or bin is not known to the
+  ///         state, i.e. it was created with a different configuration
+  void readAccumulator(
+      Acts::ISurfaceMaterialAccumulator::State& state) const override;
+
+  /// Get readonly access to the config parameters
+  const Config& config() const { return m_cfg; }
+
+ private:
+  /// The config class
+  Config m_cfg;
+
+  /// The logger instance
+  std::unique_ptr<const Acts::Logger> m_logger;
+
+  /// Private access to the logging instance
+  const Acts::Logger& logger() const { return *m_logger; }
+};
+
+}  // namespace ActsExamples
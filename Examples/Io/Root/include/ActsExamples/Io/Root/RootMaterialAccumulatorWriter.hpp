@@ -0,0 +1,91 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Utilities/Logger.hpp"
+#include "ActsExamples/MaterialMapping/IMaterialAccumulatorWriter.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+class TFile;
+class TTree;
+
+namespace ActsExamples {
+
+/// @brief Writes the accumulated surface material to a root file
+///
+/// The totals of every bin of the binned surface material accumulator, i.e.
+/// the average material, the variance and the number of tracks, are written
+/// as one entry of a flat tree. Files from several partial mapping jobs can
+/// be read back with the @ref RootMaterialAccumulatorReader and merged before
+/// the material maps are created.
+class RootMaterialAccumulatorWriter : public IMaterialAccumulatorWriter {
+ public:
+  /// @class Config
+  ///
+  /// Configuration of the Writer
+  struct Config {
+    /// The name of the output file
+    std::string filePath = "material-accumulator.root";
+    /// The file mode
+    std::string fileMode = "RECREATE";
+    /// The name of the output tree
+    std::string treeName = "material_accumulator";
+  };
+
+  /// Constructor
+  ///
+  /// @param config The configuration struct
+  /// @param level The log level
+  RootMaterialAccumulatorWriter(const Config& config,
+                                Acts::Logging::Level level);
+
+  /// Virtual destructor
+  ~RootMaterialAccumulatorWriter() override;
+
+  /// Write out the accumulated material
+  ///
+  /// Every call appends the bins of the state to the same output tree.
+  ///
+  /// @param state is the state of a binned surface material accumulator
+  void writeAccumulator(
+      const Acts::ISurfaceMaterialAccumulator::State& state) override;
+
+  /// Get readonly access to the config parameters
+  const Config& config() const { return m_cfg; }
+
+ private:
+  /// The config class
+  Config m_cfg;
+
+  /// The logger instance
+  std::unique_ptr<const Acts::Logger> m_logger;
+
+  /// Private access to the logging instance
+  const Acts::Logger& logger() const { return *m_logger; }
+
+  TFile* m_outputFile{nullptr};
+  /// The output tree, created once and filled by every write call
+  TTree* m_outputTree{nullptr};
+
+  /// The branch buffers
+  std::uint64_t m_geoId = 0;
+  std::uint32_t m_bin0 = 0;
+  std::uint32_t m_bin1 = 0;
+  float m_thickness = 0;
+  /// Opaque material parameters, see Acts::Material
+  std::vector<float> m_parameters;
+  float m_variance = 0;
+  std::uint32_t m_count = 0;
+};
+
+}  // namespace ActsExamples
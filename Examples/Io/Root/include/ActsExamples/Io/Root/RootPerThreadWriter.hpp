@@ -0,0 +1,97 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Utilities/Logger.hpp"
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Framework/IWriter.hpp"
+#include "ActsExamples/Framework/ProcessCode.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace ActsExamples {
+
+/// Write with one ROOT writer instance and output file per thread.
+///
+/// Instead of sharing a single TFile/TTree between all threads, which
+/// serializes the writing on the writer mutex, each thread ID passed by the
+/// sequencer gets its own writer instance writing into its own file. The
+/// instances are created with the configured factory, which receives the
+/// per-thread file path. At the end of the job, the per-thread trees can be
+/// merged into a single file, ordered by the event number branch.
+///
+/// @note Merging is only supported for writers producing a single tree.
+class RootPerThreadWriter final : public IWriter {
+ public:
+  struct Config {
+    /// Creates a writer instance writing into the given file path
+    std::function<std::shared_ptr<IWriter>(const std::string&)>
+        writerFactory;
+    /// Path of the merged output file. The per-thread files are placed next
+    /// to it with a `_thread<N>` suffix.
+    std::string filePath;
+    /// Name of the tree written by the writer instances.
+    std::string treeName;
+    /// Scalar branch with the event number that orders the merged entries. If
+    /// empty, the per-thread trees are concatenated.
+    std::string eventNumberBranch = "event_nr";
+    /// Merge the per-thread files at the end of the job.
+    bool mergeFiles = true;
+    /// Keep the per-thread files after merging.
+    bool keepThreadFiles = false;
+  };
+
+  /// Construct the writer and the writer instance for the first thread.
+  ///
+  /// @param config is the configuration object
+  /// @param level is the logging level
+  RootPerThreadWriter(const Config& config, Acts::Logging::Level level);
+
+  std::string name() const override;
+
+  /// Initialize the writer instance for the first thread
+  ProcessCode initialize() override;
+
+  /// Finalize all writer instances and merge their output
+  ProcessCode finalize() override;
+
+  /// Forwarded to the writer instance of the given thread
+  ProcessCode beginEvent(std::size_t threadId) override;
+
+  /// Write the event with the writer instance of its thread
+  ProcessCode write(const AlgorithmContext& ctx) override;
+
+  /// Get readonly access to the config parameters
+  const Config& config() const { return m_cfg; }
+
+  /// Path of the output file of the given thread
+  std::string threadFilePath(std::size_t threadId) const;
+
+ private:
+  /// Get or lazily create the writer instance of the given thread
+  IWriter& threadWriter(std::size_t threadId);
+
+  /// Merge the per-thread trees into the output file
+  void mergeThreadFiles() const;
+
+  Config m_cfg;
+  std::unique_ptr<const Acts::Logger> m_logger;
+
+  std::mutex m_writersMutex;
+  std::vector<std::shared_ptr<IWriter>> m_writers;
+
+  const Acts::Logger& logger() const { return *m_logger; }
+};
+
+}  // namespace ActsExamples
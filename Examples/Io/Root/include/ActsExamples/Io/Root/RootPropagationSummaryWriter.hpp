@@ -117,6 +117,8 @@ class RootPropagationSummaryWriter : public WriterT<PropagationSummaries> {
   // navigator statistics
   std::size_t m_nRenavigations = 0;
   std::size_t m_nVolumeSwitches = 0;
+  std::size_t m_nCandidateCacheHits = 0;
+  std::size_t m_nCandidateCacheMisses = 0;
 };
 
 }  // namespace ActsExamples
@@ -0,0 +1,112 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Io/Root/RootMaterialAccumulatorReader.hpp"
+
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/Material/AccumulatedMaterialSlab.hpp"
+#include "Acts/Material/AccumulatedSurfaceMaterial.hpp"
+#include "Acts/Material/BinnedSurfaceMaterialAccumulator.hpp"
+#include "Acts/Material/Material.hpp"
+#include "Acts/Material/MaterialSlab.hpp"
+
+#include <cstdint>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+#include <TChain.h>
+
+namespace ActsExamples {
+
+RootMaterialAccumulatorReader::RootMaterialAccumulatorReader(
+    const Config& config, Acts::Logging::Level level)
+    : m_cfg(config),
+      m_logger{Acts::getDefaultLogger("RootMaterialAccumulatorReader", level)} {
+  if (m_cfg.fileList.empty()) {
+    throw std::invalid_argument{"No input files given"};
+  } else if (m_cfg.treeName.empty()) {
+    throw std::invalid_argument("Missing tree name");
+  }
+}
+
+void RootMaterialAccumulatorReader::readAccumulator(
+    Acts::ISurfaceMaterialAccumulator::State& state) const {
+  auto* cState =
+      dynamic_cast<Acts::BinnedSurfaceMaterialAccumulator::State*>(&state);
+  if (cState == nullptr) {
+    throw std::invalid_argument(
+        "Only the binned surface material accumulator state can be read");
+  }
+
+  TChain inputChain(m_cfg.treeName.c_str());
+  for (const auto& inputFile : m_cfg.fileList) {
+    inputChain.Add(inputFile.c_str());
+    ACTS_DEBUG("Adding File " << inputFile << " to tree '" << m_cfg.treeName
+                              << "'.");
+  }
+
+  std::uint64_t geoId = 0;
+  std::uint32_t bin0 = 0;
+  std::uint32_t bin1 = 0;
+  float thickness = 0;
+  // the branch is read into this vector, which is owned by the reader
+  std::vector<float> parameters;
+  std::vector<float>* parametersPtr = &parameters;
+  float variance = 0;
+  std::uint32_t count = 0;
+
+  inputChain.SetBranchAddress("geometry_id", &geoId);
+  inputChain.SetBranchAddress("bin0", &bin0);
+  inputChain.SetBranchAddress("bin1", &bin1);
+  inputChain.SetBranchAddress("thickness", &thickness);
+  inputChain.SetBranchAddress("material_parameters", &parametersPtr);
+  inputChain.SetBranchAddress("variance", &variance);
+  inputChain.SetBranchAddress("count", &count);
+
+  Acts::Material::ParametersVector matParameters;
+  const auto nEntries = inputChain.GetEntries();
+  for (Long64_t entry = 0; entry < nEntries; ++entry) {
+    inputChain.GetEntry(entry);
+
+    Acts::GeometryIdentifier surfaceId(geoId);
+    auto accMaterial = cState->accumulatedMaterial.find(surfaceId);
+    if (accMaterial == cState->accumulatedMaterial.end()) {
+      std::stringstream msg;
+      msg << "Accumulated material for unknown surface " << surfaceId;
+      throw std::invalid_argument(msg.str());
+    }
+    const auto& matrix = accMaterial->second.accumulatedMaterial();
+    if (bin1 >= matrix.size() || bin0 >= matrix[bin1].size()) {
+      std::stringstream msg;
+      msg << "Accumulated material for surface " << surfaceId
+          << " has bin (" << bin0 << ", " << bin1
+          << ") outside of the binning";
+      throw std::invalid_argument(msg.str());
+    }
+    if (parameters.size() != static_cast<std::size_t>(matParameters.size())) {
+      throw std::invalid_argument("Invalid material parameters in input");
+    }
+
+    for (Eigen::Index i = 0; i < matParameters.size(); ++i) {
+      matParameters[i] = parameters[i];
+    }
+    Acts::MaterialSlab average(Acts::Material(matParameters), thickness);
+    accMaterial->second.merge(
+        bin0, bin1,
+        Acts::AccumulatedMaterialSlab::fromTotals(average, variance, count));
+  }
+
+  // the buffers go out of scope before the chain
+  inputChain.ResetBranchAddresses();
+
+  ACTS_DEBUG("Merged " << nEntries << " accumulated material bins from "
+                       << m_cfg.fileList.size() << " files");
+}
+
+}  // namespace ActsExamples
@@ -0,0 +1,110 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Io/Root/RootMaterialAccumulatorWriter.hpp"
+
+#include "Acts/Material/AccumulatedMaterialSlab.hpp"
+#include "Acts/Material/AccumulatedSurfaceMaterial.hpp"
+#include "Acts/Material/BinnedSurfaceMaterialAccumulator.hpp"
+#include "Acts/Material/Material.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <ios>
+#include <new>
+#include <stdexcept>
+#include <vector>
+
+#include <TFile.h>
+#include <TTree.h>
+
+namespace ActsExamples {
+
+RootMaterialAccumulatorWriter::RootMaterialAccumulatorWriter(
+    const Config& config, Acts::Logging::Level level)
+    : m_cfg(config),
+      m_logger{Acts::getDefaultLogger("RootMaterialAccumulatorWriter", level)} {
+  if (m_cfg.filePath.empty()) {
+    throw std::invalid_argument("Missing file name");
+  } else if (m_cfg.treeName.empty()) {
+    throw std::invalid_argument("Missing tree name");
+  }
+
+  // Setup ROOT I/O
+  m_outputFile = TFile::Open(m_cfg.filePath.c_str(), m_cfg.fileMode.c_str());
+  if (m_outputFile == nullptr) {
+    throw std::ios_base::failure("Could not open '" + m_cfg.filePath + "'");
+  }
+
+  m_outputFile->cd();
+  m_outputTree = new TTree(m_cfg.treeName.c_str(),
+                           "TTree from RootMaterialAccumulatorWriter");
+  if (m_outputTree == nullptr) {
+    throw std::bad_alloc();
+  }
+
+  m_outputTree->Branch("geometry_id", &m_geoId);
+  m_outputTree->Branch("bin0", &m_bin0);
+  m_outputTree->Branch("bin1", &m_bin1);
+  m_outputTree->Branch("thickness", &m_thickness);
+  m_outputTree->Branch("material_parameters", &m_parameters);
+  m_outputTree->Branch("variance", &m_variance);
+  m_outputTree->Branch("count", &m_count);
+}
+
+RootMaterialAccumulatorWriter::~RootMaterialAccumulatorWriter() {
+  if (m_outputFile != nullptr) {
+    m_outputFile->Close();
+  }
+}
+
+void RootMaterialAccumulatorWriter::writeAccumulator(
+    const Acts::ISurfaceMaterialAccumulator::State& state) {
+  const auto* cState =
+      dynamic_cast<const Acts::BinnedSurfaceMaterialAccumulator::State*>(
+          &state);
+  if (cState == nullptr) {
+    throw std::invalid_argument(
+        "Only the binned surface material accumulator state can be written");
+  }
+
+  std::size_t nBins = 0;
+  for (const auto& [id, accMaterial] : cState->accumulatedMaterial) {
+    m_geoId = id.value();
+    const auto& matrix = accMaterial.accumulatedMaterial();
+    for (std::size_t ib1 = 0; ib1 < matrix.size(); ++ib1) {
+      for (std::size_t ib0 = 0; ib0 < matrix[ib1].size(); ++ib0) {
+        auto [average, nTracks] = matrix[ib1][ib0].totalAverage();
+        // bins without tracks do not contribute to a merge
+        if (nTracks == 0u) {
+          continue;
+        }
+        m_bin0 = static_cast<std::uint32_t>(ib0);
+        m_bin1 = static_cast<std::uint32_t>(ib1);
+        m_thickness = average.thickness();
+        const Acts::Material::ParametersVector matParameters =
+            average.material().parameters();
+        m_parameters.assign(matParameters.data(),
+                            matParameters.data() + matParameters.size());
+        m_variance = matrix[ib1][ib0].totalVariance().first;
+        m_count = nTracks;
+        m_outputTree->Fill();
+        ++nBins;
+      }
+    }
+  }
+
+  ACTS_DEBUG("Writing " << nBins << " bins of "
+                        << cState->accumulatedMaterial.size() << " surfaces");
+  // overwrite the previous version of the tree, which holds a subset of the
+  // entries if the writer is called more than once
+  m_outputFile->cd();
+  m_outputTree->Write(nullptr, TObject::kOverwrite);
+}
+
+}  // namespace ActsExamples
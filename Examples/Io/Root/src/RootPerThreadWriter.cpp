@@ -0,0 +1,254 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Io/Root/RootPerThreadWriter.hpp"
+
+#include <algorithm>
+#include <filesystem>
+#include <ios>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include <TBranch.h>
+#include <TFile.h>
+#include <TLeaf.h>
+#include <TTree.h>
+
+namespace ActsExamples {
+
+RootPerThreadWriter::RootPerThreadWriter(const Config& config,
+                                         Acts::Logging::Level level)
+    : m_cfg(config) {
+  if (!m_cfg.writerFactory) {
+    throw std::invalid_argument("Missing writer factory");
+  }
+  if (m_cfg.filePath.empty()) {
+    throw std::invalid_argument("Missing file path");
+  }
+  if (m_cfg.mergeFiles && m_cfg.treeName.empty()) {
+    throw std::invalid_argument("Missing tree name");
+  }
+
+  auto writer = m_cfg.writerFactory(threadFilePath(0));
+  if (writer == nullptr) {
+    throw std::invalid_argument("Writer factory returned no writer");
+  }
+  m_writers.push_back(std::move(writer));
+  m_logger = Acts::getDefaultLogger(name(), level);
+
+  // All instances share the configuration and therefore the data handles
+  for (auto rh : m_writers.front()->readHandles()) {
+    registerReadHandle(*rh);
+  }
+
+  for (auto wh : m_writers.front()->writeHandles()) {
+    registerWriteHandle(*wh);
+  }
+}
+
+std::string RootPerThreadWriter::name() const {
+  return "PerThread" + m_writers.front()->name();
+}
+
+std::string RootPerThreadWriter::threadFilePath(std::size_t threadId) const {
+  std::filesystem::path path(m_cfg.filePath);
+  std::filesystem::path threadFile = path.parent_path() /
+                                     (path.stem().string() + "_thread" +
+                                      std::to_string(threadId) +
+                                      path.extension().string());
+  return threadFile.string();
+}
+
+ProcessCode RootPerThreadWriter::initialize() {
+  return m_writers.front()->initialize();
+}
+
+IWriter& RootPerThreadWriter::threadWriter(std::size_t threadId) {
+  std::lock_guard<std::mutex> lock(m_writersMutex);
+  if (threadId >= m_writers.size()) {
+    m_writers.resize(threadId + 1);
+  }
+
+  auto& writer = m_writers[threadId];
+  if (writer == nullptr) {
+    ACTS_DEBUG("Create writer instance for thread " << threadId);
+    writer = m_cfg.writerFactory(threadFilePath(threadId));
+    if (writer == nullptr || writer->initialize() != ProcessCode::SUCCESS) {
+      throw std::runtime_error("Failed to create writer instance for thread " +
+                               std::to_string(threadId));
+    }
+  }
+  return *writer;
+}
+
+ProcessCode RootPerThreadWriter::beginEvent(std::size_t threadId) {
+  return threadWriter(threadId).beginEvent(threadId);
+}
+
+ProcessCode RootPerThreadWriter::write(const AlgorithmContext& ctx) {
+  return threadWriter(ctx.threadId).write(ctx);
+}
+
+ProcessCode RootPerThreadWriter::finalize() {
+  for (const auto& writer : m_writers) {
+    if (writer != nullptr && writer->finalize() != ProcessCode::SUCCESS) {
+      return ProcessCode::ABORT;
+    }
+  }
+
+  if (!m_cfg.mergeFiles) {
+    return ProcessCode::SUCCESS;
+  }
+
+  mergeThreadFiles();
+
+  if (!m_cfg.keepThreadFiles) {
+    for (std::size_t i = 0; i < m_writers.size(); ++i) {
+      if (m_writers[i] != nullptr) {
+        std::filesystem::remove(threadFilePath(i));
+      }
+    }
+  }
+
+  return ProcessCode::SUCCESS;
+}
+
+namespace {
+
+/// Event numbers of all entries of a tree, read from a scalar branch
+std::vector<double> readEventNumbers(TTree& tree, const std::string& name) {
+  TBranch* branch = tree.GetBranch(name.c_str());
+  if (branch == nullptr) {
+    throw std::invalid_argument("Missing event number branch '" + name + "'");
+  }
+  // Only a single numerical value per entry can order the entries
+  TLeaf* leaf = branch->GetLeaf(name.c_str());
+  if (branch->IsA() != TBranch::Class() ||
+      branch->GetListOfLeaves()->GetEntries() != 1 || leaf == nullptr ||
+      leaf->GetLenStatic() != 1 || leaf->GetLeafCount() != nullptr) {
+    throw std::invalid_argument("Event number branch '" + name +
+                                "' is not a scalar number");
+  }
+
+  std::vector<double> eventNumbers(static_cast<std::size_t>(tree.GetEntries()));
+  for (std::size_t entry = 0; entry < eventNumbers.size(); ++entry) {
+    branch->GetEntry(static_cast<Long64_t>(entry));
+    eventNumbers[entry] = leaf->GetValue();
+  }
+  return eventNumbers;
+}
+
+}  // namespace
+
+void RootPerThreadWriter::mergeThreadFiles() const {
+  // All thread files are open at once, so that every entry is read in order
+  // from its own file without switching files in between
+  struct Input {
+    std::unique_ptr<TFile> file;
+    TTree* tree = nullptr;
+    /// Entries of the tree ordered by event number
+    std::vector<Long64_t> entries;
+    std::vector<double> eventNumbers;
+    std::size_t next = 0;
+  };
+  std::vector<Input> inputs;
+  for (std::size_t i = 0; i < m_writers.size(); ++i) {
+    if (m_writers[i] == nullptr) {
+      continue;
+    }
+    const std::string path = threadFilePath(i);
+    Input& input = inputs.emplace_back();
+    input.file.reset(TFile::Open(path.c_str(), "READ"));
+    if (input.file == nullptr) {
+      throw std::ios_base::failure("Could not open '" + path + "'");
+    }
+    input.tree = input.file->Get<TTree>(m_cfg.treeName.c_str());
+    if (input.tree == nullptr) {
+      throw std::runtime_error("Could not read tree '" + m_cfg.treeName +
+                               "' from '" + path + "'");
+    }
+
+    const Long64_t nEntries = input.tree->GetEntries();
+    input.entries.resize(static_cast<std::size_t>(nEntries));
+    std::iota(input.entries.begin(), input.entries.end(), 0);
+    if (!m_cfg.eventNumberBranch.empty()) {
+      // The entries of a thread are usually ordered already. Entries of one
+      // event are all written by the same thread, so the stable sort keeps
+      // their relative order.
+      input.eventNumbers =
+          readEventNumbers(*input.tree, m_cfg.eventNumberBranch);
+      std::ranges::stable_sort(input.entries, {}, [&](Long64_t entry) {
+        return input.eventNumbers[static_cast<std::size_t>(entry)];
+      });
+    }
+  }
+  if (inputs.empty()) {
+    return;
+  }
+
+  std::unique_ptr<TFile> outputFile(
+      TFile::Open(m_cfg.filePath.c_str(), "RECREATE"));
+  if (outputFile == nullptr) {
+    throw std::ios_base::failure("Could not open '" + m_cfg.filePath + "'");
+  }
+  outputFile->cd();
+  TTree* mergedTree = inputs.front().tree->CloneTree(0);
+  if (mergedTree == nullptr) {
+    throw std::runtime_error("Could not clone tree '" + m_cfg.treeName + "'");
+  }
+
+  // K-way merge over the thread files, ties between files cannot occur since
+  // an event is written by a single thread
+  auto eventNumber = [](const Input& input) {
+    return input.eventNumbers.empty()
+               ? 0.
+               : input.eventNumbers[static_cast<std::size_t>(
+                     input.entries[input.next])];
+  };
+  Long64_t nMerged = 0;
+  const Input* current = nullptr;
+  while (true) {
+    Input* selected = nullptr;
+    for (Input& input : inputs) {
+      if (input.next == input.entries.size()) {
+        continue;
+      }
+      if (selected == nullptr || eventNumber(input) < eventNumber(*selected)) {
+        selected = &input;
+      }
+    }
+    if (selected == nullptr) {
+      break;
+    }
+
+    selected->tree->GetEntry(selected->entries[selected->next++]);
+    if (selected != current) {
+      // Point the merged branches to the buffers of the selected tree
+      selected->tree->CopyAddresses(mergedTree);
+      current = selected;
+    }
+    mergedTree->Fill();
+    ++nMerged;
+  }
+
+  // Detach the merged tree from the buffers of the input trees and close the
+  // inputs while the merged tree still exists
+  mergedTree->ResetBranchAddresses();
+  mergedTree->Write();
+  const std::size_t nInputs = inputs.size();
+  inputs.clear();
+  outputFile->Close();
+
+  ACTS_INFO("Merged " << nMerged << " entries of tree '" << m_cfg.treeName
+                      << "' from " << nInputs << " files into '"
+                      << m_cfg.filePath << "'");
+}
+
+}  // namespace ActsExamples
@@ -78,6 +78,8 @@ RootPropagationSummaryWriter::RootPropagationSummaryWriter(
 
   m_outputTree->Branch("nRenavigations", &m_nRenavigations);
   m_outputTree->Branch("nVolumeSwitches", &m_nVolumeSwitches);
+  m_outputTree->Branch("nCandidateCacheHits", &m_nCandidateCacheHits);
+  m_outputTree->Branch("nCandidateCacheMisses", &m_nCandidateCacheMisses);
 }
 
 RootPropagationSummaryWriter::~RootPropagationSummaryWriter() {
@@ -165,6 +167,9 @@ ProcessCode RootPropagationSummaryWriter::writeT(
     // Navigator statistics
     m_nRenavigations = summary.statistics.navigation.nRenavigations;
     m_nVolumeSwitches = summary.statistics.navigation.nVolumeSwitches;
+    m_nCandidateCacheHits = summary.statistics.navigation.nCandidateCacheHits;
+    m_nCandidateCacheMisses =
+        summary.statistics.navigation.nCandidateCacheMisses;
 
     m_outputTree->Fill();
   }
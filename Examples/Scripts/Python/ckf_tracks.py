@@ -20,6 +20,7 @@ def runCKFTracks(
     truthSmearedSeeded=False,
     truthEstimatedSeeded=False,
     inputParticlePath: Optional[Path] = None,
+    seedBatchSize: Optional[int] = None,
     s=None,
 ):
     from acts.examples.simulation import (
@@ -174,6 +175,8 @@ def runCKFTracks(
             numMeasurementsCutOff=10,
             seedDeduplication=True if not truthSmearedSeeded else False,
             stayOnSeed=True if not truthSmearedSeeded else False,
+            parallelSeeds=seedBatchSize is not None,
+            seedBatchSize=seedBatchSize,
         ),
         outputDirRoot=outputDir,
         outputDirCsv=outputDir / "csv" if outputCsv else None,
@@ -19,9 +19,12 @@ from acts.examples import (
     Sequencer,
     WhiteBoard,
     MaterialMapping,
+    mergeMaterialAccumulators,
 )
 
 from acts.examples.root import (
+    RootMaterialAccumulatorReader,
+    RootMaterialAccumulatorWriter,
     RootMaterialTrackReader,
     RootMaterialTrackWriter,
     RootMaterialWriter,
@@ -35,34 +38,10 @@ from acts.examples.json import (
 from acts.examples.odd import getOpenDataDetector, getOpenDataDetectorDirectory
 
 
-def runMaterialMapping(
+def createMaterialMapper(
     surfaces: list[Surface],
-    inputFile: Path,
-    outputFileBase: str,
-    outputMapFormats: list[str] = ["json", "root"],
     loglevel: acts.logging.Level = acts.logging.INFO,
-    outputMaterialTracks: str = "material_tracks",
-    treeName: str = "material_tracks",
 ):
-    # Create a sequencer
-    print("Creating the sequencer with 1 thread (inter event information needed)")
-
-    s = Sequencer(numThreads=1)
-
-    # IO for material tracks reading
-    wb = WhiteBoard(acts.logging.INFO)
-
-    # Read material step information from a ROOT TTRee
-    s.addReader(
-        RootMaterialTrackReader(
-            level=acts.logging.INFO,
-            outputMaterialTracks=outputMaterialTracks,
-            treeName=treeName,
-            fileList=[str(inputFile)],
-            readCachedSurfaceInformation=False,
-        )
-    )
-
     # Assignment setup : Intersection assigner
     materialAssingerConfig = IntersectionMaterialAssigner.Config()
     materialAssingerConfig.surfaces = surfaces
@@ -81,6 +60,14 @@ def runMaterialMapping(
     materialMapperConfig.surfaceMaterialAccumulator = materialAccumulator
     materialMapper = MaterialMapper(materialMapperConfig, loglevel)
 
+    return materialMapper
+
+
+def createMaterialMapWriters(
+    outputFileBase: str,
+    outputMapFormats: list[str] = ["json", "root"],
+    loglevel: acts.logging.Level = acts.logging.INFO,
+):
     # Add the map writer(s)
     materialMapWriters = []
     # json map writer
@@ -109,6 +96,55 @@ def runMaterialMapping(
             )
         )
 
+    return materialMapWriters
+
+
+def runMaterialMapping(
+    surfaces: list[Surface],
+    inputFile: Path,
+    outputFileBase: str,
+    outputMapFormats: list[str] = ["json", "root"],
+    loglevel: acts.logging.Level = acts.logging.INFO,
+    outputMaterialTracks: str = "material_tracks",
+    treeName: str = "material_tracks",
+    numThreads: int = 1,
+    writeAccumulator: bool = False,
+):
+    # Create a sequencer, the per-thread mapping states are merged at the end
+    s = Sequencer(numThreads=numThreads)
+
+    # IO for material tracks reading
+    wb = WhiteBoard(acts.logging.INFO)
+
+    # Read material step information from a ROOT TTRee
+    s.addReader(
+        RootMaterialTrackReader(
+            level=acts.logging.INFO,
+            outputMaterialTracks=outputMaterialTracks,
+            treeName=treeName,
+            fileList=[str(inputFile)],
+            readCachedSurfaceInformation=False,
+        )
+    )
+
+    materialMapper = createMaterialMapper(surfaces, loglevel)
+
+    # Partial jobs only write the accumulated material, the maps are created
+    # once by merging all of them
+    materialMapWriters = []
+    materialAccumulatorWriters = []
+    if writeAccumulator:
+        materialAccumulatorWriters.append(
+            RootMaterialAccumulatorWriter(
+                level=loglevel,
+                filePath=outputFileBase + "_accumulator.root",
+            )
+        )
+    else:
+        materialMapWriters = createMaterialMapWriters(
+            outputFileBase, outputMapFormats, loglevel
+        )
+
     # Mapping Algorithm
     materialMappingConfig = MaterialMapping.Config()
     materialMappingConfig.materialMapper = materialMapper
@@ -116,6 +152,7 @@ def runMaterialMapping(
     materialMappingConfig.mappedMaterialTracks = outputMaterialTracks + "_mapped"
     materialMappingConfig.unmappedMaterialTracks = outputMaterialTracks + "_unmapped"
     materialMappingConfig.materialWriters = materialMapWriters
+    materialMappingConfig.accumulatorWriters = materialAccumulatorWriters
     materialMapping = MaterialMapping(materialMappingConfig, loglevel)
     s.addAlgorithm(materialMapping)
 
@@ -144,6 +181,28 @@ def runMaterialMapping(
     return s
 
 
+def mergeMaterialMaps(
+    surfaces: list[Surface],
+    accumulatorFiles: list[Path],
+    outputFileBase: str,
+    outputMapFormats: list[str] = ["json", "root"],
+    loglevel: acts.logging.Level = acts.logging.INFO,
+):
+    """Create the material maps from the output of partial mapping jobs"""
+    reader = RootMaterialAccumulatorReader(
+        level=loglevel,
+        fileList=[str(f) for f in accumulatorFiles],
+    )
+    mergeMaterialAccumulators(
+        materialMapper=createMaterialMapper(surfaces, loglevel),
+        geoContext=GeometryContext.dangerouslyDefaultConstruct(),
+        readers=[reader],
+        materialWriters=createMaterialMapWriters(
+            outputFileBase, outputMapFormats, loglevel
+        ),
+    )
+
+
 if "__main__" == __name__:
     p = argparse.ArgumentParser()
 
@@ -176,6 +235,28 @@ if "__main__" == __name__:
         help="Input material track collection name",
     )
 
+    p.add_argument(
+        "-j",
+        "--threads",
+        type=int,
+        default=1,
+        help="Number of threads, results are not bit identical for more than one",
+    )
+
+    p.add_argument(
+        "--partial",
+        action="store_true",
+        help="Only write the accumulated material, to be merged with --merge",
+    )
+
+    p.add_argument(
+        "--merge",
+        type=str,
+        nargs="+",
+        default=[],
+        help="Create the maps from accumulated material files of partial jobs",
+    )
+
     args = p.parse_args()
     logLevel = logging.INFO
 
@@ -188,6 +269,16 @@ if "__main__" == __name__:
 
     materialSurfaces = trackingGeometry.extractMaterialSurfaces()
 
+    if args.merge:
+        mergeMaterialMaps(
+            materialSurfaces,
+            accumulatorFiles=[Path(f) for f in args.merge],
+            outputFileBase=args.output,
+            outputMapFormats=["json", "root"],
+            loglevel=logLevel,
+        )
+        exit(0)
+
     runMaterialMapping(
         materialSurfaces,
         inputFile=Path(args.input),
@@ -196,4 +287,6 @@ if "__main__" == __name__:
         loglevel=logLevel,
         outputMaterialTracks=args.material_tracks_name,
         treeName=args.tree_name,
+        numThreads=args.threads,
+        writeAccumulator=args.partial,
     ).run()
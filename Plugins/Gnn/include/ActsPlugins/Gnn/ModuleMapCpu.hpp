@@ -0,0 +1,140 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Utilities/Logger.hpp"
+#include "ActsPlugins/Gnn/Stages.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace ActsPlugins {
+
+/// @addtogroup gnn_plugin
+/// @{
+
+/// CPU-based module map for graph construction
+///
+/// Builds the same graph as @ref ModuleMapCuda: the doublet cuts of the
+/// module map select candidate edges between hits on connected modules, and
+/// an edge is kept if it is part of at least one hit triplet that passes the
+/// triplet cuts. The node features are expected to contain r, phi, z and eta
+/// as their first four columns.
+///
+/// The doublets and triplets are processed as tasks of the calling TBB task
+/// arena, so the graph construction shares the threads of the event loop.
+class ModuleMapCpu final : public GraphConstructionBase {
+ public:
+  /// Allowed ranges of the geometric quantities of a hit pair
+  struct DoubletCuts {
+    /// Minimum of the longitudinal impact parameter
+    float z0Min = 0.f;
+    /// Maximum of the longitudinal impact parameter
+    float z0Max = 0.f;
+    /// Minimum of the pseudorapidity difference
+    float dEtaMin = 0.f;
+    /// Maximum of the pseudorapidity difference
+    float dEtaMax = 0.f;
+    /// Minimum of the azimuthal difference per radial distance
+    float phiSlopeMin = 0.f;
+    /// Maximum of the azimuthal difference per radial distance
+    float phiSlopeMax = 0.f;
+    /// Minimum of the azimuthal difference
+    float dPhiMin = 0.f;
+    /// Maximum of the azimuthal difference
+    float dPhiMax = 0.f;
+  };
+
+  /// Connection between two modules
+  struct ModuleDoublet {
+    /// Module of the inner hit
+    std::uint64_t module1 = 0;
+    /// Module of the outer hit
+    std::uint64_t module2 = 0;
+    /// Cuts applied to the hit pairs
+    DoubletCuts cuts;
+  };
+
+  /// Connection between three modules
+  struct ModuleTriplet {
+    /// Module of the inner hit
+    std::uint64_t module1 = 0;
+    /// Module of the middle hit
+    std::uint64_t module2 = 0;
+    /// Module of the outer hit
+    std::uint64_t module3 = 0;
+    /// Cuts applied to the inner hit pair
+    DoubletCuts cuts12;
+    /// Cuts applied to the outer hit pair
+    DoubletCuts cuts23;
+    /// Minimum of the difference of the transverse slopes
+    float diffDyDxMin = 0.f;
+    /// Maximum of the difference of the transverse slopes
+    float diffDyDxMax = 0.f;
+    /// Minimum of the difference of the longitudinal slopes
+    float diffDzDrMin = 0.f;
+    /// Maximum of the difference of the longitudinal slopes
+    float diffDzDrMax = 0.f;
+  };
+
+  /// The module map. Every module pair used by a triplet must also be present
+  /// as a doublet.
+  struct ModuleMap {
+    /// Module doublets
+    std::vector<ModuleDoublet> doublets;
+    /// Module triplets
+    std::vector<ModuleTriplet> triplets;
+  };
+
+  /// Configuration for ModuleMapCpu
+  struct Config {
+    /// The module map to use
+    std::shared_ptr<const ModuleMap> moduleMap;
+    /// Radial coordinate scaling factor
+    float rScale = 1.0;
+    /// Azimuthal coordinate scaling factor
+    float phiScale = 1.0;
+    /// Z-coordinate scaling factor
+    float zScale = 1.0;
+    /// Pseudorapidity scaling factor
+    float etaScale = 1.0;
+
+    /// Small numerical constant for stability
+    float epsilon = 1e-8f;
+  };
+
+  /// Constructor
+  /// @param cfg Configuration parameters
+  /// @param logger Logger instance
+  ModuleMapCpu(const Config &cfg, std::unique_ptr<const Acts::Logger> logger);
+
+  ~ModuleMapCpu() override;
+
+  /// Access configuration
+  /// @return Configuration reference
+  const auto &config() const { return m_cfg; }
+
+  PipelineTensors operator()(std::vector<float> &inputValues,
+                             std::size_t numNodes,
+                             const std::vector<std::uint64_t> &moduleIds,
+                             const ExecutionContext &execContext = {}) override;
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> m_impl;
+
+  Config m_cfg;
+  std::unique_ptr<const Acts::Logger> m_logger;
+
+  const auto &logger() const { return *m_logger; }
+};
+
+/// @}
+}  // namespace ActsPlugins
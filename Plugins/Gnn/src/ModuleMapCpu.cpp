@@ -0,0 +1,547 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "ActsPlugins/Gnn/ModuleMapCpu.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <numbers>
+#include <stdexcept>
+#include <unordered_map>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+
+using namespace Acts;
+
+namespace {
+
+constexpr float g_pi = std::numbers::pi_v<float>;
+
+/// Same as detail::resetAngle in ModuleMapUtils.cuh
+float resetAngle(float angle) {
+  if (angle > g_pi) {
+    return angle - 2.f * g_pi;
+  }
+  if (angle < -g_pi) {
+    return angle + 2.f * g_pi;
+  }
+  return angle;
+}
+
+/// Geometric quantities of a hit pair that are subject to the cuts, as
+/// computed by the doublet kernels of the ModuleMapGraph library
+/// (build_doublet_edges, hits_geometric_cuts) that ModuleMapCuda launches
+struct DoubletQuantities {
+  float z0 = 0.f;
+  float dEta = 0.f;
+  float phiSlope = 0.f;
+  float dPhi = 0.f;
+};
+
+bool passCuts(const ActsPlugins::ModuleMapCpu::DoubletCuts &cuts,
+              const DoubletQuantities &q) {
+  // Evaluate all comparisons without short-circuiting, this allows the
+  // compiler to vectorise the loops calling this
+  return (q.z0 >= cuts.z0Min) & (q.z0 <= cuts.z0Max) &
+         (q.dEta >= cuts.dEtaMin) & (q.dEta <= cuts.dEtaMax) &
+         (q.phiSlope >= cuts.phiSlopeMin) & (q.phiSlope <= cuts.phiSlopeMax) &
+         (q.dPhi >= cuts.dPhiMin) & (q.dPhi <= cuts.dPhiMax);
+}
+
+/// Scaled hit coordinates in structure-of-arrays layout, grouped by module
+struct HitData {
+  std::vector<float> r, phi, z, eta, x, y;
+  /// node index of each hit
+  std::vector<std::uint32_t> node;
+  /// first hit of each module, the last entry is the number of hits
+  std::vector<std::size_t> moduleBegin;
+};
+
+/// Split @p n items with the cumulative work @p workPrefix into @p nParts
+/// contiguous ranges of about the same work.
+std::vector<std::size_t> splitByWork(const std::vector<std::size_t> &workPrefix,
+                                     std::size_t nParts) {
+  const std::size_t n = workPrefix.size() - 1;
+  std::vector<std::size_t> bounds(nParts + 1, n);
+  bounds.front() = 0;
+  for (std::size_t p = 1; p < nParts; ++p) {
+    const std::size_t target = workPrefix.back() * p / nParts;
+    bounds[p] = static_cast<std::size_t>(
+        std::lower_bound(workPrefix.begin(), workPrefix.end(), target) -
+        workPrefix.begin());
+    bounds[p] = std::clamp(bounds[p], bounds[p - 1], n);
+  }
+  return bounds;
+}
+
+/// Number of ranges the work is split into, a few per thread of the current
+/// task arena so that the scheduler can balance the remaining imbalance
+std::size_t numParts(std::size_t nItems) {
+  const auto nThreads =
+      static_cast<std::size_t>(tbb::this_task_arena::max_concurrency());
+  return std::max<std::size_t>(std::min(4 * nThreads, nItems), 1);
+}
+
+/// Call @p func(part, begin, end) for each range as tasks of the current task
+/// arena
+template <typename func_t>
+void runParts(const std::vector<std::size_t> &bounds, func_t &&func) {
+  tbb::parallel_for(tbb::blocked_range<std::size_t>(0, bounds.size() - 1, 1),
+                    [&](const tbb::blocked_range<std::size_t> &parts) {
+                      for (std::size_t p = parts.begin(); p != parts.end();
+                           ++p) {
+                        func(p, bounds[p], bounds[p + 1]);
+                      }
+                    });
+}
+
+}  // namespace
+
+namespace ActsPlugins {
+
+class ModuleMapCpu::Impl {
+ public:
+  struct Doublet {
+    std::uint32_t module1 = 0;
+    std::uint32_t module2 = 0;
+    DoubletCuts cuts;
+  };
+
+  struct Triplet {
+    std::uint32_t doublet12 = 0;
+    std::uint32_t doublet23 = 0;
+    const ModuleTriplet *cuts = nullptr;
+  };
+
+  /// sorted module ids, the position is used as module index
+  std::vector<std::uint64_t> moduleIds;
+  std::vector<Doublet> doublets;
+  std::vector<Triplet> triplets;
+
+  /// Edges that passed the doublet cuts, ordered by doublet, source and
+  /// target hit
+  struct DoubletEdges {
+    std::vector<std::uint32_t> src, tgt;
+    std::vector<DoubletQuantities> quantities;
+  };
+
+  HitData prepareHits(const std::vector<float> &inputValues,
+                      std::size_t nFeatures,
+                      const std::vector<std::uint64_t> &hitModuleIds,
+                      const Config &cfg) const;
+
+  void buildDoubletEdges(const HitData &hits, const Config &cfg,
+                         DoubletEdges &edges,
+                         std::vector<std::size_t> &doubletBegin) const;
+
+  void applyTripletCuts(const HitData &hits, const Config &cfg,
+                        const DoubletEdges &edges,
+                        const std::vector<std::size_t> &doubletBegin,
+                        std::vector<std::atomic<bool>> &keep) const;
+};
+
+ModuleMapCpu::ModuleMapCpu(const Config &cfg,
+                           std::unique_ptr<const Logger> logger_)
+    : m_impl(std::make_unique<Impl>()),
+      m_cfg(cfg),
+      m_logger(std::move(logger_)) {
+  if (m_cfg.moduleMap == nullptr) {
+    throw std::invalid_argument("ModuleMapCpu: no module map given");
+  }
+  const ModuleMap &moduleMap = *m_cfg.moduleMap;
+
+  for (const ModuleDoublet &doublet : moduleMap.doublets) {
+    m_impl->moduleIds.push_back(doublet.module1);
+    m_impl->moduleIds.push_back(doublet.module2);
+  }
+  std::ranges::sort(m_impl->moduleIds);
+  auto [last, end] = std::ranges::unique(m_impl->moduleIds);
+  m_impl->moduleIds.erase(last, end);
+
+  const auto moduleIndex = [this](std::uint64_t id) {
+    return static_cast<std::uint32_t>(
+        std::ranges::lower_bound(m_impl->moduleIds, id) -
+        m_impl->moduleIds.begin());
+  };
+  const auto doubletKey = [](std::uint32_t m1, std::uint32_t m2) {
+    return (static_cast<std::uint64_t>(m1) << 32) | m2;
+  };
+
+  std::unordered_map<std::uint64_t, std::uint32_t> doubletIndex;
+  m_impl->doublets.reserve(moduleMap.doublets.size());
+  for (const ModuleDoublet &doublet : moduleMap.doublets) {
+    const std::uint32_t m1 = moduleIndex(doublet.module1);
+    const std::uint32_t m2 = moduleIndex(doublet.module2);
+    const auto [it, success] =
+        doubletIndex.emplace(doubletKey(m1, m2), static_cast<std::uint32_t>(
+                                                     m_impl->doublets.size()));
+    if (!success) {
+      throw std::invalid_argument("ModuleMapCpu: duplicate doublet " +
+                                  std::to_string(doublet.module1) + " -> " +
+                                  std::to_string(doublet.module2));
+    }
+    m_impl->doublets.push_back({m1, m2, doublet.cuts});
+  }
+
+  const auto findDoublet = [&](std::uint64_t id1, std::uint64_t id2) {
+    const std::uint32_t m1 = moduleIndex(id1);
+    const std::uint32_t m2 = moduleIndex(id2);
+    auto it = doubletIndex.end();
+    if (m1 < m_impl->moduleIds.size() && m_impl->moduleIds[m1] == id1 &&
+        m2 < m_impl->moduleIds.size() && m_impl->moduleIds[m2] == id2) {
+      it = doubletIndex.find(doubletKey(m1, m2));
+    }
+    if (it == doubletIndex.end()) {
+      throw std::invalid_argument("ModuleMapCpu: triplet uses doublet " +
+                                  std::to_string(id1) + " -> " +
+                                  std::to_string(id2) +
+                                  " which is not in the module map");
+    }
+    return it->second;
+  };
+
+  m_impl->triplets.reserve(moduleMap.triplets.size());
+  for (const ModuleTriplet &triplet : moduleMap.triplets) {
+    m_impl->triplets.push_back({findDoublet(triplet.module1, triplet.module2),
+                                findDoublet(triplet.module2, triplet.module3),
+                                &triplet});
+  }
+
+  ACTS_DEBUG("# of modules = " << m_impl->moduleIds.size());
+  ACTS_DEBUG("# of doublets = " << m_impl->doublets.size());
+  ACTS_DEBUG("# of triplets = " << m_impl->triplets.size());
+}
+
+ModuleMapCpu::~ModuleMapCpu() = default;
+
+HitData ModuleMapCpu::Impl::prepareHits(
+    const std::vector<float> &inputValues, std::size_t nFeatures,
+    const std::vector<std::uint64_t> &hitModuleIds, const Config &cfg) const {
+  // Node features for module map graph
+  constexpr std::size_t rOffset = 0;
+  constexpr std::size_t phiOffset = 1;
+  constexpr std::size_t zOffset = 2;
+  constexpr std::size_t etaOffset = 3;
+
+  const std::size_t nModules = moduleIds.size();
+  const std::size_t nHits = hitModuleIds.size();
+
+  // Hits on modules that are not part of the module map are not used
+  std::vector<std::uint32_t> hitModule(nHits);
+  HitData hits;
+  hits.moduleBegin.assign(nModules + 1, 0);
+  for (std::size_t i = 0; i < nHits; ++i) {
+    const auto it = std::ranges::lower_bound(moduleIds, hitModuleIds[i]);
+    hitModule[i] = static_cast<std::uint32_t>(it - moduleIds.begin());
+    if (it != moduleIds.end() && *it == hitModuleIds[i]) {
+      ++hits.moduleBegin[hitModule[i] + 1];
+    } else {
+      hitModule[i] = static_cast<std::uint32_t>(nModules);
+    }
+  }
+  for (std::size_t m = 0; m < nModules; ++m) {
+    hits.moduleBegin[m + 1] += hits.moduleBegin[m];
+  }
+
+  const std::size_t nUsed = hits.moduleBegin.back();
+  for (auto *column :
+       {&hits.r, &hits.phi, &hits.z, &hits.eta, &hits.x, &hits.y}) {
+    column->resize(nUsed);
+  }
+  hits.node.resize(nUsed);
+
+  // Place the hits grouped by module, keeping the node order per module
+  std::vector<std::size_t> next(hits.moduleBegin.begin(),
+                                hits.moduleBegin.end() - 1);
+  for (std::size_t i = 0; i < nHits; ++i) {
+    if (hitModule[i] == nModules) {
+      continue;
+    }
+    const std::size_t k = next[hitModule[i]]++;
+    const float *features = inputValues.data() + i * nFeatures;
+    hits.node[k] = static_cast<std::uint32_t>(i);
+    hits.r[k] = features[rOffset] * cfg.rScale;
+    hits.phi[k] = features[phiOffset] * cfg.phiScale;
+    hits.z[k] = features[zOffset] * cfg.zScale;
+    hits.eta[k] = features[etaOffset] * cfg.etaScale;
+    const double r = hits.r[k];
+    const double phi = hits.phi[k];
+    hits.x[k] = static_cast<float>(r * std::cos(phi));
+    hits.y[k] = static_cast<float>(r * std::sin(phi));
+  }
+  return hits;
+}
+
+void ModuleMapCpu::Impl::buildDoubletEdges(
+    const HitData &hits, const Config &cfg, DoubletEdges &edges,
+    std::vector<std::size_t> &doubletBegin) const {
+  const auto nHitsOn = [&hits](std::uint32_t module) {
+    return hits.moduleBegin[module + 1] - hits.moduleBegin[module];
+  };
+
+  // balance the parts by the number of hit pairs to test
+  std::vector<std::size_t> workPrefix(doublets.size() + 1, 0);
+  for (std::size_t d = 0; d < doublets.size(); ++d) {
+    workPrefix[d + 1] = workPrefix[d] + nHitsOn(doublets[d].module1) *
+                                            nHitsOn(doublets[d].module2);
+  }
+  const std::size_t nParts = numParts(doublets.size());
+  const std::vector<std::size_t> bounds = splitByWork(workPrefix, nParts);
+
+  std::vector<DoubletEdges> partEdges(nParts);
+  doubletBegin.assign(doublets.size() + 1, 0);
+
+  runParts(bounds, [&](std::size_t part, std::size_t begin, std::size_t end) {
+    DoubletEdges &out = partEdges[part];
+    std::vector<DoubletQuantities> quantities;
+    std::vector<std::uint8_t> pass;
+
+    for (std::size_t d = begin; d < end; ++d) {
+      const Doublet &doublet = doublets[d];
+      const std::size_t b1 = hits.moduleBegin[doublet.module1];
+      const std::size_t e1 = hits.moduleBegin[doublet.module1 + 1];
+      const std::size_t b2 = hits.moduleBegin[doublet.module2];
+      const std::size_t e2 = hits.moduleBegin[doublet.module2 + 1];
+      quantities.resize(e2 - b2);
+      pass.resize(e2 - b2);
+
+      const std::size_t nBefore = out.src.size();
+      for (std::size_t i = b1; i < e1; ++i) {
+        const float r1 = hits.r[i];
+        const float z1 = hits.z[i];
+        const float eta1 = hits.eta[i];
+        const float phi1 = hits.phi[i];
+        // Branch-free loop over all hits of the outer module. The formulas
+        // follow hits_geometric_cuts, including the epsilon for dr = 0
+        for (std::size_t j = b2; j < e2; ++j) {
+          const float dr = hits.r[j] - r1;
+          const float drSafe = dr != 0.f ? dr : cfg.epsilon;
+          DoubletQuantities &q = quantities[j - b2];
+          q.z0 = z1 - r1 * (hits.z[j] - z1) / drSafe;
+          q.dEta = eta1 - hits.eta[j];
+          q.dPhi = resetAngle(hits.phi[j] - phi1);
+          q.phiSlope = q.dPhi / drSafe;
+          pass[j - b2] = passCuts(doublet.cuts, q);
+        }
+        for (std::size_t j = b2; j < e2; ++j) {
+          if (pass[j - b2] != 0) {
+            out.src.push_back(static_cast<std::uint32_t>(i));
+            out.tgt.push_back(static_cast<std::uint32_t>(j));
+            out.quantities.push_back(quantities[j - b2]);
+          }
+        }
+      }
+      // store the count for now, turned into offsets below
+      doubletBegin[d + 1] = out.src.size() - nBefore;
+    }
+  });
+
+  for (std::size_t d = 0; d < doublets.size(); ++d) {
+    doubletBegin[d + 1] += doubletBegin[d];
+  }
+
+  // concatenate in doublet order
+  edges.src.reserve(doubletBegin.back());
+  edges.tgt.reserve(doubletBegin.back());
+  edges.quantities.reserve(doubletBegin.back());
+  for (DoubletEdges &part : partEdges) {
+    edges.src.insert(edges.src.end(), part.src.begin(), part.src.end());
+    edges.tgt.insert(edges.tgt.end(), part.tgt.begin(), part.tgt.end());
+    edges.quantities.insert(edges.quantities.end(), part.quantities.begin(),
+                            part.quantities.end());
+  }
+}
+
+void ModuleMapCpu::Impl::applyTripletCuts(
+    const HitData &hits, const Config &cfg, const DoubletEdges &edges,
+    const std::vector<std::size_t> &doubletBegin,
+    std::vector<std::atomic<bool>> &keep) const {
+  const auto safe = [&cfg](float d) { return d != 0.f ? d : cfg.epsilon; };
+
+  // balance the parts by the number of inner edges
+  std::vector<std::size_t> workPrefix(triplets.size() + 1, 0);
+  for (std::size_t t = 0; t < triplets.size(); ++t) {
+    const std::uint32_t d12 = triplets[t].doublet12;
+    workPrefix[t + 1] =
+        workPrefix[t] + doubletBegin[d12 + 1] - doubletBegin[d12];
+  }
+  const std::vector<std::size_t> bounds =
+      splitByWork(workPrefix, numParts(triplets.size()));
+
+  runParts(bounds, [&](std::size_t /*part*/, std::size_t begin,
+                       std::size_t end) {
+    for (std::size_t t = begin; t < end; ++t) {
+      const Triplet &triplet = triplets[t];
+      const ModuleTriplet &cuts = *triplet.cuts;
+      const std::size_t begin23 = doubletBegin[triplet.doublet23];
+      const std::size_t end23 = doubletBegin[triplet.doublet23 + 1];
+      if (begin23 == end23) {
+        continue;
+      }
+
+      for (std::size_t e12 = doubletBegin[triplet.doublet12];
+           e12 < doubletBegin[triplet.doublet12 + 1]; ++e12) {
+        if (!passCuts(cuts.cuts12, edges.quantities[e12])) {
+          continue;
+        }
+        const std::uint32_t i = edges.src[e12];
+        const std::uint32_t j = edges.tgt[e12];
+        const float dzdr12 =
+            (hits.z[j] - hits.z[i]) / safe(hits.r[j] - hits.r[i]);
+        const float dydx12 =
+            (hits.y[j] - hits.y[i]) / safe(hits.x[j] - hits.x[i]);
+
+        // the outer edges are sorted by their source hit
+        const auto first = edges.src.begin() + begin23;
+        const auto last = edges.src.begin() + end23;
+        const auto [lo, hi] = std::equal_range(first, last, j);
+        for (auto it = lo; it != hi; ++it) {
+          const std::size_t e23 = it - edges.src.begin();
+          if (!passCuts(cuts.cuts23, edges.quantities[e23])) {
+            continue;
+          }
+          // slope differences as in the triplet_cuts kernel
+          const std::uint32_t k = edges.tgt[e23];
+          const float diffDzDr =
+              (hits.z[k] - hits.z[j]) / safe(hits.r[k] - hits.r[j]) - dzdr12;
+          const float diffDyDx =
+              (hits.y[k] - hits.y[j]) / safe(hits.x[k] - hits.x[j]) - dydx12;
+          if (diffDzDr < cuts.diffDzDrMin || diffDzDr > cuts.diffDzDrMax ||
+              diffDyDx < cuts.diffDyDxMin || diffDyDx > cuts.diffDyDxMax) {
+            continue;
+          }
+          keep[e12].store(true, std::memory_order_relaxed);
+          keep[e23].store(true, std::memory_order_relaxed);
+        }
+      }
+    }
+  });
+}
+
+PipelineTensors ModuleMapCpu::operator()(
+    std::vector<float> &inputValues, std::size_t numNodes,
+    const std::vector<std::uint64_t> &moduleIds,
+    const ExecutionContext &execContext) {
+  using Clock = std::chrono::high_resolution_clock;
+  auto t0 = Clock::now();
+
+  if (moduleIds.empty()) {
+    throw NoEdgesError{};
+  }
+  if (moduleIds.size() != numNodes || inputValues.size() % numNodes != 0) {
+    throw std::invalid_argument(
+        "ModuleMapCpu: inconsistent number of nodes, module ids and "
+        "features");
+  }
+  const std::size_t nFeatures = inputValues.size() / numNodes;
+  if (nFeatures < 4) {
+    throw std::invalid_argument(
+        "ModuleMapCpu: need at least r, phi, z and eta as node features");
+  }
+
+  const HitData hits =
+      m_impl->prepareHits(inputValues, nFeatures, moduleIds, m_cfg);
+
+  auto t1 = Clock::now();
+
+  Impl::DoubletEdges doubletEdges;
+  std::vector<std::size_t> doubletBegin;
+  m_impl->buildDoubletEdges(hits, m_cfg, doubletEdges, doubletBegin);
+  const std::size_t nDoubletEdges = doubletEdges.src.size();
+  ACTS_DEBUG("nb_doublet_edges: " << nDoubletEdges);
+  if (nDoubletEdges == 0) {
+    throw NoEdgesError{};
+  }
+
+  std::vector<std::atomic<bool>> keep(nDoubletEdges);
+  m_impl->applyTripletCuts(hits, m_cfg, doubletEdges, doubletBegin, keep);
+
+  std::vector<std::size_t> graphEdges;
+  graphEdges.reserve(nDoubletEdges);
+  for (std::size_t e = 0; e < nDoubletEdges; ++e) {
+    if (keep[e].load(std::memory_order_relaxed)) {
+      graphEdges.push_back(e);
+    }
+  }
+  const std::size_t nEdges = graphEdges.size();
+  ACTS_DEBUG("nb_graph_edges: " << nEdges);
+  if (nEdges == 0) {
+    throw NoEdgesError{};
+  }
+
+  auto t2 = Clock::now();
+
+  const ExecutionContext cpuContext{Device::Cpu(), {}};
+
+  auto nodeFeatures = Tensor<float>::Create({numNodes, nFeatures}, cpuContext);
+  std::copy(inputValues.begin(), inputValues.end(), nodeFeatures.data());
+
+  auto edgeIndex = Tensor<std::int64_t>::Create({2, nEdges}, cpuContext);
+  for (std::size_t e = 0; e < nEdges; ++e) {
+    edgeIndex.data()[e] = hits.node[doubletEdges.src[graphEdges[e]]];
+    edgeIndex.data()[nEdges + e] = hits.node[doubletEdges.tgt[graphEdges[e]]];
+  }
+
+  // Edge features from the unscaled node features, in the order of
+  // detail::makeEdgeFeatures in ModuleMapUtils.cuh: dr, dphi (in units of
+  // pi), dz, deta, phi slope and r times phi slope
+  enum NodeFeatures { r = 0, phi, z, eta };
+  constexpr std::size_t nEdgeFeatures = 6;
+  auto edgeFeatures =
+      Tensor<float>::Create({nEdges, nEdgeFeatures}, cpuContext);
+  for (std::size_t e = 0; e < nEdges; ++e) {
+    const float *src = inputValues.data() + edgeIndex.data()[e] * nFeatures;
+    const float *tgt =
+        inputValues.data() + edgeIndex.data()[nEdges + e] * nFeatures;
+
+    const float dr = tgt[r] - src[r];
+    const float dphi = resetAngle(g_pi * (tgt[phi] - src[phi])) / g_pi;
+    const float dz = tgt[z] - src[z];
+    const float deta = tgt[eta] - src[eta];
+    float phislope = 0.f;
+    float rphislope = 0.f;
+    if (dr != 0.f) {
+      phislope = std::clamp(dphi / dr, -100.f, 100.f);
+      rphislope = 0.5f * (tgt[r] + src[r]) * phislope;
+    }
+
+    float *efPtr = edgeFeatures.data() + e * nEdgeFeatures;
+    efPtr[0] = dr;
+    efPtr[1] = dphi;
+    efPtr[2] = dz;
+    efPtr[3] = deta;
+    efPtr[4] = phislope;
+    efPtr[5] = rphislope;
+  }
+
+  auto t3 = Clock::now();
+
+  auto ms = [](auto a, auto b) {
+    return std::chrono::duration<double, std::milli>(b - a).count();
+  };
+  ACTS_DEBUG("Preparation: " << ms(t0, t1));
+  ACTS_DEBUG("Inference: " << ms(t1, t2));
+  ACTS_DEBUG("Postprocessing: " << ms(t2, t3));
+
+  if (!execContext.device.isCpu()) {
+    return {nodeFeatures.clone(execContext),
+            edgeIndex.clone(execContext),
+            edgeFeatures.clone(execContext),
+            {}};
+  }
+  return {std::move(nodeFeatures),
+          std::move(edgeIndex),
+          std::move(edgeFeatures),
+          {}};
+}
+
+}  // namespace ActsPlugins
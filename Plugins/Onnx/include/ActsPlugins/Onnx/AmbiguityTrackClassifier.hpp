@@ -14,9 +14,11 @@
 #include "Acts/EventData/TrackProxyConcept.hpp"
 #include "Acts/TrackFinding/detail/AmbiguityTrackClustering.hpp"
 #include "Acts/Utilities/VectorHelpers.hpp"
+#include "ActsPlugins/Onnx/OnnxInferenceService.hpp"
 #include "ActsPlugins/Onnx/OnnxRuntimeBase.hpp"
 
 #include <map>
+#include <memory>
 #include <unordered_map>
 #include <vector>
 
@@ -34,7 +36,26 @@ class AmbiguityTrackClassifier {
   /// @param modelPath path to the model file
   explicit AmbiguityTrackClassifier(const char* modelPath)
       : m_env(ORT_LOGGING_LEVEL_WARNING, "MLClassifier"),
-        m_duplicateClassifier(m_env, modelPath) {}
+        m_duplicateClassifier(
+            std::make_shared<OnnxRuntimeBase>(m_env, modelPath)) {}
+
+  /// Construct the ambiguity scoring algorithm with batched inference, the
+  /// inference calls of concurrent callers are combined into shared batches.
+  ///
+  /// @param modelPath path to the model file
+  /// @param batchConfig configuration of the batching
+  AmbiguityTrackClassifier(const char* modelPath,
+                           const OnnxInferenceService::Config& batchConfig)
+      : AmbiguityTrackClassifier(modelPath) {
+    m_inferenceService = std::make_unique<OnnxInferenceService>(
+        m_duplicateClassifier, batchConfig);
+  }
+
+  /// Access the batching inference service
+  /// @return the service, or nullptr if the inference is not batched
+  const OnnxInferenceService* inferenceService() const {
+    return m_inferenceService.get();
+  }
 
   /// Compute a score for each track to be used in the track selection
   ///
@@ -74,7 +95,9 @@ class AmbiguityTrackClassifier {
     }
     // Use the network to compute a score for all the tracks.
     std::vector<std::vector<float>> outputTensor =
-        m_duplicateClassifier.runONNXInference(networkInput);
+        m_inferenceService != nullptr
+            ? m_inferenceService->runONNXInference(networkInput)
+            : m_duplicateClassifier->runONNXInference(networkInput);
     return outputTensor;
   }
 
@@ -109,7 +132,9 @@ class AmbiguityTrackClassifier {
   // ONNX environment
   Ort::Env m_env;
   // ONNX model for the duplicate neural network
-  OnnxRuntimeBase m_duplicateClassifier;
+  std::shared_ptr<OnnxRuntimeBase> m_duplicateClassifier;
+  // Optional service batching the inference calls of concurrent events
+  std::unique_ptr<OnnxInferenceService> m_inferenceService;
 };
 
 /// @}
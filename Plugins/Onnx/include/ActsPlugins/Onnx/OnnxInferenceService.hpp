@@ -0,0 +1,137 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "ActsPlugins/Onnx/OnnxRuntimeBase.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <iosfwd>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace ActsPlugins {
+/// @addtogroup onnx_plugin
+/// @{
+
+/// Thread-safe inference service that combines the requests of concurrent
+/// callers, e.g. different events, into batched calls of one model.
+///
+/// A request is held back until either enough entries are queued to fill a
+/// batch, or the oldest queued request has waited for the configured maximum
+/// latency. The batches are run on a dedicated thread with input and output
+/// buffers that are reused between calls.
+class OnnxInferenceService {
+ public:
+  /// Configuration of the batching
+  struct Config {
+    /// Maximum number of entries combined into one inference call. A single
+    /// request with more entries is run as its own batch.
+    std::size_t maxBatchSize = 4096;
+    /// Maximum time a request waits for other requests to join its batch
+    std::chrono::microseconds maxLatency{1000};
+  };
+
+  /// Counters of the processed requests
+  struct Statistics {
+    /// Number of requests
+    std::size_t nRequests = 0;
+    /// Number of inference calls
+    std::size_t nBatches = 0;
+    /// Number of entries over all requests
+    std::size_t nEntries = 0;
+    /// Time spent in the inference calls
+    std::chrono::nanoseconds inferenceTime{0};
+    /// Summed time from the submission of a request to its result
+    std::chrono::nanoseconds totalLatency{0};
+    /// Longest time from the submission of a request to its result
+    std::chrono::nanoseconds maxLatency{0};
+  };
+
+  /// Runs the model on a batch, see OnnxRuntimeBase::runONNXInference
+  using InferenceFunction = std::function<void(
+      std::span<float> input, std::size_t batchSize, std::span<float> output)>;
+
+  /// @param model the model to run, needs a dynamic batch dimension
+  /// @param cfg the batching configuration
+  OnnxInferenceService(std::shared_ptr<const OnnxRuntimeBase> model,
+                       const Config& cfg);
+
+  /// @param inference runs the model on a batch of entries
+  /// @param inputSize number of input values per entry
+  /// @param outputSize number of output values per entry
+  /// @param cfg the batching configuration
+  OnnxInferenceService(InferenceFunction inference, std::size_t inputSize,
+                       std::size_t outputSize, const Config& cfg);
+
+  OnnxInferenceService(const OnnxInferenceService&) = delete;
+  OnnxInferenceService& operator=(const OnnxInferenceService&) = delete;
+
+  /// Finishes the queued requests and stops the inference thread
+  ~OnnxInferenceService();
+
+  /// Run the model on the given entries, blocks until the result is available
+  ///
+  /// @param inputTensorValues the input values, one row per entry
+  ///
+  /// @return The output values of the first model output, one vector per entry
+  std::vector<std::vector<float>> runONNXInference(
+      const NetworkBatchInput& inputTensorValues) const;
+
+  /// Access the configuration
+  /// @return the batching configuration
+  const Config& config() const { return m_cfg; }
+
+  /// Snapshot of the counters
+  /// @return the statistics of the requests processed so far
+  Statistics statistics() const;
+
+ private:
+  using Clock = std::chrono::steady_clock;
+
+  struct Request;
+
+  void start();
+  void processBatches();
+  void runBatch(const std::vector<Request*>& batch);
+
+  Config m_cfg;
+  InferenceFunction m_inference;
+  std::size_t m_inputSize = 0;
+  std::size_t m_outputSize = 0;
+
+  mutable std::mutex m_mutex;
+  mutable std::condition_variable m_queueChanged;
+  mutable std::deque<Request*> m_queue;
+  mutable std::size_t m_queuedEntries = 0;
+  bool m_stop = false;
+  Statistics m_statistics;
+
+  // only used by the inference thread
+  std::vector<float> m_inputBuffer;
+  std::vector<float> m_outputBuffer;
+
+  std::thread m_thread;
+};
+
+/// Print the counters together with the derived rates
+/// @param os the output stream
+/// @param stats the statistics to print
+/// @return the output stream
+std::ostream& operator<<(std::ostream& os,
+                         const OnnxInferenceService::Statistics& stats);
+
+/// @}
+}  // namespace ActsPlugins
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <span>
 #include <vector>
 
 #include <Eigen/Dense>
@@ -61,6 +62,28 @@ class OnnxRuntimeBase {
   std::vector<std::vector<std::vector<float>>> runONNXInferenceMultiOutput(
       NetworkBatchInput& inputTensorValues) const;
 
+  /// @brief Run the ONNX inference function on caller-owned buffers
+  ///
+  /// Only the first output of the model is computed. No memory is allocated
+  /// for the input and output values, which allows reusing the buffers for
+  /// repeated calls.
+  ///
+  /// @param inputTensorValues Row-major input values of @p batchSize entries
+  /// @param batchSize Number of entries in the batch
+  /// @param outputTensorValues Receives the @p batchSize times outputSize()
+  ///        output values
+  void runONNXInference(std::span<float> inputTensorValues,
+                        std::size_t batchSize,
+                        std::span<float> outputTensorValues) const;
+
+  /// @brief Number of input values per entry
+  /// @return The product of the non-batch dimensions of the input node
+  std::size_t inputSize() const;
+
+  /// @brief Number of values per entry of the first output
+  /// @return The product of the non-batch dimensions of the first output node
+  std::size_t outputSize() const;
+
  private:
   /// ONNX runtime session / model properties
   std::unique_ptr<Ort::Session> m_session;
@@ -8,8 +8,10 @@
 
 #pragma once
 
+#include "ActsPlugins/Onnx/OnnxInferenceService.hpp"
 #include "ActsPlugins/Onnx/OnnxRuntimeBase.hpp"
 
+#include <memory>
 #include <vector>
 
 #include <onnxruntime_cxx_api.h>
@@ -26,7 +28,26 @@ class SeedClassifier {
   /// @param modelPath path to the model file
   explicit SeedClassifier(const char* modelPath)
       : m_env(ORT_LOGGING_LEVEL_WARNING, "MLSeedClassifier"),
-        m_duplicateClassifier(m_env, modelPath) {};
+        m_duplicateClassifier(
+            std::make_shared<OnnxRuntimeBase>(m_env, modelPath)) {}
+
+  /// Construct the scoring algorithm with batched inference, the inference
+  /// calls of concurrent callers are combined into shared batches.
+  ///
+  /// @param modelPath path to the model file
+  /// @param batchConfig configuration of the batching
+  SeedClassifier(const char* modelPath,
+                 const OnnxInferenceService::Config& batchConfig)
+      : SeedClassifier(modelPath) {
+    m_inferenceService = std::make_unique<OnnxInferenceService>(
+        m_duplicateClassifier, batchConfig);
+  }
+
+  /// Access the batching inference service
+  /// @return the service, or nullptr if the inference is not batched
+  const OnnxInferenceService* inferenceService() const {
+    return m_inferenceService.get();
+  }
 
   /// Compute a score for each seed to be used in the seed selection
   ///
@@ -36,7 +57,9 @@ class SeedClassifier {
       NetworkBatchInput& networkInput) const {
     // Use the network to compute a score for all the Seeds.
     std::vector<std::vector<float>> outputTensor =
-        m_duplicateClassifier.runONNXInference(networkInput);
+        m_inferenceService != nullptr
+            ? m_inferenceService->runONNXInference(networkInput)
+            : m_duplicateClassifier->runONNXInference(networkInput);
     return outputTensor;
   }
 
@@ -88,7 +111,9 @@ class SeedClassifier {
   // ONNX environment
   Ort::Env m_env;
   // ONNX model for the duplicate neural network
-  OnnxRuntimeBase m_duplicateClassifier;
+  std::shared_ptr<OnnxRuntimeBase> m_duplicateClassifier;
+  // Optional service batching the inference calls of concurrent events
+  std::unique_ptr<OnnxInferenceService> m_inferenceService;
 };
 
 /// @}
@@ -0,0 +1,220 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "ActsPlugins/Onnx/OnnxInferenceService.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <future>
+#include <ostream>
+#include <stdexcept>
+
+namespace ActsPlugins {
+
+struct OnnxInferenceService::Request {
+  const NetworkBatchInput* input = nullptr;
+  Clock::time_point submitted;
+  std::promise<std::vector<std::vector<float>>> result;
+};
+
+OnnxInferenceService::OnnxInferenceService(
+    std::shared_ptr<const OnnxRuntimeBase> model, const Config& cfg)
+    : m_cfg(cfg) {
+  if (model == nullptr) {
+    throw std::invalid_argument("OnnxInferenceService: no model given");
+  }
+  m_inputSize = model->inputSize();
+  m_outputSize = model->outputSize();
+  m_inference = [model = std::move(model)](std::span<float> input,
+                                           std::size_t batchSize,
+                                           std::span<float> output) {
+    model->runONNXInference(input, batchSize, output);
+  };
+  start();
+}
+
+OnnxInferenceService::OnnxInferenceService(InferenceFunction inference,
+                                           std::size_t inputSize,
+                                           std::size_t outputSize,
+                                           const Config& cfg)
+    : m_cfg(cfg),
+      m_inference(std::move(inference)),
+      m_inputSize(inputSize),
+      m_outputSize(outputSize) {
+  if (!m_inference) {
+    throw std::invalid_argument("OnnxInferenceService: no model given");
+  }
+  start();
+}
+
+void OnnxInferenceService::start() {
+  if (m_cfg.maxBatchSize == 0) {
+    throw std::invalid_argument(
+        "OnnxInferenceService: maximum batch size must be positive");
+  }
+  m_inputBuffer.reserve(m_cfg.maxBatchSize * m_inputSize);
+  m_outputBuffer.reserve(m_cfg.maxBatchSize * m_outputSize);
+
+  m_thread = std::thread([this]() { processBatches(); });
+}
+
+OnnxInferenceService::~OnnxInferenceService() {
+  {
+    std::lock_guard lock(m_mutex);
+    m_stop = true;
+  }
+  m_queueChanged.notify_all();
+  m_thread.join();
+}
+
+std::vector<std::vector<float>> OnnxInferenceService::runONNXInference(
+    const NetworkBatchInput& inputTensorValues) const {
+  if (inputTensorValues.rows() == 0) {
+    return {};
+  }
+  if (static_cast<std::size_t>(inputTensorValues.cols()) != m_inputSize) {
+    throw std::invalid_argument(
+        "OnnxInferenceService: number of input features doesn't match the "
+        "model");
+  }
+
+  Request request;
+  request.input = &inputTensorValues;
+  request.submitted = Clock::now();
+  auto result = request.result.get_future();
+  {
+    std::lock_guard lock(m_mutex);
+    m_queue.push_back(&request);
+    m_queuedEntries += inputTensorValues.rows();
+  }
+  m_queueChanged.notify_all();
+
+  return result.get();
+}
+
+OnnxInferenceService::Statistics OnnxInferenceService::statistics() const {
+  std::lock_guard lock(m_mutex);
+  return m_statistics;
+}
+
+void OnnxInferenceService::processBatches() {
+  std::vector<Request*> batch;
+
+  std::unique_lock lock(m_mutex);
+  while (true) {
+    m_queueChanged.wait(lock, [this]() { return m_stop || !m_queue.empty(); });
+    if (m_queue.empty()) {
+      return;
+    }
+
+    // Give other requests the chance to join, the remaining requests are
+    // flushed without waiting when stopping
+    const Clock::time_point deadline =
+        m_queue.front()->submitted + m_cfg.maxLatency;
+    m_queueChanged.wait_until(lock, deadline, [this]() {
+      return m_stop || m_queuedEntries >= m_cfg.maxBatchSize;
+    });
+
+    batch.clear();
+    std::size_t nEntries = 0;
+    while (!m_queue.empty()) {
+      const std::size_t rows = m_queue.front()->input->rows();
+      if (!batch.empty() && nEntries + rows > m_cfg.maxBatchSize) {
+        break;
+      }
+      batch.push_back(m_queue.front());
+      m_queue.pop_front();
+      nEntries += rows;
+    }
+    m_queuedEntries -= nEntries;
+
+    lock.unlock();
+    const Clock::time_point start = Clock::now();
+    runBatch(batch);
+    const Clock::time_point end = Clock::now();
+    lock.lock();
+
+    m_statistics.nRequests += batch.size();
+    m_statistics.nBatches += 1;
+    m_statistics.nEntries += nEntries;
+    m_statistics.inferenceTime += end - start;
+  }
+}
+
+void OnnxInferenceService::runBatch(const std::vector<Request*>& batch) {
+  std::size_t nEntries = 0;
+  for (const Request* request : batch) {
+    nEntries += request->input->rows();
+  }
+
+  // The buffers only grow, so that the allocations are amortised
+  m_inputBuffer.resize(nEntries * m_inputSize);
+  m_outputBuffer.resize(nEntries * m_outputSize);
+
+  auto inputIt = m_inputBuffer.begin();
+  for (const Request* request : batch) {
+    inputIt = std::copy_n(request->input->data(), request->input->size(),
+                          inputIt);
+  }
+
+  std::exception_ptr error;
+  try {
+    m_inference(m_inputBuffer, nEntries, m_outputBuffer);
+  } catch (...) {
+    error = std::current_exception();
+  }
+
+  // Hand out the results, the requests are owned by the waiting callers and
+  // must not be touched after their result is set
+  std::chrono::nanoseconds totalLatency{0};
+  std::chrono::nanoseconds maxLatency{0};
+  auto outputIt = m_outputBuffer.cbegin();
+  for (Request* request : batch) {
+    const auto rows = static_cast<std::size_t>(request->input->rows());
+    const auto latency = Clock::now() - request->submitted;
+    totalLatency += latency;
+    maxLatency = std::max<std::chrono::nanoseconds>(maxLatency, latency);
+
+    if (error != nullptr) {
+      request->result.set_exception(error);
+      continue;
+    }
+    std::vector<std::vector<float>> output(rows);
+    for (std::vector<float>& entry : output) {
+      entry.assign(outputIt, outputIt + m_outputSize);
+      outputIt += m_outputSize;
+    }
+    request->result.set_value(std::move(output));
+  }
+
+  std::lock_guard lock(m_mutex);
+  m_statistics.totalLatency += totalLatency;
+  m_statistics.maxLatency = std::max(m_statistics.maxLatency, maxLatency);
+}
+
+std::ostream& operator<<(std::ostream& os,
+                         const OnnxInferenceService::Statistics& stats) {
+  using Seconds = std::chrono::duration<double>;
+  using Milliseconds = std::chrono::duration<double, std::milli>;
+
+  const double nBatches = std::max<std::size_t>(stats.nBatches, 1);
+  const double nRequests = std::max<std::size_t>(stats.nRequests, 1);
+  const double inferenceTime = Seconds(stats.inferenceTime).count();
+
+  os << stats.nRequests << " requests in " << stats.nBatches
+     << " batches, mean batch size " << stats.nEntries / nBatches
+     << " entries, throughput "
+     << (inferenceTime > 0 ? stats.nEntries / inferenceTime : 0.)
+     << " entries/s, mean latency "
+     << Milliseconds(stats.totalLatency).count() / nRequests
+     << " ms, max latency " << Milliseconds(stats.maxLatency).count()
+     << " ms";
+  return os;
+}
+
+}  // namespace ActsPlugins
@@ -8,9 +8,27 @@
 
 #include "ActsPlugins/Onnx/OnnxRuntimeBase.hpp"
 
+#include <algorithm>
 #include <cassert>
+#include <functional>
+#include <numeric>
 #include <stdexcept>
 
+namespace {
+
+// Number of values per entry, i.e. the product of the non-batch dimensions
+std::size_t entrySize(const std::vector<std::int64_t>& nodeDims) {
+  if (std::any_of(nodeDims.begin() + 1, nodeDims.end(),
+                  [](std::int64_t dim) { return dim < 0; })) {
+    throw std::runtime_error(
+        "runONNXInference: only the batch dimension can be dynamic");
+  }
+  return std::accumulate(nodeDims.begin() + 1, nodeDims.end(), std::size_t{1},
+                         std::multiplies<>{});
+}
+
+}  // namespace
+
 // Parametrized constructor
 ActsPlugins::OnnxRuntimeBase::OnnxRuntimeBase(Ort::Env& env,
                                               const char* modelPath) {
@@ -147,3 +165,53 @@ ActsPlugins::OnnxRuntimeBase::runONNXInferenceMultiOutput(
   }
   return multiOutput;
 }
+
+std::size_t ActsPlugins::OnnxRuntimeBase::inputSize() const {
+  return entrySize(m_inputNodeDims);
+}
+
+std::size_t ActsPlugins::OnnxRuntimeBase::outputSize() const {
+  return entrySize(m_outputNodeDims.at(0));
+}
+
+// Inference function on caller-owned buffers, only the first output is
+// computed
+void ActsPlugins::OnnxRuntimeBase::runONNXInference(
+    std::span<float> inputTensorValues, std::size_t batchSize,
+    std::span<float> outputTensorValues) const {
+  std::vector<std::int64_t> inputNodeDims = m_inputNodeDims;
+  std::vector<std::int64_t> outputNodeDims = m_outputNodeDims.at(0);
+  const auto batch = static_cast<std::int64_t>(batchSize);
+
+  // The first dim node should correspond to the batch size
+  // If it is -1, it is dynamic and should be set to the batch size
+  for (auto* nodeDims : {&inputNodeDims, &outputNodeDims}) {
+    if (nodeDims->front() == -1) {
+      nodeDims->front() = batch;
+    } else if (nodeDims->front() != batch) {
+      throw std::runtime_error(
+          "runONNXInference: batch size doesn't match the input or output "
+          "node size");
+    }
+  }
+
+  if (inputTensorValues.size() != batchSize * inputSize() ||
+      outputTensorValues.size() != batchSize * outputSize()) {
+    throw std::invalid_argument(
+        "runONNXInference: buffer sizes don't match the batch size");
+  }
+
+  Ort::MemoryInfo memoryInfo =
+      Ort::MemoryInfo::CreateCpu(OrtArenaAllocator, OrtMemTypeDefault);
+  Ort::Value inputTensor = Ort::Value::CreateTensor<float>(
+      memoryInfo, inputTensorValues.data(), inputTensorValues.size(),
+      inputNodeDims.data(), inputNodeDims.size());
+  Ort::Value outputTensor = Ort::Value::CreateTensor<float>(
+      memoryInfo, outputTensorValues.data(), outputTensorValues.size(),
+      outputNodeDims.data(), outputNodeDims.size());
+
+  Ort::RunOptions run_options;
+  m_session->Run(run_options, m_inputNodeNames.data(), &inputTensor,
+                 m_inputNodeNames.size(), m_outputNodeNames.data(),
+                 &outputTensor, 1);
+}
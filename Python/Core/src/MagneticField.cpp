@@ -8,6 +8,7 @@
 
 #include "Acts/Definitions/Units.hpp"
 #include "Acts/MagneticField/BFieldMapUtils.hpp"
+#include "Acts/MagneticField/BinaryMagneticFieldIo.hpp"
 #include "Acts/MagneticField/ConstantBField.hpp"
 #include "Acts/MagneticField/MagneticFieldContext.hpp"
 #include "Acts/MagneticField/MagneticFieldProvider.hpp"
@@ -97,6 +98,44 @@ void addMagneticField(py::module_& m) {
              std::shared_ptr<InterpolatedMagneticField3>>(
       m, "InterpolatedMagneticField3");
 
+  py::class_<MappedBFieldMapRz, InterpolatedMagneticField,
+             MagneticFieldProvider, std::shared_ptr<MappedBFieldMapRz>>(
+      m, "MappedMagneticField2");
+
+  py::class_<MappedBFieldMapXyz, InterpolatedMagneticField,
+             MagneticFieldProvider, std::shared_ptr<MappedBFieldMapXyz>>(
+      m, "MappedMagneticField3");
+
+  m.def(
+      "writeMagneticFieldMapToBinary",
+      [](const InterpolatedMagneticField2& map, const std::string& file) {
+        writeMagneticFieldMapRzToBinary(map, file);
+      },
+      py::arg("map"), py::arg("file"));
+
+  m.def(
+      "writeMagneticFieldMapToBinary",
+      [](const InterpolatedMagneticField3& map, const std::string& file) {
+        writeMagneticFieldMapXyzToBinary(map, file);
+      },
+      py::arg("map"), py::arg("file"));
+
+  m.def(
+      "MagneticFieldMapRzFromBinary",
+      [](const std::string& file) {
+        return std::make_shared<MappedBFieldMapRz>(
+            makeMagneticFieldMapRzFromBinary(file));
+      },
+      py::arg("file"));
+
+  m.def(
+      "MagneticFieldMapXyzFromBinary",
+      [](const std::string& file) {
+        return std::make_shared<MappedBFieldMapXyz>(
+            makeMagneticFieldMapXyzFromBinary(file));
+      },
+      py::arg("file"));
+
   py::class_<NullBField, MagneticFieldProvider, std::shared_ptr<NullBField>>(
       m, "NullBField")
       .def(py::init<>());
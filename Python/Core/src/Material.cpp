@@ -116,6 +116,7 @@ void addMaterial(py::module_& m) {
                 py::arg("config"), py::arg("level"))
             .def("createState", &BinnedSurfaceMaterialAccumulator::createState)
             .def("accumulate", &BinnedSurfaceMaterialAccumulator::accumulate)
+            .def("merge", &BinnedSurfaceMaterialAccumulator::merge)
             .def("finalizeMaterial",
                  &BinnedSurfaceMaterialAccumulator::finalizeMaterial);
 
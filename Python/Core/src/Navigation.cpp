@@ -9,6 +9,7 @@
 #include "Acts/Geometry/CylinderVolumeBounds.hpp"
 #include "Acts/Geometry/NavigationPolicyFactory.hpp"
 #include "Acts/Geometry/TrackingVolume.hpp"
+#include "Acts/Navigation/BoundingVolumeHierarchyNavigationPolicy.hpp"
 #include "Acts/Navigation/SurfaceArrayNavigationPolicy.hpp"
 #include "Acts/Navigation/TryAllNavigationPolicy.hpp"
 #include "Acts/Surfaces/CylinderBounds.hpp"
@@ -69,6 +70,15 @@ void addNavigation(py::module_& m) {
     ACTS_PYTHON_STRUCT(c, portals, sensitives);
   }
 
+  {
+    auto bvh = py::class_<BoundingVolumeHierarchyNavigationPolicy>(
+        m, "BoundingVolumeHierarchyNavigationPolicy");
+    using Config = BoundingVolumeHierarchyNavigationPolicy::Config;
+    auto c = py::class_<Config>(bvh, "Config").def(py::init<>());
+    ACTS_PYTHON_STRUCT(c, portals, sensitives, passives, envelope, maxLeafSize,
+                       quarterSegments);
+  }
+
   py::class_<NavigationPolicyFactory, std::shared_ptr<NavigationPolicyFactory>>(
       m, "NavigationPolicyFactory")
       // only to mirror the C++ API
@@ -78,6 +88,11 @@ void addNavigation(py::module_& m) {
              auto mod = py::module_::import("acts");
              if (py::object o = mod.attr("TryAllNavigationPolicy"); cls.is(o)) {
                return std::move(*self).template add<TryAllNavigationPolicy>();
+             } else if (py::object b = mod.attr(
+                            "BoundingVolumeHierarchyNavigationPolicy");
+                        cls.is(b)) {
+               return std::move(*self)
+                   .template add<BoundingVolumeHierarchyNavigationPolicy>();
              } else {
                throw std::invalid_argument(
                    "Unknown navigation policy class: " +
@@ -115,6 +130,22 @@ void addNavigation(py::module_& m) {
                  config);
            })
 
+      .def("add",
+           [](NavigationPolicyFactory* self, const py::object& cls,
+              const BoundingVolumeHierarchyNavigationPolicy::Config& config) {
+             auto mod = py::module_::import("acts");
+             if (py::object o =
+                     mod.attr("BoundingVolumeHierarchyNavigationPolicy");
+                 !cls.is(o)) {
+               throw std::invalid_argument(
+                   "Unknown navigation policy class: " +
+                   cls.attr("__name__").cast<std::string>());
+             }
+
+             return std::move(*self)
+                 .template add<BoundingVolumeHierarchyNavigationPolicy>(config);
+           })
+
       .def("_buildTest", [](NavigationPolicyFactory* self) {
         auto vol1 = std::make_shared<TrackingVolume>(
             Transform3::Identity(),
@@ -35,3 +35,12 @@ def test_try_all_arguments():
     acts.NavigationPolicyFactory.make().add(
         acts.TryAllNavigationPolicy, acts.TryAllNavigationPolicy.Config(sensitives=True)
     )
+
+
+def test_bounding_volume_hierarchy_arguments():
+    policy = acts.NavigationPolicyFactory.make().add(
+        acts.BoundingVolumeHierarchyNavigationPolicy,
+        acts.BoundingVolumeHierarchyNavigationPolicy.Config(maxLeafSize=2),
+    )
+
+    policy._buildTest()
@@ -205,6 +205,8 @@ CkfConfig = namedtuple(
         "useJosephFormulation",
         "constrainToVolumes",
         "endOfWorldVolumes",
+        "parallelSeeds",
+        "seedBatchSize",
     ],
     defaults=[
         15.0,
@@ -221,6 +223,8 @@ CkfConfig = namedtuple(
         False,
         None,
         None,
+        None,
+        None,
     ],
 )
 
@@ -1739,6 +1743,8 @@ def addCKFTracks(
             useJosephFormulation=ckfConfig.useJosephFormulation,
             constrainToVolumeIds=ckfConfig.constrainToVolumes,
             endOfWorldVolumeIds=ckfConfig.endOfWorldVolumes,
+            parallelSeeds=ckfConfig.parallelSeeds,
+            seedBatchSize=ckfConfig.seedBatchSize,
         ),
     )
     s.addAlgorithm(trackFinder)
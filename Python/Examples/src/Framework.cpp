@@ -383,7 +383,14 @@ void addFramework(py::module& mex) {
 
   ACTS_PYTHON_STRUCT(c, skip, events, logLevel, numThreads, outputDir,
                      outputTimingFile, trackFpes, fpeMasks, failOnFirstFpe,
-                     failOnUnmaskedFpe, fpeStackTraceLength);
+                     failOnUnmaskedFpe, fpeStackTraceLength,
+                     dataFlowScheduling, maxInFlightEvents, readerStageMode,
+                     algorithmStageMode, writerStageMode, whiteBoardSlots);
+
+  py::enum_<Sequencer::StageMode>(sequencer, "StageMode")
+      .value("Parallel", Sequencer::StageMode::Parallel)
+      .value("SerialInOrder", Sequencer::StageMode::SerialInOrder)
+      .value("SerialOutOfOrder", Sequencer::StageMode::SerialOutOfOrder);
 
   auto fpem =
       py::class_<Sequencer::FpeMask>(sequencer, "_FpeMask")
@@ -16,6 +16,7 @@
 #include "ActsExamples/Io/Csv/CsvSimHitReader.hpp"
 #include "ActsExamples/Io/Csv/CsvSpacePointReader.hpp"
 #include "ActsExamples/Io/Csv/CsvTrackParameterReader.hpp"
+#include "ActsExamples/MaterialMapping/IMaterialAccumulatorReader.hpp"
 #include "ActsExamples/TrackFinding/ITrackParamsLookupReader.hpp"
 #include "ActsPython/Utilities/Helpers.hpp"
 #include "ActsPython/Utilities/Macros.hpp"
@@ -65,6 +66,10 @@ void addInput(py::module& mex) {
   py::class_<ITrackParamsLookupReader,
              std::shared_ptr<ITrackParamsLookupReader>>(
       mex, "ITrackParamsLookupReader");
+
+  py::class_<IMaterialAccumulatorReader,
+             std::shared_ptr<IMaterialAccumulatorReader>>(
+      mex, "IMaterialAccumulatorReader");
 }
 
 }  // namespace ActsPython
@@ -54,9 +54,23 @@ void addMaterialMapping(py::module& mex) {
           py::arg("geoContext"));
     ACTS_PYTHON_STRUCT(c, inputMaterialTracks, mappedMaterialTracks,
                        unmappedMaterialTracks, geoContext, materialMapper,
-                       materialWriters);
+                       materialWriters, accumulatorWriters);
   }
 
+  mex.def(
+      "mergeMaterialAccumulators",
+      [](const Acts::MaterialMapper& materialMapper,
+         const Acts::GeometryContext& gctx,
+         const std::vector<std::shared_ptr<IMaterialAccumulatorReader>>&
+             readers,
+         const std::vector<std::shared_ptr<IMaterialWriter>>& materialWriters) {
+        // the maps are handed to the writers, only those are used from python
+        mergeMaterialAccumulators(materialMapper, gctx, readers,
+                                  materialWriters);
+      },
+      py::arg("materialMapper"), py::arg("geoContext"), py::arg("readers"),
+      py::arg("materialWriters"));
+
   {
     py::class_<MappingMaterialDecorator, IMaterialDecorator,
                std::shared_ptr<MappingMaterialDecorator>>(
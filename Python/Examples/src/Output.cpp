@@ -7,6 +7,7 @@
 // file, You can obtain one at https://mozilla.org/MPL/2.0/.
 
 #include "Acts/Utilities/Logger.hpp"
+#include "ActsExamples/Framework/AsyncWriter.hpp"
 #include "ActsExamples/Io/Csv/CsvBFieldWriter.hpp"
 #include "ActsExamples/Io/Csv/CsvGnnGraphWriter.hpp"
 #include "ActsExamples/Io/Csv/CsvMeasurementWriter.hpp"
@@ -22,6 +23,7 @@
 #include "ActsExamples/Io/Obj/ObjPropagationStepsWriter.hpp"
 #include "ActsExamples/Io/Obj/ObjSimHitWriter.hpp"
 #include "ActsExamples/Io/Obj/ObjTrackingGeometryWriter.hpp"
+#include "ActsExamples/MaterialMapping/IMaterialAccumulatorWriter.hpp"
 #include "ActsExamples/MaterialMapping/IMaterialWriter.hpp"
 #include "ActsExamples/TrackFinding/ITrackParamsLookupWriter.hpp"
 #include "ActsPython/Utilities/Macros.hpp"
@@ -62,6 +64,10 @@ void register_csv_bfield_writer_binding(pybind11::class_<CsvBFieldWriter>& w) {
 namespace ActsPython {
 
 void addOutput(py::module& mex) {
+  // Asynchronous writer
+  ACTS_PYTHON_DECLARE_WRITER(AsyncWriter, mex, "AsyncWriter", downstreamWriter,
+                             queueSize);
+
   {
     using Writer = ObjTrackingGeometryWriter;
     auto w =
@@ -151,6 +157,10 @@ void addOutput(py::module& mex) {
   py::class_<IMaterialWriter, std::shared_ptr<IMaterialWriter>>(
       mex, "IMaterialWriter");
 
+  py::class_<IMaterialAccumulatorWriter,
+             std::shared_ptr<IMaterialAccumulatorWriter>>(
+      mex, "IMaterialAccumulatorWriter");
+
   py::class_<ITrackParamsLookupWriter,
              std::shared_ptr<ITrackParamsLookupWriter>>(
       mex, "ITrackParamsLookupWriter");
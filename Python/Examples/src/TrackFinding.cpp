@@ -103,7 +103,7 @@ void addTrackFinding(py::module& mex) {
       inputSpacePoints, outputSeeds, trackingGeometry, qOverPtMin,
       qOverPtMinBinSize, phiMinBinSize, threshold, noiseThreshold, deduplicate,
       inverseA, doSecondPhase, zRange, cotThetaRange, cotThetaMinBinSize,
-      zMinBinSize);
+      zMinBinSize, parallelExploration, parallelGrainSize);
 
   ACTS_PYTHON_DECLARE_ALGORITHM(MuonHoughSeeder, mex, "MuonHoughSeeder",
                                 inTruthSegments, inSpacePoints, outHoughMax,
@@ -148,7 +148,9 @@ void addTrackFinding(py::module& mex) {
         measurementSelectorCfg, trackSelectorCfg, maxSteps, twoWay,
         reverseSearch, seedDeduplication, stayOnSeed, pixelVolumeIds,
         stripVolumeIds, maxPixelHoles, maxStripHoles, trimTracks,
-        useJosephFormulation, constrainToVolumeIds, endOfWorldVolumeIds);
+        compactTrackStates, parallelSeeds, seedBatchSize,
+        navigationCandidateCache, useJosephFormulation, constrainToVolumeIds,
+        endOfWorldVolumeIds);
   }
 }
 
@@ -6,8 +6,10 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at https://mozilla.org/MPL/2.0/.
 
+#include "Acts/Geometry/TrackingGeometry.hpp"
 #include "ActsExamples/DetectorCommons/AlignmentDecorator.hpp"
 #include "ActsExamples/DetectorCommons/AlignmentGenerator.hpp"
+#include "ActsExamples/DetectorCommons/DeltaAlignmentStore.hpp"
 #include "ActsExamples/Framework/IContextDecorator.hpp"
 #include "ActsPython/Utilities/Helpers.hpp"
 #include "ActsPython/Utilities/Macros.hpp"
@@ -51,6 +53,21 @@ PYBIND11_MODULE(ActsExamplesPythonBindingsAlignment, m) {
              const std::unordered_map<GeometryIdentifier, Transform3>&>());
   }
 
+  {
+    py::class_<DeltaAlignmentStore, IAlignmentStore,
+               std::shared_ptr<DeltaAlignmentStore>>(m, "DeltaAlignmentStore")
+        .def(py::init<std::shared_ptr<const TrackingGeometry>>())
+        .def(py::init<
+             std::shared_ptr<const TrackingGeometry>,
+             const std::unordered_map<GeometryIdentifier, Transform3>&>())
+        .def("setTransform", &DeltaAlignmentStore::setTransform)
+        .def_property_readonly("numAlignedSurfaces",
+                               &DeltaAlignmentStore::numAlignedSurfaces)
+        .def_property_readonly("numBlocks", &DeltaAlignmentStore::numBlocks)
+        .def_property_readonly("numSharedBlocks",
+                               &DeltaAlignmentStore::numSharedBlocks);
+  }
+
   {
     py::class_<AlignmentGenerator::Nominal>(m, "AlignmentGeneratorNominal")
         .def(py::init<>())
@@ -34,11 +34,14 @@ PYBIND11_MODULE(ActsExamplesPythonBindingsOnnx, onnx) {
 
   ACTS_PYTHON_DECLARE_ALGORITHM(
       AmbiguityResolutionMLAlgorithm, onnx, "AmbiguityResolutionMLAlgorithm",
-      inputTracks, inputDuplicateNN, outputTracks, nMeasurementsMin);
+      inputTracks, inputDuplicateNN, outputTracks, nMeasurementsMin,
+      batchedInference, maxBatchSize, maxBatchLatency);
 
   ACTS_PYTHON_DECLARE_ALGORITHM(SeedFilterMLAlgorithm, onnx,
                                 "SeedFilterMLAlgorithm", inputTrackParameters,
                                 inputSeeds, inputSeedFilterNN,
                                 outputTrackParameters, outputSeeds,
-                                epsilonDBScan, minPointsDBScan, minSeedScore);
+                                epsilonDBScan, minPointsDBScan, minSeedScore,
+                                batchedInference, maxBatchSize,
+                                maxBatchLatency);
 }
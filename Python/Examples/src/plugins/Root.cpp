@@ -11,6 +11,8 @@
 #include "ActsExamples/Io/Root/RootAthenaDumpWriter.hpp"
 #include "ActsExamples/Io/Root/RootAthenaNTupleReader.hpp"
 #include "ActsExamples/Io/Root/RootBFieldWriter.hpp"
+#include "ActsExamples/Io/Root/RootMaterialAccumulatorReader.hpp"
+#include "ActsExamples/Io/Root/RootMaterialAccumulatorWriter.hpp"
 #include "ActsExamples/Io/Root/RootMaterialTrackReader.hpp"
 #include "ActsExamples/Io/Root/RootMaterialTrackWriter.hpp"
 #include "ActsExamples/Io/Root/RootMaterialWriter.hpp"
@@ -21,6 +23,7 @@
 #include "ActsExamples/Io/Root/RootNuclearInteractionParametersWriter.hpp"
 #include "ActsExamples/Io/Root/RootParticleReader.hpp"
 #include "ActsExamples/Io/Root/RootParticleWriter.hpp"
+#include "ActsExamples/Io/Root/RootPerThreadWriter.hpp"
 #include "ActsExamples/Io/Root/RootPropagationStepsWriter.hpp"
 #include "ActsExamples/Io/Root/RootPropagationSummaryWriter.hpp"
 #include "ActsExamples/Io/Root/RootSeedWriter.hpp"
@@ -145,6 +148,11 @@ PYBIND11_MODULE(ActsExamplesPythonBindingsRoot, root) {
                                inputParticles, filePath, fileMode, treeName,
                                referencePoint, bField, writeHelixParameters);
 
+    ACTS_PYTHON_DECLARE_WRITER(RootPerThreadWriter, root,
+                               "RootPerThreadWriter", writerFactory, filePath,
+                               treeName, eventNumberBranch, mergeFiles,
+                               keepThreadFiles);
+
     ACTS_PYTHON_DECLARE_WRITER(RootVertexWriter, root, "RootVertexWriter",
                                inputVertices, filePath, fileMode, treeName);
 
@@ -243,6 +251,30 @@ PYBIND11_MODULE(ActsExamplesPythonBindingsRoot, root) {
                          accessorOptions, filePath, fileMode);
     }
 
+    {
+      using Writer = RootMaterialAccumulatorWriter;
+      auto w = py::class_<Writer, IMaterialAccumulatorWriter,
+                          std::shared_ptr<Writer>>(
+                   root, "RootMaterialAccumulatorWriter")
+                   .def(py::init<const Writer::Config&, Logging::Level>(),
+                        py::arg("config"), py::arg("level"));
+
+      auto c = py::class_<Writer::Config>(w, "Config").def(py::init<>());
+      ACTS_PYTHON_STRUCT(c, filePath, fileMode, treeName);
+    }
+
+    {
+      using Reader = RootMaterialAccumulatorReader;
+      auto r = py::class_<Reader, IMaterialAccumulatorReader,
+                          std::shared_ptr<Reader>>(
+                   root, "RootMaterialAccumulatorReader")
+                   .def(py::init<const Reader::Config&, Logging::Level>(),
+                        py::arg("config"), py::arg("level"));
+
+      auto c = py::class_<Reader::Config>(r, "Config").def(py::init<>());
+      ACTS_PYTHON_STRUCT(c, fileList, treeName);
+    }
+
     ACTS_PYTHON_DECLARE_WRITER(RootSeedWriter, root, "RootSeedWriter",
                                inputSeeds, writingMode, filePath, fileMode,
                                treeName);
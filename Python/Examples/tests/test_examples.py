@@ -751,6 +751,55 @@ def test_ckf_tracks_example(
     assert all([f.stat().st_size > 300 for f in csv.iterdir()])
 
 
+@pytest.mark.parametrize(
+    "truthSmeared,seedBatchSize",
+    [
+        [True, 3],
+        # seeds deduplicated by earlier seeds of the same and earlier batches
+        [False, 3],
+        [False, 1024],
+    ],
+    ids=["truth_smeared", "full_seeding_small_batch", "full_seeding"],
+)
+@pytest.mark.slow
+def test_ckf_parallel_seeds(tmp_path, truthSmeared, seedBatchSize, detector_config):
+    pytest.importorskip("uproot")
+    from helpers.hash_root import hash_root_file
+    from ckf_tracks import runCKFTracks
+
+    field = acts.ConstantBField(acts.Vector3(0, 0, 2 * u.T))
+
+    hashes = []
+    for batchSize in [None, seedBatchSize]:
+        outputDir = tmp_path / ("sequential" if batchSize is None else "parallel")
+        outputDir.mkdir()
+        # several threads, so that the seeds of a batch are processed in
+        # parallel
+        s = Sequencer(events=10, numThreads=-1)
+        with detector_config.detector:
+            runCKFTracks(
+                detector_config.trackingGeometry,
+                detector_config.decorators,
+                field=field,
+                outputCsv=False,
+                outputDir=outputDir,
+                geometrySelection=detector_config.geometrySelection,
+                digiConfigFile=detector_config.digiConfigFile,
+                truthSmearedSeeded=truthSmeared,
+                seedBatchSize=batchSize,
+                s=s,
+            )
+            s.run()
+
+        summary = outputDir / "tracksummary_ckf.root"
+        assert summary.exists()
+        # the events are written in any order, but the tracks of each event
+        # are stored in one entry and have to be in the same order
+        hashes.append(hash_root_file(summary))
+
+    assert hashes[0] == hashes[1]
+
+
 @pytest.mark.skipif(not dd4hepEnabled, reason="DD4hep not set up")
 @pytest.mark.odd
 @pytest.mark.slow
@@ -9,6 +9,7 @@
 #include "ActsPlugins/Gnn/BoostTrackBuilding.hpp"
 #include "ActsPlugins/Gnn/CudaTrackBuilding.hpp"
 #include "ActsPlugins/Gnn/GnnPipeline.hpp"
+#include "ActsPlugins/Gnn/ModuleMapCpu.hpp"
 #include "ActsPlugins/Gnn/ModuleMapCuda.hpp"
 #include "ActsPlugins/Gnn/OnnxEdgeClassifier.hpp"
 #include "ActsPlugins/Gnn/TensorRTEdgeClassifier.hpp"
@@ -92,6 +93,33 @@ PYBIND11_MODULE(ActsPluginsPythonBindingsGnn, gnn) {
                                 modelPath, cut, device);
 #endif
 
+  ACTS_PYTHON_DECLARE_GNN_STAGE(ModuleMapCpu, GraphConstructionBase, gnn,
+                                moduleMap, rScale, phiScale, zScale, etaScale,
+                                epsilon);
+  {
+    using Alg = ModuleMapCpu;
+    py::object alg = gnn.attr("ModuleMapCpu");
+
+    auto cuts = py::class_<Alg::DoubletCuts>(alg, "DoubletCuts")
+                    .def(py::init<>());
+    ACTS_PYTHON_STRUCT(cuts, z0Min, z0Max, dEtaMin, dEtaMax, phiSlopeMin,
+                       phiSlopeMax, dPhiMin, dPhiMax);
+
+    auto doublet = py::class_<Alg::ModuleDoublet>(alg, "ModuleDoublet")
+                       .def(py::init<>());
+    ACTS_PYTHON_STRUCT(doublet, module1, module2, cuts);
+
+    auto triplet = py::class_<Alg::ModuleTriplet>(alg, "ModuleTriplet")
+                       .def(py::init<>());
+    ACTS_PYTHON_STRUCT(triplet, module1, module2, module3, cuts12, cuts23,
+                       diffDyDxMin, diffDyDxMax, diffDzDrMin, diffDzDrMax);
+
+    auto map = py::class_<Alg::ModuleMap, std::shared_ptr<Alg::ModuleMap>>(
+                   alg, "ModuleMap")
+                   .def(py::init<>());
+    ACTS_PYTHON_STRUCT(map, doublets, triplets);
+  }
+
 #ifdef ACTS_GNN_WITH_MODULEMAP
   ACTS_PYTHON_DECLARE_GNN_STAGE(ModuleMapCuda, GraphConstructionBase, gnn,
                                 moduleMapPath, rScale, phiScale, zScale,
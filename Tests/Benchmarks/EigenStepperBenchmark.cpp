@@ -6,6 +6,7 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at https://mozilla.org/MPL/2.0/.
 
+#include "Acts/Propagator/BatchedEigenStepper.hpp"
 #include "Acts/Propagator/EigenStepper.hpp"
 
 #include "StepperBenchmarkCommons.hpp"
@@ -20,8 +21,10 @@ int main(int argc, char* argv[]) {
   if (auto ret = benchmark.parseOptions(argc, argv)) {
     return *ret;
   }
-  auto bField = benchmark.makeField();
-  Stepper stepper(std::move(bField));
+  std::shared_ptr<const MagneticFieldProvider> bField = benchmark.makeField();
+  Stepper stepper(bField);
   benchmark.run(stepper, "EigenStepper");
+  benchmark.runBatched(BatchedEigenStepper<4>(bField), "BatchedEigenStepper4");
+  benchmark.runBatched(BatchedEigenStepper<8>(bField), "BatchedEigenStepper8");
   return 0;
 }
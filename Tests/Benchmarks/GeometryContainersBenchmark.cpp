@@ -0,0 +1,81 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/Geometry/TrackingGeometry.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "ActsExamples/EventData/GeometryContainers.hpp"
+#include "ActsExamples/EventData/Index.hpp"
+#include "ActsExamples/EventData/IndexSourceLink.hpp"
+#include "ActsTests/CommonHelpers/BenchmarkTools.hpp"
+#include "ActsTests/CommonHelpers/CylindricalTrackingGeometry.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace Acts;
+using namespace ActsExamples;
+using namespace ActsTests;
+
+int main(int /*argc*/, char** /*argv[]*/) {
+  // fraction of occupied modules and measurements per occupied module
+  constexpr double occupancy = 0.2;
+  constexpr std::size_t nMeasurementsPerModule = 3;
+
+  auto gctx = GeometryContext::dangerouslyDefaultConstruct();
+  CylindricalTrackingGeometry cGeometry(gctx);
+  std::shared_ptr<const TrackingGeometry> geometry = cGeometry();
+
+  std::mt19937 rng(1234);
+  std::bernoulli_distribution occupied(occupancy);
+
+  GeometryIdMultiset<IndexSourceLink> container;
+  std::vector<GeometryIdentifier> queries;
+  Index index = 0;
+  for (const Surface* surface : geometry->sensitiveSurfaces()) {
+    // the navigation queries occupied and empty modules alike
+    queries.push_back(surface->geometryId());
+    if (!occupied(rng)) {
+      continue;
+    }
+    for (std::size_t i = 0; i < nMeasurementsPerModule; ++i) {
+      container.emplace_hint(container.end(), surface->geometryId(), index++);
+    }
+  }
+  std::shuffle(queries.begin(), queries.end(), rng);
+
+  std::cout << "Container with " << container.size() << " elements, "
+            << queries.size() << " modules queried" << std::endl;
+
+  GeometryIdMultisetAccessor<IndexSourceLink> accessor;
+  accessor.container = &container;
+
+  std::cout << "Bucket by surface index" << std::endl;
+  auto bucketing = microBenchmark(
+      [&]() { accessor.bucketBySurfaceIndex(*geometry); }, 1, 1000);
+  std::cout << "  " << bucketing << std::endl;
+
+  std::cout << "Lookup with equal_range" << std::endl;
+  auto equalRange = microBenchmark(
+      [&](GeometryIdentifier geoId) { return container.equal_range(geoId); },
+      queries, 1000);
+  std::cout << "  " << equalRange << std::endl;
+
+  std::cout << "Lookup with bucketed rangeOf" << std::endl;
+  auto bucketed = microBenchmark(
+      [&](GeometryIdentifier geoId) { return accessor.rangeOf(geoId); },
+      queries, 1000);
+  std::cout << "  " << bucketed << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,120 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Acts/Geometry/GeometryHierarchyMap.hpp"
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "ActsTests/CommonHelpers/BenchmarkTools.hpp"
+
+#include <cstddef>
+#include <exception>
+#include <iostream>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+namespace po = boost::program_options;
+using namespace Acts;
+using namespace ActsTests;
+
+namespace {
+
+using Map = GeometryHierarchyMap<double>;
+
+// Build a map with a default per layer and many sensitive entries per layer,
+// similar to a per-module digitization or calibration configuration.
+std::vector<Map::InputElement> makeElements(std::size_t nVolumes,
+                                            std::size_t nLayers,
+                                            std::size_t nSensitives) {
+  std::vector<Map::InputElement> elements;
+  for (std::size_t vol = 1; vol <= nVolumes; ++vol) {
+    for (std::size_t lay = 2; lay <= 2 * nLayers; lay += 2) {
+      auto layerId = GeometryIdentifier().withVolume(vol).withLayer(lay);
+      elements.emplace_back(layerId, 1.);
+      // only every other module has a dedicated entry
+      for (std::size_t sen = 1; sen <= 2 * nSensitives; sen += 2) {
+        elements.emplace_back(layerId.withSensitive(sen), 2.);
+      }
+    }
+  }
+  return elements;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  std::size_t nVolumes = 0;
+  std::size_t nLayers = 0;
+  std::size_t nQueries = 0;
+  std::size_t nRuns = 0;
+
+  try {
+    po::options_description desc("Allowed options");
+    // clang-format off
+    desc.add_options()
+      ("help", "produce help message")
+      ("volumes", po::value<std::size_t>(&nVolumes)->default_value(10), "number of volumes")
+      ("layers", po::value<std::size_t>(&nLayers)->default_value(10), "number of layers per volume")
+      ("queries", po::value<std::size_t>(&nQueries)->default_value(1000), "number of lookups per run")
+      ("runs", po::value<std::size_t>(&nRuns)->default_value(1000), "number of runs");
+    // clang-format on
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.contains("help")) {
+      std::cout << desc << std::endl;
+      return 0;
+    }
+  } catch (std::exception& e) {
+    std::cerr << "error: " << e.what() << std::endl;
+    return 1;
+  }
+
+  for (std::size_t nSensitives : {10u, 100u, 1000u}) {
+    auto elements = makeElements(nVolumes, nLayers, nSensitives);
+    // identifiers with the extra level set disable the hash index
+    auto sortedElements = elements;
+    sortedElements.emplace_back(
+        GeometryIdentifier().withVolume(nVolumes + 1).withExtra(1), 3.);
+
+    Map indexed(std::move(elements));
+    Map sorted(std::move(sortedElements));
+
+    // half of the queries hit a sensitive entry, the other half falls back to
+    // the layer entry after going through the full sensitive range
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<std::size_t> volDist(1, nVolumes);
+    std::uniform_int_distribution<std::size_t> layDist(1, nLayers);
+    std::uniform_int_distribution<std::size_t> senDist(1, 2 * nSensitives);
+    std::vector<GeometryIdentifier> queries;
+    queries.reserve(nQueries);
+    for (std::size_t i = 0; i < nQueries; ++i) {
+      queries.push_back(GeometryIdentifier()
+                            .withVolume(volDist(rng))
+                            .withLayer(2 * layDist(rng))
+                            .withSensitive(senDist(rng)));
+    }
+
+    std::cout << "Map with " << indexed.size() << " elements, " << nSensitives
+              << " sensitive entries per layer" << std::endl;
+
+    const auto indexedResult = microBenchmark(
+        [&](const GeometryIdentifier& id) { return *indexed.find(id); },
+        queries, nRuns);
+    std::cout << "  hash index:    " << indexedResult << std::endl;
+
+    const auto sortedResult = microBenchmark(
+        [&](const GeometryIdentifier& id) { return *sorted.find(id); },
+        queries, nRuns);
+    std::cout << "  sorted search: " << sortedResult << std::endl;
+  }
+
+  return 0;
+}
@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include "Acts/Definitions/Direction.hpp"
+#include "Acts/Definitions/Tolerance.hpp"
 #include "Acts/Definitions/Units.hpp"
 #include "Acts/EventData/ParticleHypothesis.hpp"
 #include "Acts/Geometry/GeometryContext.hpp"
@@ -18,6 +20,7 @@
 #include "Acts/Utilities/Logger.hpp"
 #include "ActsTests/CommonHelpers/BenchmarkTools.hpp"
 
+#include <cmath>
 #include <iostream>
 
 #include <boost/program_options.hpp>
@@ -142,6 +145,84 @@ struct BenchmarkStepper {
     ACTS_INFO("average number of steps = " << 1.0 * numSteps / numIters);
     ACTS_INFO("step efficiency = " << 1.0 * numSteps / numStepTrials);
   }
+
+  /// Propagate the tracks in batches with a batched stepper, e.g.
+  /// `BatchedEigenStepper<N>`, that steps all lanes in lock-step. Since the
+  /// batched stepper does not transport the covariance, the `cov` option is
+  /// ignored.
+  template <typename BatchedStepper>
+  void runBatched(BatchedStepper stepper, const std::string& name) const {
+    constexpr std::size_t lanes = BatchedStepper::lanes;
+
+    // Create a test context
+    GeometryContext tgContext = GeometryContext::dangerouslyDefaultConstruct();
+    MagneticFieldContext mfContext = MagneticFieldContext();
+
+    ACTS_LOCAL_LOGGER(getDefaultLogger(name, Logging::Level(lvl)));
+
+    // print information about profiling setup
+    ACTS_INFO("propagating " << toys << " tracks with pT = " << ptInGeV
+                             << "GeV in a " << BzInT << "T B-field in batches"
+                             << " of " << lanes << " tracks");
+    if (withCov) {
+      ACTS_INFO("covariance transport is not supported, ignoring it");
+    }
+
+    typename BatchedStepper::Options options(tgContext, mfContext);
+    const double pathLimit = maxPathInM * UnitConstants::m;
+
+    BoundTrackParameters pars = BoundTrackParameters::createCurvilinear(
+        Vector4(0, 0, 0, 0), Vector3(1, 0, 0), +1 / ptInGeV, std::nullopt,
+        ParticleHypothesis::pion());
+
+    const std::size_t numBatches = (toys + lanes - 1) / lanes;
+    double totalPathLength = 0;
+    std::size_t numSteps = 0;
+    std::size_t numStepTrials = 0;
+    std::size_t numTracks = 0;
+    const auto propagationBenchResult = microBenchmark(
+        [&] {
+          auto state = stepper.makeState(options);
+          for (std::size_t i = 0; i < lanes; ++i) {
+            stepper.initialize(state, i, pars);
+          }
+          while (stepper.anyActive(state)) {
+            for (std::size_t i = 0; i < lanes; ++i) {
+              const double remaining =
+                  pathLimit - std::abs(state.pathAccumulated[i]);
+              if (remaining <= s_onSurfaceTolerance) {
+                stepper.deactivate(state, i);
+              } else {
+                stepper.setStepLimit(state, i, remaining);
+              }
+            }
+            stepper.step(state, Direction::Forward());
+          }
+          for (std::size_t i = 0; i < lanes; ++i) {
+            if (auto error = stepper.error(state, i); error) {
+              ACTS_ERROR("step failed in lane " << i << ": " << error);
+            }
+          }
+          if (totalPathLength == 0.) {
+            ACTS_DEBUG("reached position "
+                       << stepper.position(state, 0).transpose() << " in "
+                       << state.nSteps[0] << " steps");
+          }
+          for (std::size_t i = 0; i < lanes; ++i) {
+            totalPathLength += state.pathAccumulated[i];
+            numSteps += state.nSteps[i];
+            numStepTrials += state.nStepTrials[i];
+          }
+          numTracks += lanes;
+        },
+        1, numBatches);
+
+    ACTS_INFO("Execution stats: " << propagationBenchResult);
+    ACTS_INFO("average path length = " << totalPathLength / numTracks / 1_mm
+                                       << "mm");
+    ACTS_INFO("average number of steps = " << 1.0 * numSteps / numTracks);
+    ACTS_INFO("step efficiency = " << 1.0 * numSteps / numStepTrials);
+  }
 };
 
 }  // namespace ActsTests
@@ -0,0 +1,177 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/AmbiguityResolution/GreedyAmbiguityResolution.hpp"
+#include "Acts/EventData/SourceLink.hpp"
+#include "Acts/EventData/TrackContainer.hpp"
+#include "Acts/EventData/VectorMultiTrajectory.hpp"
+#include "Acts/EventData/VectorTrackContainer.hpp"
+#include "Acts/Utilities/TrackHelpers.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace Acts;
+
+namespace {
+
+using TestTrackContainer = TrackContainer<VectorTrackContainer,
+                                          VectorMultiTrajectory,
+                                          std::shared_ptr>;
+
+/// Creates random tracks which share measurements with each other
+TestTrackContainer createTracks(std::size_t nTracks,
+                                std::size_t nMeasurements) {
+  TestTrackContainer tracks{std::make_shared<VectorTrackContainer>(),
+                            std::make_shared<VectorMultiTrajectory>()};
+
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<std::size_t> nStatesDist(5, 12);
+  std::uniform_int_distribution<std::size_t> measurementDist(
+      0, nMeasurements - 1);
+  std::uniform_real_distribution<double> chi2Dist(0, 20);
+
+  for (std::size_t i = 0; i < nTracks; ++i) {
+    auto track = tracks.makeTrack();
+    std::size_t nStates = nStatesDist(rng);
+    for (std::size_t j = 0; j < nStates; ++j) {
+      auto ts = track.appendTrackState();
+      ts.typeFlags().setIsMeasurement();
+      ts.setUncalibratedSourceLink(SourceLink{measurementDist(rng)});
+    }
+    calculateTrackQuantities(track);
+    track.chi2() = static_cast<float>(chi2Dist(rng));
+    track.nDoF() = static_cast<unsigned int>(2 * nStates - 5);
+  }
+
+  return tracks;
+}
+
+std::size_t sourceLinkIndex(const SourceLink& sl) {
+  return sl.get<std::size_t>();
+}
+
+/// Straightforward implementation of the greedy eviction which scans all
+/// selected tracks in every iteration
+void resolveReference(const GreedyAmbiguityResolution::Config& cfg,
+                      GreedyAmbiguityResolution::State& state) {
+  auto relativeShared = [&state](std::size_t i) {
+    return 1.0 * state.sharedMeasurementsPerTrack[i] /
+           state.measurementsPerTrack[i].size();
+  };
+  auto trackComperator = [&](std::size_t a, std::size_t b) {
+    if (relativeShared(a) != relativeShared(b)) {
+      return relativeShared(a) < relativeShared(b);
+    }
+    if (state.measurementsPerTrack[a].size() ==
+        state.measurementsPerTrack[b].size()) {
+      return state.trackChi2[a] < state.trackChi2[b];
+    }
+    return state.measurementsPerTrack[a].size() >
+           state.measurementsPerTrack[b].size();
+  };
+
+  for (std::size_t i = 0; i < cfg.maximumIterations; ++i) {
+    if (state.selectedTracks.empty()) {
+      break;
+    }
+    auto maxShared = *std::ranges::max_element(
+        state.selectedTracks, [&state](std::size_t a, std::size_t b) {
+          return state.sharedMeasurementsPerTrack[a] <
+                 state.sharedMeasurementsPerTrack[b];
+        });
+    if (state.sharedMeasurementsPerTrack[maxShared] < cfg.maximumSharedHits) {
+      break;
+    }
+    auto badTrack =
+        *std::ranges::max_element(state.selectedTracks, trackComperator);
+    for (auto iMeasurement : state.measurementsPerTrack[badTrack]) {
+      state.tracksPerMeasurement[iMeasurement].erase(badTrack);
+      if (state.tracksPerMeasurement[iMeasurement].size() == 1) {
+        --state.sharedMeasurementsPerTrack
+              [*state.tracksPerMeasurement[iMeasurement].begin()];
+      }
+    }
+    state.selectedTracks.erase(badTrack);
+  }
+}
+
+}  // namespace
+
+namespace ActsTests {
+
+BOOST_AUTO_TEST_SUITE(AmbiguitesResolutionSuite)
+
+BOOST_AUTO_TEST_CASE(GreedyInitialStateTest) {
+  GreedyAmbiguityResolution::Config cfg;
+  cfg.nMeasurementsMin = 7;
+  GreedyAmbiguityResolution greedy(cfg);
+
+  auto tracks = createTracks(100, 300);
+
+  GreedyAmbiguityResolution::State hashState;
+  greedy.computeInitialState(
+      tracks, hashState,
+      [](const SourceLink& sl) {
+        return std::hash<std::size_t>{}(sl.get<std::size_t>());
+      },
+      [](const SourceLink& a, const SourceLink& b) {
+        return a.get<std::size_t>() == b.get<std::size_t>();
+      });
+
+  GreedyAmbiguityResolution::State indexState;
+  greedy.computeInitialState(tracks, indexState, &sourceLinkIndex);
+
+  std::size_t nSelected = 0;
+  for (const auto& track : tracks) {
+    nSelected += track.nMeasurements() >= 7 ? 1 : 0;
+  }
+  BOOST_CHECK_EQUAL(indexState.numberOfTracks, nSelected);
+  BOOST_CHECK_EQUAL(hashState.numberOfTracks, indexState.numberOfTracks);
+  BOOST_CHECK(hashState.trackTips == indexState.trackTips);
+  BOOST_CHECK(hashState.sharedMeasurementsPerTrack ==
+              indexState.sharedMeasurementsPerTrack);
+  BOOST_CHECK(hashState.selectedTracks == indexState.selectedTracks);
+  BOOST_CHECK_LE(indexState.tracksPerMeasurement.size(), 300u);
+}
+
+BOOST_AUTO_TEST_CASE(GreedyResolveTest) {
+  for (std::uint32_t maximumSharedHits : {0u, 1u, 2u, 3u}) {
+    GreedyAmbiguityResolution::Config cfg;
+    cfg.maximumSharedHits = maximumSharedHits;
+    cfg.maximumIterations = 10000;
+    cfg.nMeasurementsMin = 5;
+    GreedyAmbiguityResolution greedy(cfg);
+
+    auto tracks = createTracks(500, 1000);
+
+    GreedyAmbiguityResolution::State state;
+    greedy.computeInitialState(tracks, state, &sourceLinkIndex);
+    GreedyAmbiguityResolution::State reference = state;
+
+    greedy.resolve(state);
+    resolveReference(cfg, reference);
+
+    BOOST_CHECK(state.selectedTracks == reference.selectedTracks);
+    BOOST_CHECK(state.sharedMeasurementsPerTrack ==
+                reference.sharedMeasurementsPerTrack);
+    for (auto iTrack : state.selectedTracks) {
+      BOOST_CHECK_LT(state.sharedMeasurementsPerTrack[iTrack],
+                     std::max(maximumSharedHits, 1u));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace ActsTests
@@ -12,9 +12,14 @@
 #include "Acts/EventData/TrackContainer.hpp"
 #include "Acts/EventData/VectorMultiTrajectory.hpp"
 #include "Acts/EventData/VectorTrackContainer.hpp"
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/Surfaces/PerigeeSurface.hpp"
 #include "Acts/Utilities/TrackHelpers.hpp"
 
 #include <map>
+#include <memory>
+#include <utility>
+#include <vector>
 
 using namespace Acts;
 using IndexType = TrackIndexType;
@@ -184,6 +189,123 @@ BOOST_FIXTURE_TEST_CASE(GetCleanedOutTracksTest, Fixture) {
   BOOST_CHECK_EQUAL(accepted, false);
 }
 
+BOOST_FIXTURE_TEST_CASE(FeatureTableTest, Fixture) {
+  Fixture fixture;
+  for (auto& detector : fixture.config.detectorConfigs) {
+    detector.maxHolesPerEta = {5};
+    detector.maxOutliersPerEta = {5};
+    detector.maxSharedHitsPerEta = {5};
+  }
+  ScoreBasedAmbiguityResolution tester(fixture.config);
+
+  auto pixelSurface = Surface::makeShared<PerigeeSurface>(Vector3(0, 0, 0));
+  pixelSurface->assignGeometryId(GeometryIdentifier().withVolume(8));
+  auto stripSurface = Surface::makeShared<PerigeeSurface>(Vector3(0, 0, 0));
+  stripSurface->assignGeometryId(GeometryIdentifier().withVolume(22));
+
+  VectorTrackContainer mutVtc;
+  VectorMultiTrajectory mutMtj;
+
+  TrackContainer mutTc{mutVtc, mutMtj};
+
+  using StateDef =
+      std::pair<std::shared_ptr<Surface>, std::vector<TrackStateFlag>>;
+  auto makeTrack = [&](const std::vector<StateDef>& states, double theta) {
+    auto t = mutTc.makeTrack();
+    for (const auto& [surface, flags] : states) {
+      auto ts = t.appendTrackState();
+      ts.setReferenceSurface(surface);
+      for (auto f : flags) {
+        ts.typeFlags().setUnchecked(f);
+      }
+    }
+    calculateTrackQuantities(t);
+    t.parameters()[eBoundTheta] = theta;
+    t.parameters()[eBoundQOverP] = 1. / (10 * UnitConstants::GeV);
+    t.chi2() = 12;
+    t.nDoF() = 10;
+  };
+
+  makeTrack({{pixelSurface, {HasMeasurement}},
+             {pixelSurface, {HasMeasurement, IsSharedHit}},
+             {pixelSurface, {IsHole}},
+             {stripSurface, {HasMeasurement}},
+             {stripSurface, {HasMeasurement, IsOutlier}}},
+            1.);
+  makeTrack({{pixelSurface, {HasMeasurement}},
+             {stripSurface, {HasMeasurement}},
+             {stripSurface, {IsHole}},
+             {stripSurface, {IsHole}}},
+            2.);
+
+  ConstVectorTrackContainer vtc{std::move(mutVtc)};
+  ConstVectorMultiTrajectory mtj{std::move(mutMtj)};
+
+  TrackContainer ctc{vtc, mtj};
+
+  auto table = tester.computeFeatureTable(ctc);
+
+  BOOST_CHECK_EQUAL(table.nTracks, 2u);
+  BOOST_CHECK_EQUAL(table.nDetectors, 2u);
+
+  BOOST_CHECK_EQUAL(table.nHits[table.index(0, 0)], 2u);
+  BOOST_CHECK_EQUAL(table.nSharedHits[table.index(0, 0)], 1u);
+  BOOST_CHECK_EQUAL(table.nHoles[table.index(0, 0)], 1u);
+  BOOST_CHECK_EQUAL(table.nHits[table.index(0, 1)], 1u);
+  BOOST_CHECK_EQUAL(table.nOutliers[table.index(0, 1)], 1u);
+  BOOST_CHECK_EQUAL(table.nHits[table.index(1, 0)], 1u);
+  BOOST_CHECK_EQUAL(table.nHits[table.index(1, 1)], 1u);
+  BOOST_CHECK_EQUAL(table.nHoles[table.index(1, 1)], 2u);
+
+  auto trackFeaturesVectors = tester.computeInitialState(ctc);
+  for (std::size_t iTrack = 0; iTrack < table.nTracks; ++iTrack) {
+    for (std::size_t iDetector = 0; iDetector < table.nDetectors;
+         ++iDetector) {
+      const auto expected = trackFeaturesVectors[iTrack][iDetector];
+      const auto features = table.features(iTrack, iDetector);
+      BOOST_CHECK_EQUAL(features.nHits, expected.nHits);
+      BOOST_CHECK_EQUAL(features.nHoles, expected.nHoles);
+      BOOST_CHECK_EQUAL(features.nOutliers, expected.nOutliers);
+      BOOST_CHECK_EQUAL(features.nSharedHits, expected.nSharedHits);
+    }
+  }
+
+  auto simpleScores = tester.simpleScore(ctc, table);
+  auto simpleScoresVectors = tester.simpleScore(ctc, trackFeaturesVectors);
+  BOOST_CHECK_EQUAL_COLLECTIONS(simpleScores.begin(), simpleScores.end(),
+                                simpleScoresVectors.begin(),
+                                simpleScoresVectors.end());
+
+  // Tracks rejected by optional cuts get a score of zero
+  ScoreBasedAmbiguityResolution::Optionals<
+      typename decltype(ctc)::ConstTrackProxy>
+      optionals;
+  optionals.cuts.push_back(
+      [](const auto& track) { return track.index() == 1; });
+  auto cutScores = tester.ambiguityScore(ctc, table, optionals);
+  BOOST_CHECK_GT(cutScores[0], 0.);
+  BOOST_CHECK_EQUAL(cutScores[1], 0.);
+
+  // The column wise detector cuts reject the same tracks as the per track
+  // eta based cuts, here the second track with two holes in the strips
+  auto strictConfig = fixture.config;
+  strictConfig.detectorConfigs[1].maxHolesPerEta = {1};
+  ScoreBasedAmbiguityResolution strictTester(strictConfig);
+  auto strictScores = strictTester.ambiguityScore(ctc, table);
+  for (std::size_t iTrack = 0; iTrack < table.nTracks; ++iTrack) {
+    bool rejected = false;
+    for (std::size_t iDetector = 0; iDetector < table.nDetectors;
+         ++iDetector) {
+      rejected |= strictTester.etaBasedCuts(
+          strictConfig.detectorConfigs[iDetector],
+          table.features(iTrack, iDetector), table.eta[iTrack]);
+    }
+    BOOST_CHECK_EQUAL(strictScores[iTrack] == 0., rejected);
+  }
+  BOOST_CHECK_GT(strictScores[0], 0.);
+  BOOST_CHECK_EQUAL(strictScores[1], 0.);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace ActsTests
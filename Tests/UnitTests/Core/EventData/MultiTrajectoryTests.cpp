@@ -23,6 +23,7 @@
 #include <string>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace {
 
@@ -292,6 +293,73 @@ BOOST_AUTO_TEST_CASE(ChangeSourceLinkType) {
                     std::bad_any_cast);
 }
 
+BOOST_AUTO_TEST_CASE(Compact) {
+  using PM = TrackStatePropMask;
+  VectorMultiTrajectory mtj;
+  mtj.addColumn<unsigned int>("tag");
+  ProxyAccessor<unsigned int> tag("tag");
+
+  // Build a trunk with two branches, only the second branch is kept
+  auto makeState = [&](TrackIndexType previous, unsigned int value,
+                       std::size_t measdim) {
+    auto ts = mtj.makeTrackState(PM::All, previous);
+    ts.predicted() = BoundVector::Constant(value);
+    ts.filtered() = BoundVector::Constant(value + 0.5);
+    ts.setUncalibratedSourceLink(SourceLink{value});
+    if (measdim == 1) {
+      ts.allocateCalibrated(Vector<1>::Constant(value),
+                            SquareMatrix<1>::Constant(value));
+    } else {
+      ts.allocateCalibrated(Vector2::Constant(value),
+                            SquareMatrix2::Constant(value));
+    }
+    tag(ts) = value;
+    return ts.index();
+  };
+
+  auto trunk = makeState(kTrackIndexInvalid, 1, 2);
+  auto dead1 = makeState(trunk, 2, 1);
+  auto live1 = makeState(trunk, 3, 2);
+  auto dead2 = makeState(dead1, 4, 2);
+  auto live2 = makeState(live1, 5, 1);
+  // The live tip shares the predicted parameters of a dead state
+  mtj.getTrackState(live2).shareFrom(mtj.getTrackState(dead2), PM::Predicted);
+
+  std::vector<TrackIndexType> tips{live2, kTrackIndexInvalid};
+  auto stateMap = mtj.compact(tips);
+
+  BOOST_CHECK_EQUAL(mtj.size(), 3u);
+  BOOST_CHECK_EQUAL(stateMap.size(), 5u);
+  BOOST_CHECK_EQUAL(stateMap[trunk], 0u);
+  BOOST_CHECK_EQUAL(stateMap[dead1], kTrackIndexInvalid);
+  BOOST_CHECK_EQUAL(stateMap[live1], 1u);
+  BOOST_CHECK_EQUAL(stateMap[dead2], kTrackIndexInvalid);
+  BOOST_CHECK_EQUAL(stateMap[live2], 2u);
+
+  std::vector<unsigned int> values;
+  for (auto ts : mtj.reverseTrackStateRange(stateMap[live2])) {
+    values.push_back(tag(ts));
+    const unsigned int value = tag(ts);
+    BOOST_CHECK_EQUAL(ts.getUncalibratedSourceLink().get<unsigned int>(),
+                      value);
+    BOOST_CHECK(ts.filtered() == BoundVector::Constant(value + 0.5));
+    BOOST_CHECK_EQUAL(ts.calibratedSize(), value == 5 ? 1u : 2u);
+    for (std::size_t i = 0; i < ts.calibratedSize(); ++i) {
+      BOOST_CHECK_EQUAL(ts.effectiveCalibrated()[i], value);
+    }
+  }
+  BOOST_CHECK(values == (std::vector<unsigned int>{5, 3, 1}));
+
+  // The shared parameters of the removed state are still available
+  BOOST_CHECK(mtj.getTrackState(stateMap[live2]).predicted() ==
+              BoundVector::Constant(4));
+
+  // The compacted container can be extended as usual
+  auto ts = mtj.makeTrackState(PM::All, stateMap[live2]);
+  BOOST_CHECK_EQUAL(ts.index(), 3u);
+  BOOST_CHECK_EQUAL(ts.previous(), stateMap[live2]);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace ActsTests
@@ -19,6 +19,7 @@
 
 #include <algorithm>
 #include <numeric>
+#include <vector>
 
 using namespace Acts;
 using namespace Acts::HashedStringLiteral;
@@ -460,6 +461,78 @@ BOOST_AUTO_TEST_CASE(ReverseTrackStates) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(CompactTrackStates) {
+  VectorTrackContainer vtc{};
+  VectorMultiTrajectory mtj{};
+  TrackContainer tc{vtc, mtj};
+  mtj.addColumn<unsigned int>("tag");
+  ProxyAccessor<unsigned int> tag("tag");
+  ConstProxyAccessor<unsigned int> constTag("tag");
+
+  auto appendState = [&](auto& track, unsigned int value) {
+    auto ts = track.appendTrackState();
+    ts.jacobian() = BoundMatrix::Identity() * value;
+    tag(ts) = value;
+    return ts.index();
+  };
+  auto tags = [&](const auto& track) {
+    std::vector<unsigned int> values;
+    for (const auto& ts : track.trackStatesReversed()) {
+      BOOST_CHECK_EQUAL(ts.jacobian(), BoundMatrix::Identity() * constTag(ts));
+      values.push_back(constTag(ts));
+    }
+    return values;
+  };
+
+  // The track states of a kept and a dropped track are interleaved
+  auto kept = tc.makeTrack();
+  auto dropped = tc.makeTrack();
+  const IndexType first = appendState(kept, 1);
+  appendState(dropped, 10);
+  const IndexType branchPoint = appendState(kept, 2);
+  appendState(dropped, 11);
+  appendState(kept, 3);
+  kept.stemIndex() = first;
+
+  // A branch shares the first two track states of the kept track, as the
+  // tracks of the combinatorial Kalman filter do
+  auto branch = tc.makeTrack();
+  branch.tipIndex() = branchPoint;
+  branch.stemIndex() = first;
+  appendState(branch, 4);
+
+  BOOST_CHECK_EQUAL(mtj.size(), 6u);
+  const std::vector<unsigned int> keptTags = tags(kept);
+  const std::vector<unsigned int> branchTags = tags(branch);
+
+  tc.compactTrackStates(std::vector<IndexType>{kept.index(), branch.index()});
+
+  // Only the track states of the given tracks remain
+  BOOST_CHECK_EQUAL(tc.size(), 3u);
+  BOOST_CHECK_EQUAL(mtj.size(), 4u);
+  BOOST_CHECK(tags(tc.getTrack(kept.index())) ==
+              (std::vector<unsigned int>{3, 2, 1}));
+  BOOST_CHECK(tags(tc.getTrack(kept.index())) == keptTags);
+  BOOST_CHECK(tags(tc.getTrack(branch.index())) == branchTags);
+  BOOST_CHECK_EQUAL(tc.getTrack(kept.index()).nTrackStates(), 3u);
+  BOOST_CHECK_EQUAL(tc.getTrack(branch.index()).nTrackStates(), 3u);
+
+  // The stems point to the remapped first track state
+  BOOST_CHECK_NE(tc.getTrack(kept.index()).stemIndex(), kInvalid);
+  BOOST_CHECK_EQUAL(tag(mtj.getTrackState(kept.stemIndex())), 1u);
+  BOOST_CHECK_EQUAL(branch.stemIndex(), kept.stemIndex());
+
+  // The dropped track is left without track states
+  BOOST_CHECK_EQUAL(dropped.tipIndex(), kInvalid);
+  BOOST_CHECK_EQUAL(dropped.stemIndex(), kInvalid);
+  BOOST_CHECK_EQUAL(dropped.nTrackStates(), 0u);
+
+  // The compacted tracks can be extended as usual
+  appendState(kept, 5);
+  BOOST_CHECK(tags(kept) == (std::vector<unsigned int>{5, 3, 2, 1}));
+  BOOST_CHECK(tags(branch) == branchTags);
+}
+
 BOOST_AUTO_TEST_CASE(CopyTrackProxyCalibrated) {
   VectorTrackContainer vtc{};
   VectorMultiTrajectory mtj{};
@@ -194,4 +194,50 @@ BOOST_AUTO_TEST_CASE(FindWithGlobalDefault) {
   CHECK_ENTRY(c, makeId(5), makeId());
 }
 
+BOOST_AUTO_TEST_CASE(FindIndexedAndSorted) {
+  // sparse entries on all levels, including approach and boundary levels
+  std::vector<Container::InputElement> elements = {{makeId(), {0.0}}};
+  for (int volume = 1; volume < 5; ++volume) {
+    if (volume % 2 == 0) {
+      elements.push_back({makeId(volume), {1.0}});
+    }
+    elements.push_back(
+        {GeometryIdentifier().withVolume(volume).withBoundary(1), {2.0}});
+    for (int layer = 2; layer < 8; layer += 2) {
+      if (layer != 4) {
+        elements.push_back({makeId(volume, layer), {3.0}});
+      }
+      elements.push_back({makeId(volume, layer).withApproach(1), {4.0}});
+      for (int sensitive = 1; sensitive < 10; sensitive += volume) {
+        elements.push_back({makeId(volume, layer, sensitive), {5.0}});
+      }
+    }
+  }
+  // the lookup index is used for these elements
+  Container indexed(elements);
+  // a single element with the extra level set disables the index. it is in a
+  // separate volume and does not change the result for the other volumes.
+  elements.push_back({makeId(9, 1, 1).withExtra(1), {6.0}});
+  Container sorted(elements);
+
+  for (int volume = 0; volume < 6; ++volume) {
+    for (int layer = 0; layer < 9; ++layer) {
+      for (int sensitive = 0; sensitive < 11; ++sensitive) {
+        for (int approach = 0; approach < 2; ++approach) {
+          auto query = makeId(volume, layer, sensitive).withApproach(approach);
+          auto retIndexed = indexed.find(query);
+          auto retSorted = sorted.find(query);
+          BOOST_CHECK_NE(retIndexed, indexed.end());
+          BOOST_CHECK_NE(retSorted, sorted.end());
+          BOOST_CHECK_EQUAL(
+              indexed.idAt(std::distance(indexed.begin(), retIndexed)),
+              sorted.idAt(std::distance(sorted.begin(), retSorted)));
+          // the extra level of the query is ignored
+          BOOST_CHECK_EQUAL(indexed.find(query.withExtra(3)), retIndexed);
+        }
+      }
+    }
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
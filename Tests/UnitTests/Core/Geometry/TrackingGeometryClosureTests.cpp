@@ -348,6 +348,41 @@ BOOST_AUTO_TEST_CASE(TrackingGeometry_testVisitSurfaces) {
   BOOST_CHECK(lambdaVolumeCalled);
 }
 
+BOOST_AUTO_TEST_CASE(TrackingGeometry_denseSurfaceIndex) {
+  GeometryIdentifierHook hook{};
+  TrackingGeometry tGeometry = makeTrackingGeometry(hook);
+
+  // collect the sensitive surfaces by traversal
+  std::vector<const Surface*> sensitives;
+  tGeometry.visitSurfaces(
+      [&](const Surface* surface) { sensitives.push_back(surface); });
+  BOOST_CHECK(!sensitives.empty());
+  BOOST_CHECK_EQUAL(tGeometry.numSensitiveSurfaces(), sensitives.size());
+  BOOST_CHECK_EQUAL(tGeometry.sensitiveSurfaces().size(), sensitives.size());
+
+  // every sensitive surface has a unique index mapping back to it
+  for (const Surface* surface : sensitives) {
+    auto index = tGeometry.indexOf(surface->geometryId());
+    BOOST_REQUIRE(index.has_value());
+    BOOST_CHECK_LT(*index, tGeometry.numSensitiveSurfaces());
+    BOOST_CHECK_EQUAL(tGeometry.surfaceByIndex(*index), surface);
+  }
+
+  // the index follows the geometry identifier ordering
+  for (std::size_t i = 1; i < tGeometry.numSensitiveSurfaces(); ++i) {
+    BOOST_CHECK_LT(tGeometry.surfaceByIndex(i - 1)->geometryId(),
+                   tGeometry.surfaceByIndex(i)->geometryId());
+  }
+
+  // non-sensitive and unknown identifiers are not indexed
+  const auto* world = tGeometry.highestTrackingVolume();
+  BOOST_CHECK(!tGeometry.indexOf(world->geometryId()).has_value());
+  const auto unknown = GeometryIdentifier().withVolume(99).withSensitive(1);
+  BOOST_CHECK(!tGeometry.indexOf(unknown).has_value());
+  BOOST_CHECK_EQUAL(
+      tGeometry.surfaceByIndex(tGeometry.numSensitiveSurfaces()), nullptr);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace ActsTests
@@ -0,0 +1,153 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/MagneticField/BFieldMapUtils.hpp"
+#include "Acts/MagneticField/BinaryMagneticFieldIo.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "ActsTests/CommonHelpers/FloatComparisons.hpp"
+#include "ActsTests/CommonHelpers/TemporaryDirectory.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <fstream>
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace Acts;
+using namespace Acts::UnitLiterals;
+
+namespace ActsTests {
+
+namespace {
+
+std::vector<double> gridPoints(double min, double step, std::size_t n) {
+  std::vector<double> points;
+  for (std::size_t i = 0; i < n; ++i) {
+    points.push_back(min + i * step);
+  }
+  return points;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(MagneticFieldSuite)
+
+BOOST_AUTO_TEST_CASE(InterpolatedBFieldMap_rz_binary) {
+  TemporaryDirectory tmp{};
+
+  std::vector<double> rPos = gridPoints(0., 10., 8);
+  std::vector<double> zPos = gridPoints(-50., 10., 11);
+  std::vector<Vector2> bField;
+  for (std::size_t i = 0; i < rPos.size(); ++i) {
+    for (std::size_t j = 0; j < zPos.size(); ++j) {
+      bField.emplace_back(0.01_T * i * (j - 5.), 2_T - 0.02_T * i);
+    }
+  }
+  auto localToGlobalBin = [](std::array<std::size_t, 2> binsRZ,
+                             std::array<std::size_t, 2> nBinsRZ) {
+    return (binsRZ.at(0) * nBinsRZ.at(1) + binsRZ.at(1));
+  };
+  auto map = fieldMapRZ(localToGlobalBin, rPos, zPos, bField);
+
+  const auto file = (tmp.path() / "rz_field.bin").string();
+  writeMagneticFieldMapRzToBinary(map, file);
+  auto mapped = makeMagneticFieldMapRzFromBinary(file);
+
+  BOOST_CHECK(mapped.getNBins() == map.getNBins());
+  BOOST_CHECK(mapped.getMin() == map.getMin());
+  BOOST_CHECK(mapped.getMax() == map.getMax());
+
+  // The mapped values are bitwise identical to the ones in memory
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> xy(-49., 49.);
+  std::uniform_real_distribution<double> z(-49., 39.);
+  auto cache = mapped.makeCache(MagneticFieldContext());
+  for (int i = 0; i < 100; ++i) {
+    const Vector3 pos(xy(rng), xy(rng), z(rng));
+    BOOST_CHECK_EQUAL(mapped.isInside(pos), map.isInside(pos));
+    if (!map.isInside(pos)) {
+      continue;
+    }
+    BOOST_CHECK_EQUAL(mapped.getField(pos).value(), map.getField(pos).value());
+    CHECK_CLOSE_ABS(mapped.getField(pos, cache).value(),
+                    map.getField(pos).value(), 1e-15);
+  }
+
+  // The map type is checked when reading
+  BOOST_CHECK_THROW(makeMagneticFieldMapXyzFromBinary(file),
+                    std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(InterpolatedBFieldMap_xyz_binary) {
+  TemporaryDirectory tmp{};
+
+  std::vector<double> xyzPos = gridPoints(-20., 5., 9);
+  std::vector<Vector3> bField;
+  for (double x : xyzPos) {
+    for (double y : xyzPos) {
+      for (double z : xyzPos) {
+        bField.emplace_back(0.1_T * std::sin(0.1 * x), 0.01_T * y * z,
+                            2_T + 0.001_T * x * y);
+      }
+    }
+  }
+  auto localToGlobalBin = [](std::array<std::size_t, 3> binsXYZ,
+                             std::array<std::size_t, 3> nBinsXYZ) {
+    return (binsXYZ.at(0) * (nBinsXYZ.at(1) * nBinsXYZ.at(2)) +
+            binsXYZ.at(1) * nBinsXYZ.at(2) + binsXYZ.at(2));
+  };
+  auto map = fieldMapXYZ(localToGlobalBin, xyzPos, xyzPos, xyzPos, bField);
+
+  const auto file = (tmp.path() / "xyz_field.bin").string();
+  writeMagneticFieldMapXyzToBinary(map, file);
+
+  // Copies of the map share the same mapping, which outlives the original
+  std::optional<MappedBFieldMapXyz> copy;
+  {
+    auto mapped = makeMagneticFieldMapXyzFromBinary(file);
+    copy.emplace(mapped);
+  }
+
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> dist(-19.9, 19.9);
+  for (int i = 0; i < 100; ++i) {
+    const Vector3 pos(dist(rng), dist(rng), dist(rng));
+    BOOST_CHECK_EQUAL(copy->getField(pos).value(), map.getField(pos).value());
+    BOOST_CHECK_EQUAL(copy->getFieldUnchecked(pos),
+                      map.getFieldUnchecked(pos));
+  }
+  BOOST_CHECK(!copy->getField(Vector3(0., 0., 21.)).ok());
+}
+
+BOOST_AUTO_TEST_CASE(InterpolatedBFieldMap_binary_invalid) {
+  TemporaryDirectory tmp{};
+
+  BOOST_CHECK_THROW(
+      makeMagneticFieldMapXyzFromBinary((tmp.path() / "missing.bin").string()),
+      std::runtime_error);
+
+  const auto file = (tmp.path() / "invalid.bin").string();
+  {
+    std::ofstream out(file);
+    out << "% x,y,z,Bx,By,Bz\n0 0 0 0 0 2\n";
+  }
+  BOOST_CHECK_THROW(makeMagneticFieldMapXyzFromBinary(file),
+                    std::runtime_error);
+  BOOST_CHECK_THROW(makeMagneticFieldMapRzFromBinary(file), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace ActsTests
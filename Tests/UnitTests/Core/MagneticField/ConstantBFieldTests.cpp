@@ -15,6 +15,8 @@
 #include "Acts/MagneticField/MagneticFieldContext.hpp"
 #include "Acts/Utilities/Result.hpp"
 
+#include <vector>
+
 namespace bdata = boost::unit_test::data;
 
 using namespace Acts;
@@ -121,6 +123,21 @@ BOOST_DATA_TEST_CASE(
   BOOST_CHECK_EQUAL(Btrue, BField.getField(-2 * pos, bCache).value());
 }
 
+/// @brief unit test for batched lookup of constant magnetic field
+BOOST_AUTO_TEST_CASE(ConstantBField_batch) {
+  const Vector3 Btrue(1_T, -2_T, 3_T);
+  ConstantBField BField{Btrue};
+  auto bCache = BField.makeCache(mfContext);
+
+  std::vector<Vector3> positions = {
+      Vector3(0, 0, 0), Vector3(1_m, 2_m, 3_m), Vector3(-5_m, 0, 10_m)};
+  std::vector<Vector3> fields(positions.size(), Vector3::Zero());
+  BOOST_CHECK(BField.getFieldBatch(positions, fields, bCache).ok());
+  for (const Vector3& field : fields) {
+    BOOST_CHECK_EQUAL(Btrue, field);
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace ActsTests
@@ -22,6 +22,7 @@
 #include <cstddef>
 #include <optional>
 #include <utility>
+#include <vector>
 
 using Acts::VectorHelpers::perp;
 
@@ -162,6 +163,62 @@ BOOST_AUTO_TEST_CASE(InterpolatedBFieldMap_rz) {
   BOOST_CHECK(!c.isInside(transformPos((pos << 5, 2, 14.).finished())));
 }
 
+BOOST_AUTO_TEST_CASE(InterpolatedBFieldMap_batch) {
+  // linear in r and z so interpolation should be exact
+  auto value = [](const std::array<double, 2>& rz) {
+    return Vector3(rz.at(0) * rz.at(1), 3 * rz.at(0), -2 * rz.at(1));
+  };
+  auto transformPos = [](const Vector3& pos) {
+    return Vector2(perp(pos), pos.z());
+  };
+  auto transformBField = [](const Vector3& field, const Vector3&) {
+    return field;
+  };
+
+  Grid g(Type<Vector3>, Axis(0.0, 4.0, 4u), Axis(-5, 7, 6u));
+  using Grid_t = decltype(g);
+  for (std::size_t i = 1; i <= g.numLocalBins().at(0) + 1; ++i) {
+    for (std::size_t j = 1; j <= g.numLocalBins().at(1) + 1; ++j) {
+      Grid_t::index_t indices = {{i, j}};
+      g.atLocalBins(indices) = value(g.lowerLeftBinEdge(indices));
+    }
+  }
+  InterpolatedBFieldMap<Grid_t> b{{transformPos, transformBField, g}};
+
+  // positions alternating between field cells
+  std::vector<Vector3> positions = {{0, 1.5, -2.5}, {2, 2.2, -4},
+                                    {0, 1.6, -2.4}, {-1.6, 2.5, 1.7},
+                                    {2, 2.1, -4.1}, {0.5, 0.5, 4.5}};
+  std::vector<Vector3> fields(positions.size());
+
+  auto bCache = b.makeCache(mfContext);
+  BOOST_CHECK(b.getFieldBatch(positions, fields, bCache).ok());
+  auto singleCache = b.makeCache(mfContext);
+  for (std::size_t i = 0; i < positions.size(); ++i) {
+    const Vector3& pos = positions[i];
+    CHECK_CLOSE_REL(fields[i], value({{perp(pos), pos.z()}}), 1e-6);
+    CHECK_CLOSE_REL(fields[i], b.getField(pos, singleCache).value(), 1e-12);
+  }
+
+  // more positions than fit into one interpolation block
+  positions.clear();
+  for (int i = 0; i < 40; ++i) {
+    positions.emplace_back(0.05 * i, 1.5 - 0.02 * i, -4.3 + 0.2 * i);
+  }
+  fields.resize(positions.size());
+  BOOST_CHECK(b.getFieldBatch(positions, fields, bCache).ok());
+  for (std::size_t i = 0; i < positions.size(); ++i) {
+    const Vector3& pos = positions[i];
+    CHECK_CLOSE_REL(fields[i], value({{perp(pos), pos.z()}}), 1e-6);
+    CHECK_CLOSE_REL(fields[i], b.getField(pos).value(), 1e-12);
+  }
+
+  // one position is outside the grid
+  positions.emplace_back(1, 6, -1.7);
+  fields.resize(positions.size());
+  BOOST_CHECK(!b.getFieldBatch(positions, fields, bCache).ok());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace ActsTests
@@ -13,6 +13,8 @@
 #include "Acts/MagneticField/MultiRangeBField.hpp"
 #include "Acts/Utilities/Result.hpp"
 
+#include <vector>
+
 using namespace Acts;
 
 namespace ActsTests {
@@ -76,6 +78,33 @@ BOOST_AUTO_TEST_CASE(TestMultiRangeBField) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(TestMultiRangeBFieldBatch) {
+  std::vector<std::pair<RangeXD<3, double>, Vector3>> inputs;
+
+  inputs.emplace_back(RangeXD<3, double>{{0., 0., 0.}, {3., 3., 3.}},
+                      Vector3{0., 0., 2.});
+  inputs.emplace_back(RangeXD<3, double>{{1., 1., 1.}, {2., 2., 10.}},
+                      Vector3{2., 0., 0.});
+
+  const MultiRangeBField bfield(std::move(inputs));
+
+  auto bcache = bfield.makeCache(mfContext);
+
+  std::vector<Vector3> positions = {
+      {0.5, 0.5, 0.5}, {1.5, 1.5, 5.}, {2.5, 2.5, 2.5}, {1.5, 1.5, 1.5}};
+  std::vector<Vector3> fields(positions.size());
+  BOOST_CHECK(bfield.getFieldBatch(positions, fields, bcache).ok());
+  BOOST_CHECK_EQUAL(fields[0], Vector3(0., 0., 2.));
+  BOOST_CHECK_EQUAL(fields[1], Vector3(2., 0., 0.));
+  BOOST_CHECK_EQUAL(fields[2], Vector3(0., 0., 2.));
+  BOOST_CHECK_EQUAL(fields[3], Vector3(2., 0., 0.));
+
+  // Test a batch with a point outside all volumes.
+  positions.emplace_back(-1., -1., -1.);
+  fields.resize(positions.size());
+  BOOST_CHECK(!bfield.getFieldBatch(positions, fields, bcache).ok());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace ActsTests
@@ -16,6 +16,7 @@
 
 #include <limits>
 #include <utility>
+#include <vector>
 
 using namespace Acts;
 
@@ -192,6 +193,109 @@ BOOST_AUTO_TEST_CASE(MultipleDifferentTracks) {
   }
 }
 
+// merging accumulators of disjoint track sets is the same as one accumulator
+BOOST_AUTO_TEST_CASE(MergeDisjointTracks) {
+  MaterialSlab unit = makeUnitSlab();
+  MaterialSlab silicon(makeSilicon(), 2 * unit.thickness());
+  MaterialSlab beryllium(makeBeryllium(), 0.5 * unit.thickness());
+  std::vector<MaterialSlab> tracks = {unit, silicon, beryllium, silicon, unit};
+
+  AccumulatedMaterialSlab all;
+  AccumulatedMaterialSlab first;
+  AccumulatedMaterialSlab second;
+  for (std::size_t i = 0; i < tracks.size(); ++i) {
+    all.accumulate(tracks[i]);
+    all.trackAverage();
+    AccumulatedMaterialSlab& part = (i < 2) ? first : second;
+    part.accumulate(tracks[i]);
+    part.trackAverage();
+  }
+
+  // merging into an empty accumulator copies the other one
+  AccumulatedMaterialSlab merged;
+  merged.merge(first);
+  BOOST_CHECK_EQUAL(merged.totalAverage().second, 2u);
+  BOOST_CHECK_EQUAL(merged.totalAverage().first.material(),
+                    first.totalAverage().first.material());
+  // merging an empty accumulator does nothing
+  merged.merge(AccumulatedMaterialSlab());
+  BOOST_CHECK_EQUAL(merged.totalAverage().second, 2u);
+
+  merged.merge(second);
+  auto [average, trackCount] = merged.totalAverage();
+  auto [reference, referenceCount] = all.totalAverage();
+  BOOST_CHECK_EQUAL(trackCount, referenceCount);
+  CHECK_CLOSE_REL(average.thickness(), reference.thickness(), 1e-6);
+  CHECK_CLOSE_REL(average.material().X0(), reference.material().X0(), 1e-5);
+  CHECK_CLOSE_REL(average.material().L0(), reference.material().L0(), 1e-5);
+  CHECK_CLOSE_REL(average.material().Z(), reference.material().Z(), 1e-5);
+  CHECK_CLOSE_REL(average.thicknessInX0(), reference.thicknessInX0(), 1e-5);
+}
+
+// with vacuum or empty tracks only the atomic number and the mean excitation
+// energy of the merged average differ from a single accumulator
+BOOST_AUTO_TEST_CASE(MergeDisjointTracksWithVacuum) {
+  MaterialSlab unit = makeUnitSlab();
+  MaterialSlab silicon(makeSilicon(), 2 * unit.thickness());
+  MaterialSlab vacuum = MaterialSlab::Vacuum(unit.thickness());
+  // the last track does not cross any material
+  std::vector<MaterialSlab> tracks = {unit, silicon, vacuum, silicon, unit,
+                                      MaterialSlab::Nothing()};
+
+  AccumulatedMaterialSlab all;
+  AccumulatedMaterialSlab first;
+  AccumulatedMaterialSlab second;
+  for (std::size_t i = 0; i < tracks.size(); ++i) {
+    all.accumulate(tracks[i]);
+    all.trackAverage(true);
+    AccumulatedMaterialSlab& part = (i < 2) ? first : second;
+    part.accumulate(tracks[i]);
+    part.trackAverage(true);
+  }
+
+  first.merge(second);
+  auto [average, trackCount] = first.totalAverage();
+  auto [reference, referenceCount] = all.totalAverage();
+  // the track counts and the additive properties are exact
+  BOOST_CHECK_EQUAL(trackCount, referenceCount);
+  CHECK_CLOSE_REL(average.thickness(), reference.thickness(), 1e-6);
+  CHECK_CLOSE_REL(average.thicknessInX0(), reference.thicknessInX0(), 1e-5);
+  CHECK_CLOSE_REL(average.thicknessInL0(), reference.thicknessInL0(), 1e-5);
+  CHECK_CLOSE_REL(average.material().Ar(), reference.material().Ar(), 1e-5);
+  CHECK_CLOSE_REL(average.material().molarDensity(),
+                  reference.material().molarDensity(), 1e-5);
+  // the vacuum contribution switches the logarithmic average of the atomic
+  // number and mean excitation energy to a linear one, which depends on the
+  // order of the averaging. This is a 1% effect here.
+  CHECK_CLOSE_REL(average.material().Z(), reference.material().Z(), 0.02);
+  CHECK_CLOSE_REL(average.material().meanExcitationEnergy(),
+                  reference.material().meanExcitationEnergy(), 0.02);
+}
+
+// restoring the totals gives an accumulator that can be merged again
+BOOST_AUTO_TEST_CASE(FromTotals) {
+  MaterialSlab unit = makeUnitSlab();
+  AccumulatedMaterialSlab a;
+  a.accumulate(unit);
+  a.trackVariance(unit);
+  a.trackAverage();
+
+  auto [average, trackCount] = a.totalAverage();
+  auto [variance, varianceCount] = a.totalVariance();
+  AccumulatedMaterialSlab restored =
+      AccumulatedMaterialSlab::fromTotals(average, variance, trackCount);
+  BOOST_CHECK_EQUAL(restored.totalAverage().first.material(),
+                    average.material());
+  BOOST_CHECK_EQUAL(restored.totalAverage().second, trackCount);
+  BOOST_CHECK_EQUAL(restored.totalVariance().first, variance);
+  BOOST_CHECK_EQUAL(restored.totalVariance().second, varianceCount);
+
+  restored.merge(a);
+  BOOST_CHECK_EQUAL(restored.totalAverage().second, 2u);
+  BOOST_CHECK_EQUAL(restored.totalAverage().first.thickness(),
+                    unit.thickness());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace ActsTests
@@ -19,6 +19,7 @@
 #include <array>
 #include <cstddef>
 #include <memory>
+#include <stdexcept>
 #include <vector>
 
 using namespace Acts;
@@ -189,6 +190,51 @@ BOOST_AUTO_TEST_CASE(AccumulatedSurfaceMaterial_variance_0D) {
   BOOST_CHECK_EQUAL(trackCount, 2u);
 }
 
+/// Test the merging of independently filled material
+BOOST_AUTO_TEST_CASE(AccumulatedSurfaceMaterial_merge) {
+  Material mat = Material::fromMolarDensity(1., 1., 1., 1., 1.);
+  MaterialSlab one(mat, 1.);
+  MaterialSlab three(mat, 3.);
+
+  BinUtility binUtility2D(2, -1., 1., open, AxisDirection::AxisX);
+  binUtility2D += BinUtility(2, -1., 1., open, AxisDirection::AxisY);
+  AccumulatedSurfaceMaterial material2D{binUtility2D};
+  AccumulatedSurfaceMaterial other2D{binUtility2D};
+
+  // one track per instance hitting the same bin
+  material2D.accumulate(Vector2{0.5, -0.5}, one);
+  material2D.trackAverage();
+  other2D.accumulate(Vector2{0.5, -0.5}, three);
+  other2D.trackAverage();
+  // and one only in the other instance
+  other2D.accumulate(Vector2{-0.5, 0.5}, three);
+  other2D.trackAverage();
+
+  material2D.merge(other2D);
+  auto accMat2D = material2D.accumulatedMaterial();
+  auto [matProp01, trackCount01] = accMat2D[0][1].totalAverage();
+  auto [matProp10, trackCount10] = accMat2D[1][0].totalAverage();
+  auto [matProp00, trackCount00] = accMat2D[0][0].totalAverage();
+
+  BOOST_CHECK_EQUAL(trackCount01, 2u);
+  BOOST_CHECK_EQUAL(matProp01.thickness(), 2.);
+  BOOST_CHECK_EQUAL(trackCount10, 1u);
+  BOOST_CHECK_EQUAL(matProp10.thickness(), 3.);
+  BOOST_CHECK_EQUAL(trackCount00, 0u);
+
+  // single bins can be merged as well
+  material2D.merge(0, 0, accMat2D[1][0]);
+  auto [matProp00Merged, trackCount00Merged] =
+      material2D.accumulatedMaterial()[0][0].totalAverage();
+  BOOST_CHECK_EQUAL(trackCount00Merged, 1u);
+  BOOST_CHECK_EQUAL(matProp00Merged.thickness(), 3.);
+  BOOST_CHECK_THROW(material2D.merge(2, 0, accMat2D[1][0]), std::out_of_range);
+
+  // the binning has to be identical
+  AccumulatedSurfaceMaterial material0D{};
+  BOOST_CHECK_THROW(material0D.merge(material2D), std::invalid_argument);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace ActsTest
@@ -107,6 +107,36 @@ BOOST_AUTO_TEST_CASE(two_materials_different_lengh) {
                   1e-4);
 }
 
+BOOST_AUTO_TEST_CASE(merge_two_materials) {
+  Material mat1 = Material::fromMolarDensity(1., 2., 3., 4., 5.);
+  Material mat2 = Material::fromMolarDensity(6., 7., 8., 9., 10.);
+
+  MaterialSlab matprop1(mat1, 0.5);
+  MaterialSlab matprop2(mat2, 2);
+
+  AccumulatedVolumeMaterial reference;
+  reference.accumulate(matprop1);
+  reference.accumulate(matprop2);
+  reference.accumulate(matprop2);
+
+  AccumulatedVolumeMaterial avm1;
+  avm1.accumulate(matprop1);
+  AccumulatedVolumeMaterial avm2;
+  avm2.accumulate(matprop2);
+  avm2.accumulate(matprop2);
+  avm1.merge(avm2);
+  // merging nothing leaves the average unchanged
+  avm1.merge(AccumulatedVolumeMaterial());
+
+  auto result = avm1.average();
+  auto expected = reference.average();
+  CHECK_CLOSE_REL(result.X0(), expected.X0(), 1e-4);
+  CHECK_CLOSE_REL(result.L0(), expected.L0(), 1e-4);
+  CHECK_CLOSE_REL(result.Ar(), expected.Ar(), 1e-4);
+  CHECK_CLOSE_REL(result.Z(), expected.Z(), 1e-4);
+  CHECK_CLOSE_REL(result.molarDensity(), expected.molarDensity(), 1e-4);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace ActsTests
@@ -134,6 +134,17 @@ class MaterialBlender : public ISurfaceMaterialAccumulator {
     }
   };
 
+  /// Merge the material accumulated in another state
+  void merge(ISurfaceMaterialAccumulator::State& state,
+             const ISurfaceMaterialAccumulator::State& other) const override {
+    auto cState = static_cast<State*>(&state);
+    auto oState = static_cast<const State*>(&other);
+    for (const auto& [surface, accumulatedMaterial] :
+         oState->accumulatedMaterial) {
+      cState->accumulatedMaterial[surface].merge(accumulatedMaterial);
+    }
+  }
+
   /// Finalize the surface material maps
   ///
   /// @param state the state of the accumulator
@@ -12,19 +12,26 @@
 #include "Acts/Definitions/Algebra.hpp"
 #include "Acts/Definitions/Tolerance.hpp"
 #include "Acts/Definitions/Units.hpp"
+#include "Acts/Geometry/CuboidVolumeBounds.hpp"
 #include "Acts/Geometry/CylinderPortalShell.hpp"
 #include "Acts/Geometry/CylinderVolumeBounds.hpp"
 #include "Acts/Geometry/GeometryContext.hpp"
 #include "Acts/Geometry/NavigationPolicyFactory.hpp"
 #include "Acts/Geometry/TrackingVolume.hpp"
+#include "Acts/Navigation/BoundingVolumeHierarchyNavigationPolicy.hpp"
 #include "Acts/Navigation/CylinderNavigationPolicy.hpp"
 #include "Acts/Navigation/INavigationPolicy.hpp"
 #include "Acts/Navigation/MultiNavigationPolicy.hpp"
 #include "Acts/Navigation/NavigationDelegate.hpp"
 #include "Acts/Navigation/NavigationStream.hpp"
 #include "Acts/Navigation/TryAllNavigationPolicy.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Surfaces/RectangleBounds.hpp"
 #include "Acts/Utilities/Logger.hpp"
 
+#include <random>
+#include <set>
+
 #include <boost/algorithm/string/join.hpp>
 
 using namespace Acts;
@@ -118,6 +125,26 @@ BOOST_AUTO_TEST_CASE(DirectTest) {
   BOOST_CHECK_EQUAL(policyB.value, 4242);
 }
 
+BOOST_AUTO_TEST_CASE(QueryIndependentTest) {
+  TrackingVolume volume{
+      Transform3::Identity(),
+      std::make_shared<CylinderVolumeBounds>(250_mm, 400_mm, 310_mm),
+      "PixelLayer3"};
+
+  BOOST_CHECK(!APolicy(gctx, volume, *logger).isQueryIndependent());
+  BOOST_CHECK(TryAllNavigationPolicy(gctx, volume, *logger)
+                  .isQueryIndependent());
+
+  // Combined policies are only query independent if all children are
+  MultiNavigationPolicy tryAll{
+      std::make_unique<TryAllNavigationPolicy>(gctx, volume, *logger)};
+  BOOST_CHECK(tryAll.isQueryIndependent());
+  MultiNavigationPolicy mixed{
+      std::make_unique<TryAllNavigationPolicy>(gctx, volume, *logger),
+      std::make_unique<APolicy>(gctx, volume, *logger)};
+  BOOST_CHECK(!mixed.isQueryIndependent());
+}
+
 BOOST_AUTO_TEST_CASE(FactoryTest) {
   TrackingVolume volume{
       Transform3::Identity(),
@@ -823,6 +850,85 @@ BOOST_AUTO_TEST_CASE(CylinderPolicyZeroInnerRadiusTest) {
   }
 }
 
+namespace {
+
+std::set<const Surface*> forwardSurfaces(const INavigationPolicy& policy,
+                                         const Vector3& position,
+                                         const Vector3& direction) {
+  NavigationDelegate delegate;
+  policy.connect(delegate);
+
+  NavigationArguments args{.position = position, .direction = direction};
+  NavigationStream main;
+  AppendOnlyNavigationStream stream{main};
+  NavigationPolicyStateManager stateManager;
+  policy.createState(gctx, args, stateManager, *logger);
+  auto policyState = stateManager.currentState();
+  delegate(gctx, args, policyState, stream, *logger);
+  main.initialize(gctx, {position, direction}, BoundaryTolerance::None());
+
+  std::set<const Surface*> surfaces;
+  for (const auto& candidate : main.candidates()) {
+    if (candidate.intersection().isValid() &&
+        candidate.intersection().pathLength() > 0) {
+      surfaces.insert(&candidate.surface());
+    }
+  }
+  return surfaces;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(BoundingVolumeHierarchyPolicyTest) {
+  TrackingVolume volume{Transform3::Identity(),
+                        std::make_shared<CuboidVolumeBounds>(1_m, 1_m, 1_m),
+                        "DenseVolume"};
+
+  // Irregularly placed and tilted planes, as e.g. in muon chambers
+  std::mt19937 rng{42};
+  std::uniform_real_distribution<double> posDist{-900_mm, 900_mm};
+  std::uniform_real_distribution<double> angleDist{-1., 1.};
+  for (std::size_t i = 0; i < 200; ++i) {
+    Transform3 trf = Transform3::Identity();
+    trf.translation() = Vector3{posDist(rng), posDist(rng), posDist(rng)};
+    trf.linear() = (AngleAxis3(angleDist(rng), Vector3::UnitX()) *
+                    AngleAxis3(angleDist(rng), Vector3::UnitY()))
+                       .toRotationMatrix();
+    volume.addSurface(Surface::makeShared<PlaneSurface>(
+        trf, std::make_shared<RectangleBounds>(30_mm, 50_mm)));
+  }
+
+  BoundingVolumeHierarchyNavigationPolicy::Config cfg;
+  cfg.maxLeafSize = 2;
+  BoundingVolumeHierarchyNavigationPolicy bvh(gctx, volume, *logger, cfg);
+  TryAllNavigationPolicy tryAll(gctx, volume, *logger);
+
+  BOOST_CHECK_EQUAL(bvh.boxes().size(), 200);
+  BOOST_REQUIRE(!bvh.nodes().empty());
+  BOOST_CHECK_EQUAL(bvh.nodes().front().skip, bvh.nodes().size());
+  std::size_t nLeafBoxes = 0;
+  for (const auto& node : bvh.nodes()) {
+    BOOST_CHECK_LE(node.count, cfg.maxLeafSize);
+    nLeafBoxes += node.count;
+  }
+  BOOST_CHECK_EQUAL(nLeafBoxes, bvh.boxes().size());
+
+  // The BVH has to find exactly the surfaces intersected in forward direction
+  for (std::size_t i = 0; i < 100; ++i) {
+    Vector3 position{posDist(rng), posDist(rng), posDist(rng)};
+    Vector3 direction =
+        Vector3{angleDist(rng), angleDist(rng), angleDist(rng)}.normalized();
+
+    auto expected = forwardSurfaces(tryAll, position, direction);
+    auto actual = forwardSurfaces(bvh, position, direction);
+    BOOST_CHECK(expected == actual);
+  }
+
+  BOOST_CHECK_THROW(BoundingVolumeHierarchyNavigationPolicy(
+                        gctx, volume, *logger, {.maxLeafSize = 0}),
+                    std::invalid_argument);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace ActsTests
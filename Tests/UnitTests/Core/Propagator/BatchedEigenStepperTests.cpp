@@ -0,0 +1,280 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/Direction.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/EventData/BoundTrackParameters.hpp"
+#include "Acts/EventData/ParticleHypothesis.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/MagneticField/MagneticFieldError.hpp"
+#include "Acts/MagneticField/MagneticFieldProvider.hpp"
+#include "Acts/MagneticField/NullBField.hpp"
+#include "Acts/Propagator/BatchedEigenStepper.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/EigenStepperError.hpp"
+#include "Acts/Utilities/VectorHelpers.hpp"
+#include "ActsTests/CommonHelpers/FloatComparisons.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <optional>
+#include <span>
+#include <system_error>
+#include <vector>
+
+using namespace Acts;
+using namespace Acts::UnitLiterals;
+using Acts::VectorHelpers::makeVector4;
+
+namespace ActsTests {
+
+namespace {
+
+const GeometryContext tgContext =
+    GeometryContext::dangerouslyDefaultConstruct();
+const MagneticFieldContext mfContext = MagneticFieldContext();
+
+std::vector<BoundTrackParameters> makeTracks(std::size_t n) {
+  std::vector<BoundTrackParameters> tracks;
+  for (std::size_t i = 0; i < n; ++i) {
+    Vector3 pos(1. * i, 2., 3.);
+    Vector3 dir = Vector3(4., 5. - i, 6.).normalized();
+    double absMom = (0.5 + i) * 1_GeV;
+    double charge = (i % 2 == 0) ? 1. : -1.;
+    tracks.push_back(BoundTrackParameters::createCurvilinear(
+        makeVector4(pos, 7.), dir, charge / absMom, std::nullopt,
+        ParticleHypothesis::pion()));
+  }
+  return tracks;
+}
+
+/// Constant field inside |x| < limit, out of bounds outside
+class BoundedBField final : public MagneticFieldProvider {
+ public:
+  BoundedBField(const Vector3& field, double limit)
+      : m_field(field), m_limit(limit) {}
+
+  Cache makeCache(const MagneticFieldContext& mctx) const override {
+    return Cache(std::in_place_type<MagneticFieldContext>, mctx);
+  }
+
+  Result<Vector3> getField(const Vector3& position,
+                           Cache& /*cache*/) const override {
+    if (std::abs(position.x()) >= m_limit) {
+      return Result<Vector3>::failure(MagneticFieldError::OutOfBounds);
+    }
+    return Result<Vector3>::success(m_field);
+  }
+
+ private:
+  Vector3 m_field;
+  double m_limit;
+};
+
+/// Constant field counting the batched look-ups
+class CountingBField final : public MagneticFieldProvider {
+ public:
+  explicit CountingBField(const Vector3& field) : m_field(field) {}
+
+  Cache makeCache(const MagneticFieldContext& mctx) const override {
+    return Cache(std::in_place_type<MagneticFieldContext>, mctx);
+  }
+
+  Result<Vector3> getField(const Vector3& /*position*/,
+                           Cache& /*cache*/) const override {
+    ++nSingleLookups;
+    return Result<Vector3>::success(m_field);
+  }
+
+  Result<void> getFieldBatch(std::span<const Vector3> positions,
+                             std::span<Vector3> fields,
+                             Cache& /*cache*/) const override {
+    ++nBatchLookups;
+    nBatchPositions += positions.size();
+    std::ranges::fill(fields, m_field);
+    return Result<void>::success();
+  }
+
+  mutable std::size_t nSingleLookups = 0;
+  mutable std::size_t nBatchLookups = 0;
+  mutable std::size_t nBatchPositions = 0;
+
+ private:
+  Vector3 m_field;
+};
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(PropagatorSuite)
+
+BOOST_AUTO_TEST_CASE(batched_eigen_stepper_matches_eigen_stepper) {
+  auto bField = std::make_shared<ConstantBField>(Vector3(0.1_T, 0.2_T, 2_T));
+
+  StepperPlainOptions options(tgContext, mfContext);
+  options.maxStepSize = 50_cm;
+
+  EigenStepper<> es(bField);
+  BatchedEigenStepper<4> bes(bField);
+
+  auto tracks = makeTracks(4);
+  auto bState = bes.makeState(options);
+  std::vector<EigenStepper<>::State> esStates;
+  for (std::size_t i = 0; i < tracks.size(); ++i) {
+    bes.initialize(bState, i, tracks[i]);
+    EigenStepper<>::Options esOptions(tgContext, mfContext);
+    esOptions.setPlainOptions(options);
+    esStates.push_back(es.makeState(esOptions));
+    es.initialize(esStates.back(), tracks[i]);
+  }
+
+  for (int s = 0; s < 20; ++s) {
+    auto res = bes.step(bState, Direction::Forward());
+    for (std::size_t i = 0; i < tracks.size(); ++i) {
+      auto h = es.step(esStates[i], Direction::Forward(), nullptr);
+      BOOST_REQUIRE(h.ok());
+      BOOST_REQUIRE(!bes.error(bState, i));
+      CHECK_CLOSE_REL(res[i], *h, 1e-10);
+      CHECK_CLOSE_ABS(bes.position(bState, i), es.position(esStates[i]),
+                      1e-9);
+      CHECK_CLOSE_ABS(bes.direction(bState, i), es.direction(esStates[i]),
+                      1e-12);
+      // The EigenStepper evaluates the mass term of dt/ds in single precision
+      CHECK_CLOSE_REL(bes.time(bState, i), es.time(esStates[i]), 1e-8);
+      CHECK_CLOSE_ABS(bState.pathAccumulated[i],
+                      esStates[i].pathAccumulated, 1e-9);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(batched_eigen_stepper_masked_lanes) {
+  auto bField = std::make_shared<ConstantBField>(Vector3(0., 0., 2_T));
+
+  StepperPlainOptions options(tgContext, mfContext);
+  BatchedEigenStepper<4> bes(bField);
+  auto bState = bes.makeState(options);
+  BOOST_CHECK(!bes.anyActive(bState));
+
+  // Only three lanes are used, the last one stays inactive
+  auto tracks = makeTracks(3);
+  for (std::size_t i = 0; i < tracks.size(); ++i) {
+    bes.initialize(bState, i, tracks[i]);
+    bes.setStepLimit(bState, i, 1_cm);
+  }
+  BOOST_CHECK(bes.anyActive(bState));
+
+  auto res = bes.step(bState, Direction::Forward());
+  CHECK_CLOSE_ABS(res[0], 1_cm, 1e-12);
+  CHECK_CLOSE_ABS(res[3], 0., 1e-12);
+
+  // A deactivated lane is no longer updated
+  bes.deactivate(bState, 1);
+  const Vector3 pos1 = bes.position(bState, 1);
+  res = bes.step(bState, Direction::Backward());
+  CHECK_CLOSE_ABS(res[0], -1_cm, 1e-12);
+  CHECK_CLOSE_ABS(res[1], 0., 1e-12);
+  CHECK_CLOSE_ABS(bes.position(bState, 1), pos1, 1e-12);
+  CHECK_CLOSE_ABS(bState.pathAccumulated[0], 0., 1e-9);
+  BOOST_CHECK_EQUAL(bState.nSteps[0], 2u);
+  BOOST_CHECK_EQUAL(bState.nSteps[1], 1u);
+  BOOST_CHECK_EQUAL(bState.nSteps[3], 0u);
+
+  bes.deactivate(bState, 0);
+  bes.deactivate(bState, 2);
+  BOOST_CHECK(!bes.anyActive(bState));
+}
+
+BOOST_AUTO_TEST_CASE(batched_eigen_stepper_errors) {
+  auto bField = std::make_shared<NullBField>();
+  BatchedEigenStepper<2> bes(bField);
+
+  StepperPlainOptions options(tgContext, mfContext);
+  options.stepTolerance = 1e-21;
+  options.stepSizeCutOff = 1e20;
+  auto bState = bes.makeState(options);
+  auto tracks = makeTracks(1);
+  bes.initialize(bState, 0, tracks[0]);
+
+  // Test that we can reach the minimum step size, which only stops this lane
+  const Vector3 pos0 = bes.position(bState, 0);
+  auto res = bes.step(bState, Direction::Forward());
+  BOOST_CHECK(!bes.anyActive(bState));
+  BOOST_CHECK_EQUAL(bes.error(bState, 0),
+                    std::error_code(EigenStepperError::StepSizeStalled));
+  BOOST_CHECK(!bes.error(bState, 1));
+  CHECK_CLOSE_ABS(res[0], 0., 1e-12);
+  CHECK_CLOSE_ABS(bes.position(bState, 0), pos0, 1e-12);
+
+  // Initializing the lane again clears the error
+  bes.initialize(bState, 0, tracks[0]);
+  BOOST_CHECK(!bes.error(bState, 0));
+}
+
+BOOST_AUTO_TEST_CASE(batched_eigen_stepper_lane_field_error) {
+  auto bField = std::make_shared<BoundedBField>(Vector3(0., 0., 2_T), 10_cm);
+  BatchedEigenStepper<2> bes(bField);
+
+  StepperPlainOptions options(tgContext, mfContext);
+  auto bState = bes.makeState(options);
+  auto tracks = makeTracks(2);
+  for (std::size_t i = 0; i < tracks.size(); ++i) {
+    bes.initialize(bState, i, tracks[i]);
+    bes.setStepLimit(bState, i, 1_cm);
+  }
+
+  // Move the first lane to the field boundary, the step of the second lane
+  // does not depend on it
+  bState.posX[0] = 10_cm;
+  const Vector3 pos0 = bes.position(bState, 0);
+  auto res = bes.step(bState, Direction::Forward());
+  BOOST_CHECK_EQUAL(bes.error(bState, 0),
+                    std::error_code(MagneticFieldError::OutOfBounds));
+  CHECK_CLOSE_ABS(res[0], 0., 1e-12);
+  CHECK_CLOSE_ABS(bes.position(bState, 0), pos0, 1e-12);
+  BOOST_CHECK_EQUAL(bState.nSteps[0], 0u);
+
+  BOOST_CHECK(!bes.error(bState, 1));
+  CHECK_CLOSE_ABS(res[1], 1_cm, 1e-12);
+  BOOST_CHECK_EQUAL(bState.nSteps[1], 1u);
+  BOOST_CHECK(bes.anyActive(bState));
+
+  res = bes.step(bState, Direction::Forward());
+  CHECK_CLOSE_ABS(res[1], 1_cm, 1e-12);
+  BOOST_CHECK_EQUAL(bState.nSteps[1], 2u);
+}
+
+BOOST_AUTO_TEST_CASE(batched_eigen_stepper_field_batch) {
+  auto bField = std::make_shared<CountingBField>(Vector3(0., 0., 2_T));
+  BatchedEigenStepper<4> bes(bField);
+
+  StepperPlainOptions options(tgContext, mfContext);
+  auto bState = bes.makeState(options);
+  auto tracks = makeTracks(3);
+  for (std::size_t i = 0; i < tracks.size(); ++i) {
+    bes.initialize(bState, i, tracks[i]);
+    bes.setStepLimit(bState, i, 1_cm);
+  }
+
+  bes.step(bState, Direction::Forward());
+  for (std::size_t i = 0; i < tracks.size(); ++i) {
+    BOOST_CHECK_EQUAL(bState.nStepTrials[i], 1u);
+  }
+  // One look-up per stage for the active lanes only
+  BOOST_CHECK_EQUAL(bField->nBatchLookups, 3u);
+  BOOST_CHECK_EQUAL(bField->nBatchPositions, 3u * tracks.size());
+  BOOST_CHECK_EQUAL(bField->nSingleLookups, 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace ActsTests
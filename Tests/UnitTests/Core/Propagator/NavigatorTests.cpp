@@ -14,16 +14,22 @@
 #include "Acts/Definitions/Tolerance.hpp"
 #include "Acts/Definitions/Units.hpp"
 #include "Acts/Geometry/Blueprint.hpp"
+#include "Acts/Geometry/BlueprintOptions.hpp"
 #include "Acts/Geometry/ContainerBlueprintNode.hpp"
 #include "Acts/Geometry/CuboidVolumeBounds.hpp"
 #include "Acts/Geometry/CuboidVolumeBuilder.hpp"
 #include "Acts/Geometry/CylinderVolumeBounds.hpp"
 #include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/NavigationPolicyFactory.hpp"
 #include "Acts/Geometry/StaticBlueprintNode.hpp"
 #include "Acts/Geometry/TrackingGeometry.hpp"
 #include "Acts/Geometry/TrackingGeometryBuilder.hpp"
 #include "Acts/Geometry/TrackingVolume.hpp"
 #include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/Navigation/INavigationPolicy.hpp"
+#include "Acts/Navigation/NavigationCandidateCache.hpp"
+#include "Acts/Navigation/NavigationStream.hpp"
+#include "Acts/Navigation/TryAllNavigationPolicy.hpp"
 #include "Acts/Propagator/NavigationTarget.hpp"
 #include "Acts/Propagator/Navigator.hpp"
 #include "Acts/Surfaces/PerigeeSurface.hpp"
@@ -37,9 +43,13 @@
 #include "ActsTests/CommonHelpers/DetectorElementStub.hpp"
 #include "ActsTests/CommonHelpers/FloatComparisons.hpp"
 
+#include <algorithm>
 #include <cstddef>
 #include <memory>
+#include <stdexcept>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace bdata = boost::unit_test::data;
 
@@ -805,6 +815,218 @@ BOOST_AUTO_TEST_CASE(TryAllNavigationPolicy_SurfaceInsideVolume) {
   BOOST_CHECK(state.currentVolume->volumeName() == "parent");
 }
 
+/// Navigation policy which adds no candidates and only counts how often it is
+/// asked for them
+class CountingNavigationPolicy final : public INavigationPolicy {
+ public:
+  CountingNavigationPolicy(const GeometryContext& /*gctx*/,
+                           const TrackingVolume& /*volume*/,
+                           const Logger& /*logger*/,
+                           std::shared_ptr<std::size_t> nCalls,
+                           bool queryIndependent)
+      : m_nCalls(std::move(nCalls)), m_queryIndependent(queryIndependent) {}
+
+  void initializeCandidates(const GeometryContext& /*gctx*/,
+                            const NavigationArguments& /*args*/,
+                            AppendOnlyNavigationStream& /*stream*/,
+                            const Logger& /*logger*/) const {
+    ++(*m_nCalls);
+  }
+
+  void connect(NavigationDelegate& delegate) const override {
+    connectDefault<CountingNavigationPolicy>(delegate);
+  }
+
+  bool isQueryIndependent() const override { return m_queryIndependent; }
+
+ private:
+  std::shared_ptr<std::size_t> m_nCalls;
+  bool m_queryIndependent;
+};
+
+BOOST_AUTO_TEST_CASE(Navigator_candidate_cache) {
+  auto logger = getDefaultLogger("UnitTests", logLevel);
+
+  std::vector<std::unique_ptr<DetectorElementStub>> detElements;
+  std::vector<const Surface*> planes;
+  auto nPolicyCalls = std::make_shared<std::size_t>(0);
+
+  // Three planes in a single volume, navigated with a query independent or
+  // a query dependent policy
+  auto makeGeometry = [&](bool queryIndependent) {
+    Experimental::Blueprint::Config cfg;
+    cfg.envelope = ExtentEnvelope{{
+        .z = {20_mm, 20_mm},
+        .r = {0_mm, 20_mm},
+    }};
+    Experimental::Blueprint root{cfg};
+    auto& container =
+        root.addCuboidContainer("CuboidContainer", AxisDirection::AxisZ);
+
+    auto volume = std::make_unique<TrackingVolume>(
+        Transform3::Identity(),
+        std::make_shared<CuboidVolumeBounds>(1_m, 1_m, 1_m), "volume");
+    volume->assignGeometryId(GeometryIdentifier{}.withVolume(1));
+    planes.clear();
+    for (double z : {-500_mm, 0_mm, 500_mm}) {
+      const Transform3 trf(Translation3(0., 0., z));
+      auto surface = Surface::makeShared<PlaneSurface>(
+          trf, std::make_shared<const RectangleBounds>(200_mm, 200_mm));
+      detElements.push_back(std::make_unique<DetectorElementStub>(trf));
+      surface->assignSurfacePlacement(*detElements.back());
+      planes.push_back(surface.get());
+      volume->addSurface(surface);
+    }
+    container.addChild(
+        std::make_shared<Experimental::StaticBlueprintNode>(std::move(volume)));
+
+    Experimental::BlueprintOptions blueprintOptions;
+    blueprintOptions.defaultNavigationPolicyFactory =
+        NavigationPolicyFactory{}
+            .add<TryAllNavigationPolicy>()
+            .add<CountingNavigationPolicy>(nPolicyCalls, queryIndependent)
+            .asUniquePtr();
+    return root.construct(blueprintOptions, tgContext, *logger);
+  };
+
+  // Navigate along a straight line and collect the surfaces which are hit
+  auto navigate = [&](const Navigator& navigator,
+                      NavigationCandidateCache* cache, Vector3 position,
+                      const Vector3& direction,
+                      NavigatorStatistics& statistics) {
+    Navigator::Options options(tgContext);
+    options.candidateCache = cache;
+    Navigator::State state = navigator.makeState(options);
+    BOOST_REQUIRE(
+        navigator.initialize(state, position, direction, Direction::Forward())
+            .ok());
+
+    std::vector<const Surface*> surfaces;
+    while (!navigator.endOfWorldReached(state)) {
+      NavigationTarget target =
+          navigator.nextTarget(state, position, direction);
+      if (target.isNone()) {
+        break;
+      }
+      step(position, direction, target);
+      navigator.handleSurfaceReached(state, position, direction,
+                                     target.surface());
+      surfaces.push_back(&target.surface());
+    }
+    statistics = state.statistics;
+    return surfaces;
+  };
+
+  const Vector3 start{10_mm, -20_mm, -990_mm};
+  const Vector3 direction = Vector3(0.01, 0.02, 1.).normalized();
+  // Number of cached candidate resolutions of a propagation, which includes
+  // the volumes without the counting policy
+  std::size_t nCachedResolutions = 0;
+
+  {
+    Navigator::Config navCfg;
+    navCfg.trackingGeometry = makeGeometry(true);
+    Navigator navigator(navCfg, logger->clone("Navigator"));
+    NavigationCandidateCache cache({});
+
+    NavigatorStatistics reference;
+    auto expected = navigate(navigator, nullptr, start, direction, reference);
+    const std::size_t nReferenceCalls = std::exchange(*nPolicyCalls, 0);
+    BOOST_CHECK_GT(nReferenceCalls, 0u);
+    BOOST_CHECK_EQUAL(reference.nCandidateCacheHits, 0u);
+    BOOST_CHECK_EQUAL(reference.nCandidateCacheMisses, 0u);
+    for (const Surface* plane : planes) {
+      BOOST_CHECK(std::ranges::find(expected, plane) != expected.end());
+    }
+
+    // The first propagation fills the cache
+    NavigatorStatistics first;
+    BOOST_CHECK(navigate(navigator, &cache, start, direction, first) ==
+                expected);
+    BOOST_CHECK_EQUAL(first.nCandidateCacheHits, 0u);
+    BOOST_CHECK_GE(first.nCandidateCacheMisses, nReferenceCalls);
+    BOOST_CHECK_GT(cache.size(), 0u);
+    BOOST_CHECK_EQUAL(std::exchange(*nPolicyCalls, 0), nReferenceCalls);
+    nCachedResolutions = first.nCandidateCacheMisses;
+
+    // A nearby propagation with a similar direction reuses the candidates,
+    // finds the same surfaces and only calls the policy on cache misses
+    NavigatorStatistics second;
+    const Vector3 nearby = start + Vector3(1_mm, 1_mm, 0.);
+    BOOST_CHECK(navigate(navigator, &cache, nearby, direction, second) ==
+                expected);
+    BOOST_CHECK_GT(second.nCandidateCacheHits, 0u);
+    BOOST_CHECK_EQUAL(
+        second.nCandidateCacheHits + second.nCandidateCacheMisses,
+        nCachedResolutions);
+    BOOST_CHECK_LE(*nPolicyCalls, second.nCandidateCacheMisses);
+    BOOST_CHECK_LT(*nPolicyCalls, nReferenceCalls);
+
+    // The opposite direction does not share the cache entries
+    NavigatorStatistics backward;
+    navigate(navigator, &cache, Vector3{10_mm, -20_mm, 990_mm}, -direction,
+             backward);
+    BOOST_CHECK_EQUAL(backward.nCandidateCacheHits, 0u);
+
+    cache.clear();
+    BOOST_CHECK_EQUAL(cache.size(), 0u);
+  }
+
+  {
+    // Volumes with a query dependent policy bypass the cache
+    Navigator::Config navCfg;
+    navCfg.trackingGeometry = makeGeometry(false);
+    Navigator navigator(navCfg, logger->clone("Navigator"));
+    NavigationCandidateCache cache({});
+
+    *nPolicyCalls = 0;
+    NavigatorStatistics reference;
+    auto expected = navigate(navigator, nullptr, start, direction, reference);
+    const std::size_t nReferenceCalls = std::exchange(*nPolicyCalls, 0);
+
+    for (std::size_t i = 0; i < 2; ++i) {
+      NavigatorStatistics statistics;
+      BOOST_CHECK(navigate(navigator, &cache, start, direction, statistics) ==
+                  expected);
+      BOOST_CHECK_EQUAL(statistics.nCandidateCacheHits +
+                            statistics.nCandidateCacheMisses +
+                            nReferenceCalls,
+                        nCachedResolutions);
+    }
+    BOOST_CHECK_EQUAL(*nPolicyCalls, 2 * nReferenceCalls);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(NavigationCandidateCache_key) {
+  NavigationCandidateCache::Config cfg;
+  cfg.positionCellSize = 10_mm;
+  cfg.nPhiBins = 4;
+  cfg.nCosThetaBins = 2;
+  NavigationCandidateCache cache(cfg);
+
+  auto volume = std::make_unique<TrackingVolume>(
+      Transform3::Identity(),
+      std::make_shared<CuboidVolumeBounds>(1_m, 1_m, 1_m), "volume");
+  const Vector3 dir = Vector3(1., 0.1, 0.1).normalized();
+
+  auto key = cache.key(*volume, Vector3(1_mm, 1_mm, 1_mm), dir);
+  BOOST_CHECK(key == cache.key(*volume, Vector3(9_mm, 9_mm, 9_mm), dir));
+  BOOST_CHECK(key != cache.key(*volume, Vector3(11_mm, 1_mm, 1_mm), dir));
+  BOOST_CHECK(key != cache.key(*volume, Vector3(-1_mm, 1_mm, 1_mm), dir));
+  BOOST_CHECK(key != cache.key(*volume, Vector3(1_mm, 1_mm, 1_mm), -dir));
+  // The direction bins cover the full range including the poles
+  BOOST_CHECK_LT(cache.key(*volume, Vector3::Zero(), Vector3::UnitZ())
+                     .directionBin,
+                 cfg.nPhiBins * cfg.nCosThetaBins);
+  BOOST_CHECK_EQUAL(
+      cache.key(*volume, Vector3::Zero(), -Vector3::UnitZ()).directionBin /
+          cfg.nPhiBins,
+      0u);
+
+  BOOST_CHECK_THROW(NavigationCandidateCache({.positionCellSize = 0.}),
+                    std::invalid_argument);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace ActsTests
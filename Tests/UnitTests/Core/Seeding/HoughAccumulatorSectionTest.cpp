@@ -471,6 +471,70 @@ BOOST_AUTO_TEST_CASE(test_drill_and_expand_logic) {
   BOOST_CHECK_EQUAL(sStat[1].nLines, 3);
 }
 
+BOOST_AUTO_TEST_CASE(test_explore_sections_separately) {
+  // DESCRIPTION:
+  // Exploring each section of the stack on its own, starting from the last
+  // one, has to give the same results in the same order as exploring the
+  // whole stack at once. Parallel drivers rely on this to keep the order of
+  // the results independent of the scheduling.
+
+  std::vector<LineParameters> measurements = {
+      {1.0f, 0.0f}, {-1.0f, 0.0f}, {0.5f, 0.2f}, {-0.3f, -1.0f},
+      {2.0f, 3.0f}, {-2.0f, 3.1f}, {0.1f, 2.9f}, {1.5f, -4.0f}};
+
+  HoughExplorationOptions<LineParameters> opt;
+  opt.xMinBinSize = 0.5f;
+  opt.yMinBinSize = 0.5f;
+  opt.lineFunctor = [](const LineParameters &p, float arg) {
+    return p.slope * arg + p.intercept;
+  };
+  opt.decisionFunctor = [&opt](const HoughAccumulatorSection &sec,
+                               const std::vector<LineParameters> &) {
+    using enum HoughAccumulatorSection::Decision;
+    if (sec.count() < 2) {
+      return Discard;
+    }
+    if (sec.xSize() <= opt.xMinBinSize && sec.ySize() <= opt.yMinBinSize) {
+      return Accept;
+    }
+    return Drill;
+  };
+
+  std::vector<HoughAccumulatorSection> roots;
+  for (float xBegin : {-8.0f, 0.0f}) {
+    for (float yBegin : {-8.0f, 0.0f}) {
+      roots.emplace_back(8.0f, 8.0f, xBegin, yBegin);
+      roots.back().indices() = {0, 1, 2, 3, 4, 5, 6, 7};
+    }
+  }
+
+  std::vector<HoughAccumulatorSection> stack = roots;
+  std::vector<HoughAccumulatorSection> expected;
+  exploreHoughParametersSpace(stack, measurements, opt, expected);
+  BOOST_REQUIRE(!expected.empty());
+
+  std::vector<HoughAccumulatorSection> results;
+  HoughSectionPool pool;
+  for (auto root = roots.rbegin(); root != roots.rend(); ++root) {
+    stack = {*root};
+    exploreHoughParametersSpace(stack, measurements, opt, results, pool);
+  }
+
+  BOOST_REQUIRE_EQUAL(results.size(), expected.size());
+  for (std::size_t i = 0; i < results.size(); ++i) {
+    BOOST_CHECK_EQUAL(results[i].xBegin(), expected[i].xBegin());
+    BOOST_CHECK_EQUAL(results[i].yBegin(), expected[i].yBegin());
+    BOOST_CHECK_EQUAL_COLLECTIONS(
+        results[i].indices().begin(), results[i].indices().end(),
+        expected[i].indices().begin(), expected[i].indices().end());
+  }
+
+  // the indices of discarded sections are kept for reuse
+  std::vector<std::uint32_t> reused = pool.acquire();
+  BOOST_CHECK(reused.empty());
+  BOOST_CHECK_GT(reused.capacity(), 0u);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace ActsTests
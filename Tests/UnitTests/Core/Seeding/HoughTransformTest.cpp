@@ -16,6 +16,8 @@
 
 #include <array>
 #include <format>
+#include <thread>
+#include <utility>
 #include <vector>
 
 using namespace Acts;
@@ -261,6 +263,124 @@ BOOST_AUTO_TEST_CASE(hough_plane_layers_hits) {
   BOOST_CHECK_EQUAL(nHits, plane.nHits(0, 0));
 }
 
+BOOST_AUTO_TEST_CASE(hough_plane_cell_lists) {
+  // Fill a few cells of a plane in interleaved order and check that the
+  // per-cell hit and layer lists keep the fill order, also after a reset
+  HoughTransformUtils::HoughPlaneConfig config{4, 3};
+  HoughTransformUtils::HoughPlane<int> plane(config);
+
+  for (int pass = 0; pass < 2; ++pass) {
+    plane.reset();
+    BOOST_CHECK(plane.getNonEmptyBins().empty());
+    BOOST_CHECK(plane.hitIds(1, 2).empty());
+
+    plane.fillBin(1, 2, 10, 0);
+    plane.fillBin(3, 0, 20, 1);
+    plane.fillBin(1, 2, 11, 0);
+    // a repeated hit is only counted once
+    plane.fillBin(1, 2, 11, 0);
+    plane.fillBin(1, 2, 12, 2);
+    plane.fillBin(3, 0, 21, 1);
+
+    const std::vector<std::size_t> expBins{plane.globalBin({1, 2}),
+                                           plane.globalBin({3, 0})};
+    BOOST_CHECK_EQUAL_COLLECTIONS(plane.getNonEmptyBins().begin(),
+                                  plane.getNonEmptyBins().end(),
+                                  expBins.begin(), expBins.end());
+    for (const std::size_t bin : expBins) {
+      const auto xy = plane.axisBins(bin);
+      BOOST_CHECK_EQUAL(plane.globalBin(xy), bin);
+    }
+
+    const std::vector<int> expHits{10, 11, 12};
+    const auto hits = plane.hitIds(1, 2);
+    BOOST_CHECK_EQUAL_COLLECTIONS(hits.begin(), hits.end(), expHits.begin(),
+                                  expHits.end());
+    const std::vector<unsigned> expLayers{0, 2};
+    const auto layers = plane.layers(1, 2);
+    BOOST_CHECK_EQUAL_COLLECTIONS(layers.begin(), layers.end(),
+                                  expLayers.begin(), expLayers.end());
+    BOOST_CHECK_EQUAL(plane.nHits(1, 2), 3.f);
+    BOOST_CHECK_EQUAL(plane.nLayers(1, 2), 2.f);
+    BOOST_CHECK_EQUAL(plane.nHits(3, 0), 2.f);
+    BOOST_CHECK_EQUAL(plane.nLayers(3, 0), 1.f);
+    BOOST_CHECK_EQUAL(plane.maxHits(), 3.f);
+    BOOST_CHECK(plane.locMaxHits() == std::make_pair(1ul, 2ul));
+
+    // filling after the lists were accessed updates them
+    plane.fillBin(3, 0, 22, 2);
+    const std::vector<int> expHits30{20, 21, 22};
+    const auto hits30 = plane.hitIds(3, 0);
+    BOOST_CHECK_EQUAL_COLLECTIONS(hits30.begin(), hits30.end(),
+                                  expHits30.begin(), expHits30.end());
+    BOOST_CHECK_EQUAL(plane.layers(3, 0).size(), 2u);
+    BOOST_CHECK_EQUAL(plane.hitIds(0, 0).size(), 0u);
+  }
+  BOOST_CHECK_THROW(plane.fillBin(4, 0, 1, 0), std::out_of_range);
+  BOOST_CHECK_THROW(plane.hitIds(0, 3), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(hough_plane_concurrent_access) {
+  // The cell lists are assembled by the first const access after filling,
+  // which may happen concurrently from several threads
+  HoughTransformUtils::HoughPlaneConfig config{8, 8};
+  HoughTransformUtils::HoughPlane<int> plane(config);
+  for (int hit = 0; hit < 640; ++hit) {
+    plane.fillBin(hit % 8, (hit / 8) % 8, hit, hit % 3);
+  }
+
+  constexpr std::size_t nThreads = 4;
+  std::vector<std::size_t> nHitsSeen(nThreads, 0);
+  std::vector<std::thread> threads;
+  for (std::size_t t = 0; t < nThreads; ++t) {
+    threads.emplace_back([&, t]() {
+      for (std::size_t x = 0; x < 8; ++x) {
+        for (std::size_t y = 0; y < 8; ++y) {
+          nHitsSeen[t] += plane.hitIds(x, y).size();
+        }
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  for (const std::size_t nHits : nHitsSeen) {
+    BOOST_CHECK_EQUAL(nHits, 640u);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(hough_plane_copy_and_move) {
+  HoughTransformUtils::HoughPlaneConfig config{4, 3};
+  HoughTransformUtils::HoughPlane<int> plane(config);
+  plane.fillBin(1, 2, 10, 0);
+  plane.fillBin(1, 2, 11, 1);
+  // assemble the lists before copying
+  BOOST_CHECK_EQUAL(plane.hitIds(1, 2).size(), 2u);
+
+  const std::vector<int> expHits{10, 11, 12};
+  auto checkHits = [&](const HoughTransformUtils::HoughPlane<int>& p) {
+    const auto hits = p.hitIds(1, 2);
+    BOOST_CHECK_EQUAL_COLLECTIONS(hits.begin(), hits.end(), expHits.begin(),
+                                  expHits.end());
+    BOOST_CHECK_EQUAL(p.layers(1, 2).size(), 3u);
+  };
+
+  // the copy is filled further and rebuilds its own lists
+  HoughTransformUtils::HoughPlane<int> copy(plane);
+  copy.fillBin(1, 2, 12, 2);
+  checkHits(copy);
+  BOOST_CHECK_EQUAL(plane.hitIds(1, 2).size(), 2u);
+
+  HoughTransformUtils::HoughPlane<int> moved(std::move(copy));
+  checkHits(moved);
+
+  plane = moved;
+  checkHits(plane);
+  HoughTransformUtils::HoughPlane<int> assigned(config);
+  assigned = std::move(moved);
+  checkHits(assigned);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace ActsTests
@@ -433,6 +433,64 @@ BOOST_AUTO_TEST_CASE(ZeroFieldBackward) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(ZeroFieldForwardCandidateTrajectory) {
+  Fixture f(0_T);
+
+  auto options = f.makeCkfOptions();
+  options.propagatorPlainOptions.direction = Direction::Forward();
+
+  Fixture::TestSourceLinkAccessor slAccessor;
+  slAccessor.container = &f.sourceLinks;
+
+  auto trackStateCreator = makeTrackStateCreator(slAccessor, f.measSel);
+  options.extensions.createTrackStates
+      .template connect<&decltype(trackStateCreator)::createTrackStates>(
+          &trackStateCreator);
+
+  auto findTracks = [&](TrackContainer& tc) {
+    for (std::size_t trackId = 0u; trackId < f.startParameters.size();
+         ++trackId) {
+      auto res = f.ckf.findTracks(f.startParameters.at(trackId), options, tc);
+      BOOST_REQUIRE(res.ok());
+    }
+  };
+
+  TrackContainer reference{VectorTrackContainer{}, VectorMultiTrajectory{}};
+  findTracks(reference);
+
+  // With a candidate trajectory only the selected measurements end up in the
+  // output trajectory
+  VectorMultiTrajectory candidateTrajectory;
+  trackStateCreator.candidateTrajectory = &candidateTrajectory;
+  TrackContainer tc{VectorTrackContainer{}, VectorMultiTrajectory{}};
+  findTracks(tc);
+
+  BOOST_CHECK_EQUAL(tc.size(), reference.size());
+  BOOST_CHECK_LT(tc.trackStateContainer().size(),
+                 reference.trackStateContainer().size());
+  BOOST_CHECK_GT(candidateTrajectory.size(), 0u);
+
+  for (std::size_t trackId = 0u; trackId < tc.size(); ++trackId) {
+    const auto track = tc.getTrack(trackId);
+    const auto referenceTrack = reference.getTrack(trackId);
+    BOOST_CHECK_EQUAL(track.nTrackStates(), referenceTrack.nTrackStates());
+    BOOST_CHECK_EQUAL(track.nMeasurements(), referenceTrack.nMeasurements());
+    auto trackStates = track.trackStatesReversed();
+    auto referenceStates = referenceTrack.trackStatesReversed();
+    auto it = trackStates.begin();
+    auto refIt = referenceStates.begin();
+    for (; it != trackStates.end() && refIt != referenceStates.end();
+         ++it, ++refIt) {
+      auto sl =
+          (*it).getUncalibratedSourceLink().template get<TestSourceLink>();
+      auto refSl =
+          (*refIt).getUncalibratedSourceLink().template get<TestSourceLink>();
+      BOOST_CHECK_EQUAL(sl.sourceId, refSl.sourceId);
+      BOOST_CHECK_EQUAL(sl.m_geometryId, refSl.m_geometryId);
+    }
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace ActsTests
@@ -10,15 +10,21 @@
 #include <boost/test/unit_test.hpp>
 
 #include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/MagneticField/BFieldMapStorage.hpp"
 #include "Acts/MagneticField/BFieldMapUtils.hpp"
 #include "Acts/MagneticField/InterpolatedBFieldMap.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
 #include "Acts/Utilities/Result.hpp"
 #include "Acts/Utilities/VectorHelpers.hpp"
 #include "ActsTests/CommonHelpers/FloatComparisons.hpp"
 
 #include <array>
+#include <cmath>
 #include <cstddef>
+#include <limits>
 #include <random>
+#include <stdexcept>
 #include <vector>
 
 namespace bdata = boost::unit_test::data;
@@ -369,6 +375,129 @@ BOOST_DATA_TEST_CASE(
   CHECK_CLOSE_REL(value0_xyz, value4_xyz, 1e-10);
 }
 
+BOOST_AUTO_TEST_CASE(bfield_compact_storage) {
+  using namespace Acts::UnitLiterals;
+
+  std::vector<double> rPos;
+  std::vector<double> xPos;
+  for (int i = 0; i < 11; ++i) {
+    rPos.push_back(i * 10.);
+    xPos.push_back(i * 10. - 50.);
+  }
+  std::vector<double> zPos = xPos;
+
+  // smooth field of a few Tesla with arbitrary decimals
+  auto field = [](double a, double b, double c) {
+    return Acts::Vector3(2_T * std::cos(0.013 * a) + 0.123456_T,
+                         0.5_T * std::sin(0.021 * b) - 0.012345_T,
+                         3.9_T - 0.0001 * a * c * 1_T);
+  };
+
+  auto localToGlobalBin_rz = [](std::array<std::size_t, 2> binsRZ,
+                                std::array<std::size_t, 2> nBinsRZ) {
+    return (binsRZ.at(1) * nBinsRZ.at(0) + binsRZ.at(0));
+  };
+  std::vector<Acts::Vector2> bField_rz(rPos.size() * zPos.size());
+  for (std::size_t i = 0; i < rPos.size(); ++i) {
+    for (std::size_t j = 0; j < zPos.size(); ++j) {
+      const Acts::Vector3 b = field(rPos[i], zPos[j], rPos[i]);
+      const std::size_t bin =
+          localToGlobalBin_rz({{i, j}}, {{rPos.size(), zPos.size()}});
+      bField_rz.at(bin) = Acts::Vector2(b.x(), b.z());
+    }
+  }
+
+  auto localToGlobalBin_xyz = [](std::array<std::size_t, 3> binsXYZ,
+                                 std::array<std::size_t, 3> nBinsXYZ) {
+    return (binsXYZ.at(0) * (nBinsXYZ.at(1) * nBinsXYZ.at(2)) +
+            binsXYZ.at(1) * nBinsXYZ.at(2) + binsXYZ.at(2));
+  };
+  std::vector<Acts::Vector3> bField_xyz;
+  for (double x : xPos) {
+    for (double y : xPos) {
+      for (double z : zPos) {
+        bField_xyz.push_back(field(x, y, z));
+      }
+    }
+  }
+
+  const double maxError = 1e-4_T;
+  const Int16BFieldStorage int16Storage(maxError);
+  BOOST_CHECK_EQUAL(int16Storage.maxError(), maxError);
+  BOOST_CHECK_EQUAL(int16Storage.maxError(5_T), maxError);
+  BOOST_CHECK_EQUAL(DoubleBFieldStorage{}.maxError(5_T), 0.);
+  // the field components are below 5 T
+  const double floatError = FloatBFieldStorage{}.maxError(5_T);
+  BOOST_CHECK_GT(floatError, 0.);
+
+  auto map_rz =
+      Acts::fieldMapRZ(localToGlobalBin_rz, rPos, zPos, bField_rz, 1, 1);
+  auto mapFloat_rz = Acts::fieldMapRZ(FloatBFieldStorage{}, localToGlobalBin_rz,
+                                      rPos, zPos, bField_rz, 1, 1);
+  auto mapInt16_rz = Acts::fieldMapRZ(int16Storage, localToGlobalBin_rz, rPos,
+                                      zPos, bField_rz, 1, 1);
+
+  auto map_xyz = Acts::fieldMapXYZ(localToGlobalBin_xyz, xPos, xPos, zPos,
+                                   bField_xyz, 1, 1);
+  auto mapFloat_xyz =
+      Acts::fieldMapXYZ(FloatBFieldStorage{}, localToGlobalBin_xyz, xPos, xPos,
+                        zPos, bField_xyz, 1, 1);
+  auto mapInt16_xyz = Acts::fieldMapXYZ(
+      int16Storage, localToGlobalBin_xyz, xPos, xPos, zPos, bField_xyz, 1, 1);
+
+  BOOST_CHECK(mapInt16_rz.getNBins() == map_rz.getNBins());
+  BOOST_CHECK(mapInt16_rz.getMin() == map_rz.getMin());
+  BOOST_CHECK(mapInt16_rz.getMax() == map_rz.getMax());
+  BOOST_CHECK_LT(sizeof(decltype(mapFloat_xyz)::FieldType),
+                 sizeof(decltype(map_xyz)::FieldType));
+  BOOST_CHECK_LT(sizeof(decltype(mapInt16_xyz)::FieldType),
+                 sizeof(decltype(mapFloat_xyz)::FieldType));
+
+  // compare the compact maps to the double precision map at random positions
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> dist(-49.9, 39.9);
+  auto cacheFloat = mapFloat_xyz.makeCache(MagneticFieldContext());
+  auto cacheInt16 = mapInt16_xyz.makeCache(MagneticFieldContext());
+  for (int i = 0; i < 1000; ++i) {
+    const Acts::Vector3 pos(dist(rng), dist(rng), dist(rng));
+
+    // the interpolated value is a convex combination of the node values,
+    // hence the node error also bounds the interpolation error
+    const Acts::Vector3 b_rz = map_rz.getField(pos).value();
+    CHECK_CLOSE_ABS(mapFloat_rz.getField(pos).value(), b_rz, floatError);
+    CHECK_CLOSE_ABS(mapInt16_rz.getField(pos).value(), b_rz, maxError);
+
+    const Acts::Vector3 b_xyz = map_xyz.getField(pos).value();
+    CHECK_CLOSE_ABS(mapFloat_xyz.getField(pos).value(), b_xyz, floatError);
+    CHECK_CLOSE_ABS(mapInt16_xyz.getField(pos).value(), b_xyz, maxError);
+    CHECK_CLOSE_ABS(mapInt16_xyz.getFieldUnchecked(pos), b_xyz, maxError);
+
+    // the cell based lookup agrees with the direct interpolation
+    CHECK_CLOSE_ABS(mapFloat_xyz.getField(pos, cacheFloat).value(),
+                    mapFloat_xyz.getField(pos).value(), 1e-12);
+    CHECK_CLOSE_ABS(mapInt16_xyz.getField(pos, cacheInt16).value(),
+                    mapInt16_xyz.getField(pos).value(), 1e-12);
+  }
+
+  // field values beyond the representable range are rejected
+  const Int16BFieldStorage coarseStorage(1e-5_T);
+  const double limit = 32767 * coarseStorage.quantum();
+  const Acts::Vector3 inRange = coarseStorage.decode(
+      coarseStorage.encode(Acts::Vector3(limit, -limit, 1e-4_T)));
+  CHECK_CLOSE_REL(inRange, Acts::Vector3(limit, -limit, 1e-4_T), 1e-12);
+  BOOST_CHECK_THROW(coarseStorage.encode(Acts::Vector3(1_T, 0., 0.)),
+                    std::invalid_argument);
+  BOOST_CHECK_THROW(Acts::fieldMapXYZ(coarseStorage, localToGlobalBin_xyz,
+                                      xPos, xPos, zPos, bField_xyz, 1, 1),
+                    std::invalid_argument);
+
+  // NaN can not be encoded
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  BOOST_CHECK_THROW(int16Storage.encode(Acts::Vector2(0., nan)),
+                    std::invalid_argument);
+  BOOST_CHECK_THROW(Int16BFieldStorage(0.), std::invalid_argument);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace ActsTests
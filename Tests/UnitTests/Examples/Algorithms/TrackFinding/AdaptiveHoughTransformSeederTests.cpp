@@ -0,0 +1,128 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/Utilities/Logger.hpp"
+#include "ActsExamples/EventData/Seed.hpp"
+#include "ActsExamples/EventData/SpacePoint.hpp"
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Framework/WhiteBoard.hpp"
+#include "ActsExamples/TrackFinding/AdaptiveHoughTransformSeeder.hpp"
+#include "ActsTests/CommonHelpers/WhiteBoardUtilities.hpp"
+
+#include <array>
+#include <cmath>
+#include <numbers>
+#include <random>
+#include <vector>
+
+#include <tbb/global_control.h>
+#include <tbb/task_arena.h>
+
+using namespace Acts;
+using namespace Acts::UnitLiterals;
+using namespace ActsExamples;
+
+namespace {
+
+/// Space points of tracks from the beam line and some noise, on cylindrical
+/// layers. The track parameters follow the line parametrisations of the
+/// seeder, i.e. phi(r) = phi0 - r * q/pT * 3e-4 and z(r) = z0 + r * cot(theta).
+SpacePointContainer makeSpacePoints() {
+  SpacePointContainer spacePoints(SpacePointColumns::X | SpacePointColumns::Y |
+                                  SpacePointColumns::Z | SpacePointColumns::R);
+  auto addSpacePoint = [&](double r, double phi, double z) {
+    auto sp = spacePoints.createSpacePoint();
+    sp.x() = static_cast<float>(r * std::cos(phi));
+    sp.y() = static_cast<float>(r * std::sin(phi));
+    sp.z() = static_cast<float>(z);
+    sp.r() = static_cast<float>(r);
+  };
+
+  const std::array<double, 8> radii = {35_mm,  70_mm,  110_mm, 160_mm,
+                                       220_mm, 300_mm, 400_mm, 550_mm};
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> phiDist(-std::numbers::pi,
+                                                 std::numbers::pi);
+  std::uniform_real_distribution<double> qOverPtDist(-0.8, 0.8);
+  std::uniform_real_distribution<double> cotThetaDist(-2, 2);
+  std::uniform_real_distribution<double> z0Dist(-50_mm, 50_mm);
+  std::uniform_real_distribution<double> zDist(-1000_mm, 1000_mm);
+
+  for (int track = 0; track < 40; ++track) {
+    const double phi0 = phiDist(rng);
+    const double qOverPt = qOverPtDist(rng);
+    const double cotTheta = cotThetaDist(rng);
+    const double z0 = z0Dist(rng);
+    for (double r : radii) {
+      addSpacePoint(r, phi0 - r * qOverPt * 3e-4, z0 + r * cotTheta);
+    }
+  }
+  for (int noise = 0; noise < 100; ++noise) {
+    addSpacePoint(radii[noise % radii.size()], phiDist(rng), zDist(rng));
+  }
+  return spacePoints;
+}
+
+SeedContainer runSeeder(const AdaptiveHoughTransformSeeder::Config& cfg,
+                        const SpacePointContainer& spacePoints) {
+  AdaptiveHoughTransformSeeder seeder(
+      cfg, getDefaultLogger("AdaptiveHoughTransformSeeder", Logging::WARNING));
+  WhiteBoard board;
+  ActsTests::addToWhiteBoard(cfg.inputSpacePoints, spacePoints, board);
+  AlgorithmContext ctx(0, 0, board, 0);
+  BOOST_CHECK(seeder.execute(ctx) == ProcessCode::SUCCESS);
+  return ActsTests::getFromWhiteBoard<SeedContainer>(cfg.outputSeeds, board);
+}
+
+}  // namespace
+
+namespace ActsTests {
+
+BOOST_AUTO_TEST_SUITE(TrackFindingSuite)
+
+BOOST_AUTO_TEST_CASE(AdaptiveHoughParallelExplorationMatchesSequential) {
+  const SpacePointContainer spacePoints = makeSpacePoints();
+
+  AdaptiveHoughTransformSeeder::Config cfg;
+  cfg.inputSpacePoints = "spacepoints";
+  cfg.outputSeeds = "seeds";
+  const SeedContainer sequential = runSeeder(cfg, spacePoints);
+  BOOST_CHECK(!sequential.empty());
+
+  // run the tasks on several threads also on machines with one core
+  tbb::global_control control(tbb::global_control::max_allowed_parallelism,
+                              4);
+  tbb::task_arena arena(4);
+
+  // small grain sizes spawn tasks down to the smallest sections
+  for (unsigned grainSize : {1u, 8u, 64u}) {
+    BOOST_TEST_CONTEXT("grain size " << grainSize) {
+      cfg.parallelExploration = true;
+      cfg.parallelGrainSize = grainSize;
+      SeedContainer parallel;
+      arena.execute([&]() { parallel = runSeeder(cfg, spacePoints); });
+
+      BOOST_REQUIRE_EQUAL(parallel.size(), sequential.size());
+      for (SeedIndex i = 0; i < sequential.size(); ++i) {
+        const auto expected = sequential.at(i).spacePointIndices();
+        const auto actual = parallel.at(i).spacePointIndices();
+        BOOST_CHECK_EQUAL_COLLECTIONS(actual.begin(), actual.end(),
+                                      expected.begin(), expected.end());
+        BOOST_CHECK_EQUAL(parallel.at(i).vertexZ(),
+                          sequential.at(i).vertexZ());
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace ActsTests
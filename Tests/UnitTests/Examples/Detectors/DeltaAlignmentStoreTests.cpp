@@ -0,0 +1,256 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/TrackingGeometry.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Surfaces/RectangleBounds.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Surfaces/SurfacePlacementBase.hpp"
+#include "ActsExamples/DetectorCommons/Aligned.hpp"
+#include "ActsExamples/DetectorCommons/AlignmentContext.hpp"
+#include "ActsExamples/DetectorCommons/DeltaAlignmentStore.hpp"
+#include "ActsTests/CommonHelpers/CylindricalTrackingGeometry.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <optional>
+
+using namespace Acts;
+using namespace ActsExamples;
+
+namespace ActsTests {
+
+namespace {
+
+GeometryContext tgContext = GeometryContext::dangerouslyDefaultConstruct();
+
+std::shared_ptr<const TrackingGeometry> trackingGeometry() {
+  // The builder owns the detector elements and has to outlive the geometry
+  static CylindricalTrackingGeometry cGeometry(tgContext);
+  static std::shared_ptr<const TrackingGeometry> tGeometry = cGeometry();
+  return tGeometry;
+}
+
+/// Detector element with its own surface sharing the geometry id of a
+/// surface of the tracking geometry
+class PlaneElement : public SurfacePlacementBase {
+ public:
+  PlaneElement(const Transform3& nominal, GeometryIdentifier geometryId)
+      : m_nominal(nominal),
+        m_surface(Surface::makeShared<PlaneSurface>(
+            nominal, std::make_shared<RectangleBounds>(1., 1.))) {
+    m_surface->assignGeometryId(geometryId);
+  }
+
+  const Transform3& localToGlobalTransform(
+      const GeometryContext& /*gctx*/) const override {
+    return m_nominal;
+  }
+  const Transform3& nominalTransform() const { return m_nominal; }
+  const Surface& surface() const override { return *m_surface; }
+  Surface& surface() override { return *m_surface; }
+  bool isSensitive() const override { return true; }
+
+ private:
+  Transform3 m_nominal;
+  std::shared_ptr<PlaneSurface> m_surface;
+};
+
+/// Forwards to another store and counts the dense index look-ups
+class CountingStore final : public IAlignmentStore {
+ public:
+  explicit CountingStore(const IAlignmentStore& store) : m_store(&store) {}
+
+  std::shared_ptr<IAlignmentStore> clone() const override {
+    return std::make_shared<CountingStore>(*m_store);
+  }
+  const Transform3* contextualTransform(
+      const Surface& surface) const override {
+    return m_store->contextualTransform(surface);
+  }
+  std::optional<std::size_t> denseIndex(
+      const Surface& surface) const override {
+    ++nIndexLookups;
+    return m_store->denseIndex(surface);
+  }
+  const Transform3* contextualTransformByIndex(
+      const Surface& surface, std::size_t index) const override {
+    return m_store->contextualTransformByIndex(surface, index);
+  }
+  void visitStore(
+      const std::function<void(Transform3*)>& /*visitor*/) override {}
+
+  mutable std::size_t nIndexLookups = 0;
+
+ private:
+  const IAlignmentStore* m_store;
+};
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(DetectorsSuite)
+
+BOOST_AUTO_TEST_CASE(DeltaAlignmentStoreLookup) {
+  auto geometry = trackingGeometry();
+  BOOST_REQUIRE_GT(geometry->numSensitiveSurfaces(),
+                   DeltaAlignmentStore::s_blockSize);
+
+  const Surface& first = *geometry->surfaceByIndex(0);
+  const Surface& last =
+      *geometry->surfaceByIndex(geometry->numSensitiveSurfaces() - 1);
+  const Transform3 shifted = Translation3(Vector3(0., 0., 1.)) *
+                             first.localToGlobalTransform(tgContext);
+
+  DeltaAlignmentStore store(geometry, {{first.geometryId(), shifted}});
+  BOOST_CHECK_EQUAL(store.numAlignedSurfaces(), 1u);
+  BOOST_CHECK_EQUAL(store.numBlocks(), 1u);
+
+  const Transform3* aligned = store.contextualTransform(first);
+  BOOST_REQUIRE_NE(aligned, nullptr);
+  BOOST_CHECK(aligned->isApprox(shifted));
+  // Surfaces without a delta fall back to the nominal transform
+  BOOST_CHECK_EQUAL(store.contextualTransform(last), nullptr);
+
+  // The indexed lookup agrees with the lookup by surface
+  BOOST_CHECK(store.denseIndex(first) == 0u);
+  BOOST_CHECK_EQUAL(store.contextualTransformByIndex(first, 0), aligned);
+  BOOST_CHECK_EQUAL(
+      store.contextualTransformByIndex(first, geometry->numSensitiveSurfaces()),
+      nullptr);
+
+  // Only sensitive surfaces can be aligned
+  BOOST_CHECK_THROW(
+      store.setTransform(GeometryIdentifier().withVolume(1), shifted),
+      std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(DeltaAlignmentStoreCopyOnWrite) {
+  auto geometry = trackingGeometry();
+  const Surface& first = *geometry->surfaceByIndex(0);
+  const Surface& last =
+      *geometry->surfaceByIndex(geometry->numSensitiveSurfaces() - 1);
+  const Transform3 shifted = Translation3(Vector3(1., 0., 0.)) *
+                             first.localToGlobalTransform(tgContext);
+
+  DeltaAlignmentStore store(geometry);
+  store.setTransform(first.geometryId(),
+                     first.localToGlobalTransform(tgContext));
+  store.setTransform(last.geometryId(), last.localToGlobalTransform(tgContext));
+
+  auto cloned = std::dynamic_pointer_cast<DeltaAlignmentStore>(store.clone());
+  BOOST_REQUIRE_NE(cloned, nullptr);
+  BOOST_CHECK_EQUAL(cloned->numBlocks(), 2u);
+  BOOST_CHECK_EQUAL(cloned->numSharedBlocks(), 2u);
+  BOOST_CHECK_EQUAL(cloned->contextualTransform(first),
+                    store.contextualTransform(first));
+
+  // Modifying the clone copies only the affected block
+  cloned->setTransform(first.geometryId(), shifted);
+  BOOST_CHECK_EQUAL(cloned->numSharedBlocks(), 1u);
+  BOOST_CHECK_EQUAL(store.numSharedBlocks(), 1u);
+  BOOST_CHECK(cloned->contextualTransform(first)->isApprox(shifted));
+  BOOST_CHECK(store.contextualTransform(first)->isApprox(
+      first.localToGlobalTransform(tgContext)));
+  BOOST_CHECK_EQUAL(cloned->contextualTransform(last),
+                    store.contextualTransform(last));
+}
+
+BOOST_AUTO_TEST_CASE(DeltaAlignmentStoreVisit) {
+  auto geometry = trackingGeometry();
+  const Vector3 shift(0., 0., 5.);
+
+  DeltaAlignmentStore nominal(geometry);
+  auto shiftedStore = nominal.clone();
+  shiftedStore->visitStore(
+      [&](Transform3* transform) { transform->pretranslate(shift); });
+
+  auto& shifted = dynamic_cast<DeltaAlignmentStore&>(*shiftedStore);
+  BOOST_CHECK_EQUAL(shifted.numAlignedSurfaces(),
+                    geometry->numSensitiveSurfaces());
+  BOOST_CHECK_EQUAL(nominal.numBlocks(), 0u);
+
+  for (const Surface* surface : geometry->sensitiveSurfaces()) {
+    const Transform3* transform = shifted.contextualTransform(*surface);
+    BOOST_REQUIRE_NE(transform, nullptr);
+    BOOST_CHECK(transform->translation().isApprox(
+        surface->localToGlobalTransform(tgContext).translation() + shift));
+    BOOST_CHECK_EQUAL(nominal.contextualTransform(*surface), nullptr);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(DeltaAlignmentStoreVisitShares) {
+  auto geometry = trackingGeometry();
+  const Surface& first = *geometry->surfaceByIndex(0);
+  const Surface& last =
+      *geometry->surfaceByIndex(geometry->numSensitiveSurfaces() - 1);
+  const Vector3 lastCenter =
+      last.localToGlobalTransform(tgContext).translation();
+  const Transform3 shifted = Translation3(Vector3(0., 1., 0.)) *
+                             first.localToGlobalTransform(tgContext);
+
+  DeltaAlignmentStore nominal(geometry, {{first.geometryId(), shifted}});
+
+  // A generator which changes nothing does not touch any block
+  auto unchanged =
+      std::dynamic_pointer_cast<DeltaAlignmentStore>(nominal.clone());
+  unchanged->visitStore([](Transform3* /*transform*/) {});
+  BOOST_CHECK_EQUAL(unchanged->numAlignedSurfaces(), 1u);
+  BOOST_CHECK_EQUAL(unchanged->numBlocks(), 1u);
+  BOOST_CHECK_EQUAL(unchanged->numSharedBlocks(), 1u);
+
+  // A generator which moves one surface only allocates that surface's block
+  auto generated =
+      std::dynamic_pointer_cast<DeltaAlignmentStore>(nominal.clone());
+  generated->visitStore([&](Transform3* transform) {
+    if (transform->translation().isApprox(lastCenter)) {
+      transform->pretranslate(Vector3(0., 0., 2.));
+    }
+  });
+  BOOST_CHECK_EQUAL(generated->numAlignedSurfaces(), 2u);
+  BOOST_CHECK_EQUAL(generated->numBlocks(), 2u);
+  BOOST_CHECK_EQUAL(generated->numSharedBlocks(), 1u);
+  BOOST_CHECK_EQUAL(generated->contextualTransform(first),
+                    nominal.contextualTransform(first));
+  BOOST_REQUIRE_NE(generated->contextualTransform(last), nullptr);
+  BOOST_CHECK(generated->contextualTransform(last)->translation().isApprox(
+      lastCenter + Vector3(0., 0., 2.)));
+  BOOST_CHECK_EQUAL(nominal.contextualTransform(last), nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(DeltaAlignmentStoreAlignedElement) {
+  auto geometry = trackingGeometry();
+  const Surface& first = *geometry->surfaceByIndex(0);
+  const Transform3 nominal = first.localToGlobalTransform(tgContext);
+  const Transform3 shifted = Translation3(Vector3(0., 0., 2.)) * nominal;
+
+  DeltaAlignmentStore aligned(geometry, {{first.geometryId(), shifted}});
+  DeltaAlignmentStore unaligned(geometry);
+  CountingStore alignedCounter(aligned);
+  CountingStore unalignedCounter(unaligned);
+  const GeometryContext alignedContext(AlignmentContext{&alignedCounter});
+  const GeometryContext unalignedContext(AlignmentContext{&unalignedCounter});
+
+  Aligned<PlaneElement> element(nominal, first.geometryId());
+  for (int i = 0; i < 3; ++i) {
+    BOOST_CHECK(element.localToGlobalTransform(alignedContext)
+                    .isApprox(shifted));
+    BOOST_CHECK(element.localToGlobalTransform(unalignedContext)
+                    .isApprox(nominal));
+  }
+  // The dense index is resolved once and cached on the element
+  BOOST_CHECK_EQUAL(
+      alignedCounter.nIndexLookups + unalignedCounter.nIndexLookups, 1u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace ActsTests
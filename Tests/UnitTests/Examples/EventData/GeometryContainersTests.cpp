@@ -0,0 +1,152 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/Geometry/TrackingGeometry.hpp"
+#include "ActsExamples/EventData/GeometryContainers.hpp"
+#include "ActsExamples/EventData/Index.hpp"
+#include "ActsExamples/EventData/IndexSourceLink.hpp"
+#include "ActsTests/CommonHelpers/CylindricalTrackingGeometry.hpp"
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+using namespace Acts;
+using namespace ActsExamples;
+
+namespace ActsTests {
+
+namespace {
+
+GeometryContext tgContext = GeometryContext::dangerouslyDefaultConstruct();
+
+std::shared_ptr<const TrackingGeometry> trackingGeometry() {
+  // The builder owns the detector elements and has to outlive the geometry
+  static CylindricalTrackingGeometry cGeometry(tgContext);
+  static std::shared_ptr<const TrackingGeometry> tGeometry = cGeometry();
+  return tGeometry;
+}
+
+/// Container with elements on three out of four sensitive surfaces of the
+/// first layer and one element outside of the dense surface index
+GeometryIdMultiset<IndexSourceLink> makeContainer(
+    const TrackingGeometry& geometry) {
+  const auto& surfaces = geometry.sensitiveSurfaces();
+  GeometryIdMultiset<IndexSourceLink> container;
+  Index index = 0;
+  for (std::size_t surface : {0u, 0u, 0u, 1u, 3u, 3u}) {
+    container.emplace_hint(container.end(), surfaces.at(surface)->geometryId(),
+                           index++);
+  }
+  container.emplace_hint(container.end(),
+                         GeometryIdentifier().withVolume(250).withLayer(2),
+                         index++);
+  return container;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(EventDataSuite)
+
+BOOST_AUTO_TEST_CASE(GeometryContainersBucketBySurfaceIndex) {
+  const auto geometry = trackingGeometry();
+  const auto container = makeContainer(*geometry);
+
+  std::vector<std::size_t> occupied;
+  std::vector<Range<GeometryIdMultiset<IndexSourceLink>::const_iterator>>
+      buckets;
+  bucketBySurfaceIndex(container, *geometry, occupied, buckets);
+
+  // One bucket per sensitive surface, only the occupied ones are listed and
+  // the element outside of the index is not contained in any bucket
+  BOOST_REQUIRE_EQUAL(buckets.size(), geometry->numSensitiveSurfaces());
+  const std::vector<std::size_t> expectedOccupied = {0, 1, 3};
+  BOOST_CHECK_EQUAL_COLLECTIONS(occupied.begin(), occupied.end(),
+                                expectedOccupied.begin(),
+                                expectedOccupied.end());
+  const std::vector<std::size_t> expectedSizes = {3, 1, 0, 2};
+  std::size_t nBucketed = 0;
+  for (std::size_t i = 0; i < buckets.size(); ++i) {
+    const std::size_t expected =
+        i < expectedSizes.size() ? expectedSizes[i] : 0u;
+    BOOST_CHECK_EQUAL(buckets[i].size(), expected);
+    for (const IndexSourceLink& sourceLink : buckets[i]) {
+      BOOST_CHECK_EQUAL(sourceLink.geometryId(),
+                        geometry->surfaceByIndex(i)->geometryId());
+    }
+    nBucketed += buckets[i].size();
+  }
+  BOOST_CHECK_EQUAL(nBucketed, container.size() - 1);
+
+  // Reusing the vectors resets the previously occupied buckets
+  bucketBySurfaceIndex(GeometryIdMultiset<IndexSourceLink>(), *geometry,
+                       occupied, buckets);
+  BOOST_CHECK(occupied.empty());
+  BOOST_CHECK_EQUAL(buckets.size(), geometry->numSensitiveSurfaces());
+  for (const auto& bucket : buckets) {
+    BOOST_CHECK(bucket.empty());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(GeometryContainersAccessorRangeOf) {
+  const auto geometry = trackingGeometry();
+  const auto& surfaces = geometry->sensitiveSurfaces();
+  auto container = makeContainer(*geometry);
+
+  GeometryIdMultisetAccessor<IndexSourceLink> accessor;
+  accessor.container = &container;
+  GeometryIdMultisetAccessor<IndexSourceLink> bucketed;
+  bucketed.container = &container;
+  bucketed.bucketBySurfaceIndex(*geometry);
+
+  // The bucketed lookup is identical to the binary search over all elements,
+  // including empty surfaces and identifiers outside of the index
+  auto checkRanges = [&]() {
+    std::vector<GeometryIdentifier> geoIds = {
+        GeometryIdentifier().withVolume(250).withLayer(2),
+        GeometryIdentifier().withVolume(250).withLayer(4)};
+    for (std::size_t surface = 0; surface < 5; ++surface) {
+      geoIds.push_back(surfaces.at(surface)->geometryId());
+    }
+    for (GeometryIdentifier geoId : geoIds) {
+      auto [begin, end] = container.equal_range(geoId);
+      const auto range = accessor.rangeOf(geoId);
+      const auto bucketedRange = bucketed.rangeOf(geoId);
+      BOOST_CHECK_EQUAL(range.size(),
+                        static_cast<std::size_t>(std::distance(begin, end)));
+      BOOST_CHECK_EQUAL(bucketedRange.size(), range.size());
+      if (!range.empty()) {
+        BOOST_CHECK(range.begin() == begin);
+        BOOST_CHECK(bucketedRange.begin() == begin);
+        BOOST_CHECK(bucketedRange.end() == end);
+      }
+    }
+  };
+  checkRanges();
+
+  // Rebucketing a changed container only touches the occupied buckets
+  container.emplace(surfaces.at(2)->geometryId(), 100);
+  auto [begin, end] = container.equal_range(surfaces.at(1)->geometryId());
+  container.erase(begin, end);
+  bucketed.bucketBySurfaceIndex(*geometry);
+  const std::vector<std::size_t> expectedOccupied = {0, 2, 3};
+  BOOST_CHECK_EQUAL_COLLECTIONS(bucketed.occupied.begin(),
+                                bucketed.occupied.end(),
+                                expectedOccupied.begin(),
+                                expectedOccupied.end());
+  checkRanges();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace ActsTests
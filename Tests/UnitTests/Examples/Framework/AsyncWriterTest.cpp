@@ -0,0 +1,117 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Utilities/Logger.hpp"
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Framework/AsyncWriter.hpp"
+#include "ActsExamples/Framework/ProcessCode.hpp"
+#include "ActsExamples/Framework/WhiteBoard.hpp"
+#include "ActsExamples/Framework/WriterT.hpp"
+#include "ActsTests/CommonHelpers/WhiteBoardUtilities.hpp"
+
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace Acts;
+using namespace ActsExamples;
+
+namespace {
+
+/// Records the written values; fails for negative values
+class RecordingWriter final : public WriterT<int> {
+ public:
+  RecordingWriter() : WriterT<int>("value", "RecordingWriter", Logging::INFO) {}
+
+  ProcessCode finalize() override {
+    finalized = true;
+    return ProcessCode::SUCCESS;
+  }
+
+  std::vector<int> values;
+  std::vector<std::thread::id> threads;
+  bool finalized = false;
+
+ protected:
+  ProcessCode writeT(const AlgorithmContext& /*ctx*/,
+                     const int& value) override {
+    if (value < 0) {
+      throw std::runtime_error("Negative value");
+    }
+    values.push_back(value);
+    threads.push_back(std::this_thread::get_id());
+    return ProcessCode::SUCCESS;
+  }
+};
+
+}  // namespace
+
+namespace ActsTests {
+
+BOOST_AUTO_TEST_SUITE(FrameworkSuite)
+
+BOOST_AUTO_TEST_CASE(AsyncWriterWritesAllEvents) {
+  auto downstream = std::make_shared<RecordingWriter>();
+  AsyncWriter::Config cfg;
+  cfg.downstreamWriter = downstream;
+  cfg.queueSize = 2;
+  AsyncWriter writer(cfg, Logging::INFO);
+
+  BOOST_CHECK_EQUAL(writer.name(), "AsyncRecordingWriter");
+  BOOST_CHECK_EQUAL(writer.readHandles().size(), 1);
+
+  BOOST_CHECK(writer.initialize() == ProcessCode::SUCCESS);
+  for (int i = 0; i < 10; ++i) {
+    // the event store goes out of scope before the event is written
+    WhiteBoard wb;
+    addToWhiteBoard("value", i, wb);
+    AlgorithmContext ctx(0, i, wb, 0);
+    BOOST_CHECK(writer.write(ctx) == ProcessCode::SUCCESS);
+  }
+  BOOST_CHECK(writer.finalize() == ProcessCode::SUCCESS);
+
+  BOOST_CHECK(downstream->finalized);
+  const std::vector<int> expected = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  BOOST_CHECK_EQUAL_COLLECTIONS(downstream->values.begin(),
+                                downstream->values.end(), expected.begin(),
+                                expected.end());
+  for (const auto& id : downstream->threads) {
+    BOOST_CHECK(id != std::this_thread::get_id());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(AsyncWriterPropagatesErrors) {
+  auto downstream = std::make_shared<RecordingWriter>();
+  AsyncWriter::Config cfg;
+  cfg.downstreamWriter = downstream;
+  AsyncWriter writer(cfg, Logging::INFO);
+
+  BOOST_CHECK(writer.initialize() == ProcessCode::SUCCESS);
+  WhiteBoard wb;
+  addToWhiteBoard("value", -1, wb);
+  AlgorithmContext ctx(0, 0, wb, 0);
+  BOOST_CHECK(writer.write(ctx) == ProcessCode::SUCCESS);
+  BOOST_CHECK_THROW(writer.finalize(), std::runtime_error);
+  BOOST_CHECK(!downstream->finalized);
+}
+
+BOOST_AUTO_TEST_CASE(AsyncWriterInvalidConfig) {
+  AsyncWriter::Config cfg;
+  BOOST_CHECK_THROW(AsyncWriter(cfg, Logging::INFO), std::invalid_argument);
+
+  cfg.downstreamWriter = std::make_shared<RecordingWriter>();
+  cfg.queueSize = 0;
+  BOOST_CHECK_THROW(AsyncWriter(cfg, Logging::INFO), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace ActsTests
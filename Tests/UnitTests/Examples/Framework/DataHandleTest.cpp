@@ -232,6 +232,73 @@ BOOST_AUTO_TEST_CASE(WhiteBoardCopy) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(WhiteBoardSlots) {
+  DummySequenceElement dummyElement;
+  WhiteBoard::AliasMapType aliases;
+  aliases.insert({"slot_key", "slot_alias"});
+  auto table = WhiteBoard::SlotTable::make({"slot_key", "other_key"}, aliases);
+  BOOST_CHECK_EQUAL(table->size(), 3u);
+  BOOST_CHECK(table->find("slot_alias").has_value());
+  BOOST_CHECK(!table->find("unknown_key").has_value());
+
+  WhiteBoard wb(getDefaultLogger("WhiteBoard", Logging::INFO), aliases,
+                table);
+
+  WriteDataHandle<int> writeHandle(&dummyElement, "test");
+  writeHandle.initialize("slot_key");
+  writeHandle.resolveSlot(*table);
+  ReadDataHandle<int> readHandle(&dummyElement, "test");
+  readHandle.initialize("slot_alias");
+  readHandle.resolveSlot(*table);
+  ConsumeDataHandle<int> consumeHandle(&dummyElement, "test");
+  consumeHandle.initialize("slot_key");
+  consumeHandle.resolveSlot(*table);
+
+  BOOST_TEST_CHECKPOINT("Test slot access through handles and by name");
+  {
+    writeHandle(wb, 42);
+    BOOST_CHECK_THROW(writeHandle(wb, 43), std::invalid_argument);
+    BOOST_CHECK_EQUAL(readHandle(wb), 42);
+    BOOST_CHECK(wb.exists("slot_key"));
+    BOOST_CHECK(!wb.exists("other_key"));
+    BOOST_CHECK_EQUAL(wb.getKeys().size(), 2u);
+
+    ReadDataHandle<float> wrongType(&dummyElement, "test");
+    wrongType.initialize("slot_key");
+    wrongType.resolveSlot(*table);
+    BOOST_CHECK_THROW(wrongType(wb), std::out_of_range);
+
+    BOOST_CHECK_EQUAL(consumeHandle(wb), 42);
+    BOOST_CHECK(!wb.exists("slot_key"));
+    BOOST_CHECK_THROW(consumeHandle(wb), std::out_of_range);
+  }
+
+  BOOST_TEST_CHECKPOINT(
+      "Test keys without slot and resolved handles elsewhere");
+  {
+    WriteDataHandle<int> mapHandle(&dummyElement, "test");
+    mapHandle.initialize("map_key");
+    mapHandle.resolveSlot(*table);
+    mapHandle(wb, 7);
+    BOOST_CHECK(wb.exists("map_key"));
+
+    // a white board without slots falls back to the key
+    WhiteBoard plain;
+    writeHandle(plain, 1);
+    BOOST_CHECK(plain.exists("slot_key"));
+    wb.copyFrom(plain);
+    BOOST_CHECK_EQUAL(readHandle(wb), 1);
+  }
+
+  BOOST_TEST_CHECKPOINT("Test clearing for reuse");
+  {
+    wb.clear();
+    BOOST_CHECK(wb.getKeys().empty());
+    writeHandle(wb, 5);
+    BOOST_CHECK_EQUAL(readHandle(wb), 5);
+  }
+}
+
 BOOST_AUTO_TEST_CASE(EmulateStateConsistency) {
   DummySequenceElement dummyElement;
   DataHandleBase::StateMapType state;
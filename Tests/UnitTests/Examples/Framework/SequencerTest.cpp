@@ -0,0 +1,225 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Utilities/Logger.hpp"
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Framework/DataHandle.hpp"
+#include "ActsExamples/Framework/IAlgorithm.hpp"
+#include "ActsExamples/Framework/ProcessCode.hpp"
+#include "ActsExamples/Framework/Sequencer.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <tbb/parallel_for.h>
+
+using namespace Acts;
+using namespace ActsExamples;
+
+namespace {
+
+/// Writes the sum of all inputs plus one, or the event number without inputs
+class SumAlgorithm final : public IAlgorithm {
+ public:
+  SumAlgorithm(const std::string& name, const std::vector<std::string>& inputs,
+               const std::string& output)
+      : IAlgorithm(name) {
+    for (const auto& input : inputs) {
+      m_inputs.push_back(
+          std::make_unique<ReadDataHandle<int>>(this, "Input" + input));
+      m_inputs.back()->initialize(input);
+    }
+    m_output.initialize(output);
+  }
+
+  ProcessCode execute(const AlgorithmContext& ctx) const override {
+    int sum = static_cast<int>(ctx.eventNumber);
+    if (!m_inputs.empty()) {
+      sum = 1;
+      for (const auto& input : m_inputs) {
+        sum += (*input)(ctx);
+      }
+    }
+    m_output(ctx, std::move(sum));
+    return ProcessCode::SUCCESS;
+  }
+
+ private:
+  std::vector<std::unique_ptr<ReadDataHandle<int>>> m_inputs;
+  WriteDataHandle<int> m_output{this, "Output"};
+};
+
+/// Takes an object off the white board and accumulates it
+class ConsumeAlgorithm final : public IAlgorithm {
+ public:
+  ConsumeAlgorithm(const std::string& name, const std::string& input,
+                   std::atomic<int>& total)
+      : IAlgorithm(name), m_total(&total) {
+    m_input.initialize(input);
+  }
+
+  ProcessCode execute(const AlgorithmContext& ctx) const override {
+    *m_total += m_input(ctx);
+    return ProcessCode::SUCCESS;
+  }
+
+ private:
+  std::atomic<int>* m_total;
+  ConsumeDataHandle<int> m_input{this, "Input"};
+};
+
+/// Reads its input around nested parallel work, during which the thread can
+/// pick up other events
+class NestedAlgorithm final : public IAlgorithm {
+ public:
+  NestedAlgorithm(const std::string& name, const std::string& input,
+                  std::atomic<int>& nMismatches)
+      : IAlgorithm(name), m_nMismatches(&nMismatches) {
+    m_input.initialize(input);
+  }
+
+  ProcessCode execute(const AlgorithmContext& ctx) const override {
+    const int before = m_input(ctx);
+    tbb::parallel_for(0, 64, [](int) {
+      volatile double x = 0;
+      for (int i = 0; i < 1000; ++i) {
+        x = x + i;
+      }
+    });
+    if (m_input(ctx) != before ||
+        before != static_cast<int>(ctx.eventNumber)) {
+      ++*m_nMismatches;
+    }
+    return ProcessCode::SUCCESS;
+  }
+
+ private:
+  std::atomic<int>* m_nMismatches;
+  ReadDataHandle<int> m_input{this, "Input"};
+};
+
+int runSequence(Sequencer::Config cfg) {
+  cfg.events = 10;
+  cfg.trackFpes = false;
+  Sequencer sequencer(cfg);
+
+  std::atomic<int> total = 0;
+  // a -> (b, c) -> d; c is consumed only after d has read it
+  sequencer.addAlgorithm(
+      std::make_shared<SumAlgorithm>("A", std::vector<std::string>{}, "a"));
+  sequencer.addAlgorithm(std::make_shared<SumAlgorithm>(
+      "B", std::vector<std::string>{"a"}, "b"));
+  sequencer.addAlgorithm(std::make_shared<SumAlgorithm>(
+      "C", std::vector<std::string>{"a"}, "c"));
+  sequencer.addAlgorithm(std::make_shared<SumAlgorithm>(
+      "D", std::vector<std::string>{"b", "c"}, "d"));
+  sequencer.addAlgorithm(std::make_shared<ConsumeAlgorithm>("E", "c", total));
+  sequencer.addAlgorithm(std::make_shared<ConsumeAlgorithm>("F", "d", total));
+
+  BOOST_CHECK_EQUAL(sequencer.run(), EXIT_SUCCESS);
+  return total;
+}
+
+}  // namespace
+
+namespace ActsTests {
+
+BOOST_AUTO_TEST_SUITE(FrameworkSuite)
+
+// per event: c = a + 1, d = 2a + 3
+constexpr int kExpectedTotal = 45 + 10 + 90 + 30;
+
+BOOST_AUTO_TEST_CASE(SequencerDataFlowScheduling) {
+  Sequencer::Config cfg;
+  cfg.numThreads = 1;
+  BOOST_CHECK_EQUAL(runSequence(cfg), kExpectedTotal);
+
+  cfg.dataFlowScheduling = true;
+  BOOST_CHECK_EQUAL(runSequence(cfg), kExpectedTotal);
+  cfg.numThreads = 4;
+  BOOST_CHECK_EQUAL(runSequence(cfg), kExpectedTotal);
+}
+
+BOOST_AUTO_TEST_CASE(SequencerPipeline) {
+  Sequencer::Config cfg;
+  cfg.numThreads = 4;
+  cfg.maxInFlightEvents = 2;
+  BOOST_CHECK_EQUAL(runSequence(cfg), kExpectedTotal);
+
+  cfg.algorithmStageMode = Sequencer::StageMode::SerialOutOfOrder;
+  BOOST_CHECK_EQUAL(runSequence(cfg), kExpectedTotal);
+}
+
+BOOST_AUTO_TEST_CASE(SequencerWhiteBoardSlots) {
+  Sequencer::Config cfg;
+  cfg.whiteBoardSlots = true;
+  cfg.numThreads = 1;
+  BOOST_CHECK_EQUAL(runSequence(cfg), kExpectedTotal);
+
+  cfg.numThreads = 4;
+  cfg.dataFlowScheduling = true;
+  BOOST_CHECK_EQUAL(runSequence(cfg), kExpectedTotal);
+
+  cfg.dataFlowScheduling = false;
+  cfg.maxInFlightEvents = 2;
+  BOOST_CHECK_EQUAL(runSequence(cfg), kExpectedTotal);
+}
+
+BOOST_AUTO_TEST_CASE(SequencerDataFlowAliases) {
+  for (std::size_t numThreads : {1, 4}) {
+    Sequencer::Config cfg;
+    cfg.numThreads = numThreads;
+    cfg.dataFlowScheduling = true;
+    cfg.events = 10;
+    cfg.trackFpes = false;
+    Sequencer sequencer(cfg);
+
+    std::atomic<int> total = 0;
+    // consuming the alias removes a, so it has to wait for B reading a
+    sequencer.addAlgorithm(
+        std::make_shared<SumAlgorithm>("A", std::vector<std::string>{}, "a"));
+    sequencer.addWhiteboardAlias("aliasA", "a");
+    sequencer.addAlgorithm(std::make_shared<SumAlgorithm>(
+        "B", std::vector<std::string>{"a"}, "b"));
+    sequencer.addAlgorithm(
+        std::make_shared<ConsumeAlgorithm>("C", "aliasA", total));
+    sequencer.addAlgorithm(std::make_shared<ConsumeAlgorithm>("D", "b", total));
+
+    BOOST_CHECK_EQUAL(sequencer.run(), EXIT_SUCCESS);
+    // per event: a = n, b = n + 1
+    BOOST_CHECK_EQUAL(total, 45 + 55);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(SequencerWhiteBoardSlotsNested) {
+  Sequencer::Config cfg;
+  cfg.whiteBoardSlots = true;
+  cfg.numThreads = 4;
+  cfg.events = 200;
+  cfg.trackFpes = false;
+  Sequencer sequencer(cfg);
+
+  std::atomic<int> nMismatches = 0;
+  sequencer.addAlgorithm(
+      std::make_shared<SumAlgorithm>("A", std::vector<std::string>{}, "a"));
+  sequencer.addAlgorithm(
+      std::make_shared<NestedAlgorithm>("B", "a", nMismatches));
+
+  BOOST_CHECK_EQUAL(sequencer.run(), EXIT_SUCCESS);
+  BOOST_CHECK_EQUAL(nMismatches, 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace ActsTests
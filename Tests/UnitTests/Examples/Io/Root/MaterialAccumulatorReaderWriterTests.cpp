@@ -0,0 +1,138 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/Material/AccumulatedMaterialSlab.hpp"
+#include "Acts/Material/AccumulatedSurfaceMaterial.hpp"
+#include "Acts/Material/BinnedSurfaceMaterialAccumulator.hpp"
+#include "Acts/Material/MaterialSlab.hpp"
+#include "Acts/Utilities/BinUtility.hpp"
+#include "Acts/Utilities/BinningType.hpp"
+#include "ActsExamples/Io/Root/RootMaterialAccumulatorReader.hpp"
+#include "ActsExamples/Io/Root/RootMaterialAccumulatorWriter.hpp"
+#include "ActsTests/CommonHelpers/FloatComparisons.hpp"
+#include "ActsTests/CommonHelpers/PredefinedMaterials.hpp"
+
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+
+using namespace Acts;
+using namespace ActsExamples;
+
+namespace ActsTests {
+
+namespace {
+
+const GeometryIdentifier surfaceA =
+    GeometryIdentifier().withVolume(1).withLayer(2).withSensitive(3);
+const GeometryIdentifier surfaceB =
+    GeometryIdentifier().withVolume(4).withLayer(2);
+
+/// State with an empty 2D binned surface and an empty homogeneous surface
+BinnedSurfaceMaterialAccumulator::State makeState() {
+  BinUtility binUtility(4, -2., 2., open, AxisDirection::AxisX);
+  binUtility += BinUtility(3, -3., 3., open, AxisDirection::AxisY);
+
+  BinnedSurfaceMaterialAccumulator::State state;
+  state.accumulatedMaterial.emplace(surfaceA,
+                                    AccumulatedSurfaceMaterial(binUtility));
+  state.accumulatedMaterial.emplace(surfaceB, AccumulatedSurfaceMaterial());
+  return state;
+}
+
+void checkEqual(const BinnedSurfaceMaterialAccumulator::State& expected,
+                const BinnedSurfaceMaterialAccumulator::State& actual) {
+  BOOST_REQUIRE_EQUAL(actual.accumulatedMaterial.size(),
+                      expected.accumulatedMaterial.size());
+  for (const auto& [geoId, accMaterial] : expected.accumulatedMaterial) {
+    const auto& expectedMatrix = accMaterial.accumulatedMaterial();
+    const auto& actualMatrix =
+        actual.accumulatedMaterial.at(geoId).accumulatedMaterial();
+    BOOST_REQUIRE_EQUAL(actualMatrix.size(), expectedMatrix.size());
+    for (std::size_t ib1 = 0; ib1 < expectedMatrix.size(); ++ib1) {
+      BOOST_REQUIRE_EQUAL(actualMatrix[ib1].size(),
+                          expectedMatrix[ib1].size());
+      for (std::size_t ib0 = 0; ib0 < expectedMatrix[ib1].size(); ++ib0) {
+        auto [expectedSlab, expectedCount] =
+            expectedMatrix[ib1][ib0].totalAverage();
+        auto [actualSlab, actualCount] = actualMatrix[ib1][ib0].totalAverage();
+        BOOST_CHECK_EQUAL(actualCount, expectedCount);
+        if (expectedCount == 0u) {
+          continue;
+        }
+        CHECK_CLOSE_REL(actualSlab.thickness(), expectedSlab.thickness(),
+                        1e-6);
+        CHECK_CLOSE_REL(actualSlab.material().X0(),
+                        expectedSlab.material().X0(), 1e-6);
+        CHECK_CLOSE_REL(actualSlab.material().massDensity(),
+                        expectedSlab.material().massDensity(), 1e-6);
+        CHECK_CLOSE_REL(actualMatrix[ib1][ib0].totalVariance().first,
+                        expectedMatrix[ib1][ib0].totalVariance().first, 1e-6);
+      }
+    }
+  }
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(RootSuite)
+
+BOOST_AUTO_TEST_CASE(RootMaterialAccumulatorRoundTrip) {
+  const MaterialSlab silicon(makeSilicon(), 0.5);
+  const MaterialSlab beryllium(makeBeryllium(), 1.2);
+
+  // Partial results of two mapping jobs
+  auto state1 = makeState();
+  state1.accumulatedMaterial.at(surfaceA).merge(
+      0, 0, AccumulatedMaterialSlab::fromTotals(silicon, 0.1f, 5));
+  state1.accumulatedMaterial.at(surfaceA).merge(
+      3, 2, AccumulatedMaterialSlab::fromTotals(beryllium, 0.2f, 2));
+  auto state2 = makeState();
+  state2.accumulatedMaterial.at(surfaceA).merge(
+      0, 0, AccumulatedMaterialSlab::fromTotals(beryllium, 0.3f, 3));
+  state2.accumulatedMaterial.at(surfaceB).merge(
+      0, 0, AccumulatedMaterialSlab::fromTotals(silicon, 0.4f, 7));
+
+  for (const auto& [state, filePath] :
+       {std::pair{&state1, "./material-accumulator-1.root"},
+        std::pair{&state2, "./material-accumulator-2.root"}}) {
+    RootMaterialAccumulatorWriter::Config writerConfig;
+    writerConfig.filePath = filePath;
+    RootMaterialAccumulatorWriter writer(writerConfig, Logging::WARNING);
+    writer.writeAccumulator(*state);
+  }
+
+  // Reading both files merges them as the states would be merged in memory
+  RootMaterialAccumulatorReader::Config readerConfig;
+  readerConfig.fileList = {"./material-accumulator-1.root",
+                           "./material-accumulator-2.root"};
+  RootMaterialAccumulatorReader reader(readerConfig, Logging::WARNING);
+
+  auto read = makeState();
+  reader.readAccumulator(read);
+
+  auto expected = makeState();
+  for (const auto* state : {&state1, &state2}) {
+    for (const auto& [geoId, accMaterial] : state->accumulatedMaterial) {
+      expected.accumulatedMaterial.at(geoId).merge(accMaterial);
+    }
+  }
+  checkEqual(expected, read);
+
+  // The states have to be created with the same surfaces and binning
+  BinnedSurfaceMaterialAccumulator::State unknown;
+  unknown.accumulatedMaterial.emplace(surfaceA, AccumulatedSurfaceMaterial());
+  BOOST_CHECK_THROW(reader.readAccumulator(unknown), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace ActsTests
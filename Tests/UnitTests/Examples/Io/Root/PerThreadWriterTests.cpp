@@ -0,0 +1,123 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "ActsExamples/EventData/SimHit.hpp"
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Framework/WhiteBoard.hpp"
+#include "ActsExamples/Io/Root/RootPerThreadWriter.hpp"
+#include "ActsExamples/Io/Root/RootSimHitReader.hpp"
+#include "ActsExamples/Io/Root/RootSimHitWriter.hpp"
+#include "ActsTests/CommonHelpers/WhiteBoardUtilities.hpp"
+
+#include <filesystem>
+#include <memory>
+#include <stdexcept>
+
+using namespace Acts;
+using namespace ActsExamples;
+
+namespace {
+
+SimHitContainer makeSimHits(std::size_t nHits, std::size_t event) {
+  SimHitContainer hits;
+  for (std::size_t i = 0; i < nHits; ++i) {
+    GeometryIdentifier geoId = GeometryIdentifier().withVolume(event + 1);
+    geoId = geoId.withSensitive(i + 1);
+    Vector4 pos4 = Vector4::Random();
+    Vector4 mom4 = Vector4::Random();
+    hits.insert(SimHit(geoId, SimBarcode().withParticle(i + 1), pos4, mom4,
+                       mom4, static_cast<std::int32_t>(i)));
+  }
+  return hits;
+}
+
+}  // namespace
+
+namespace ActsTests {
+
+BOOST_AUTO_TEST_SUITE(RootSuite)
+
+BOOST_AUTO_TEST_CASE(PerThreadWriterMergesInEventOrder) {
+  RootPerThreadWriter::Config cfg;
+  cfg.filePath = "./perthreadhits.root";
+  cfg.treeName = "hits";
+  cfg.eventNumberBranch = "event_id";
+  cfg.writerFactory = [](const std::string& path) {
+    RootSimHitWriter::Config writerCfg;
+    writerCfg.inputSimHits = "hits";
+    writerCfg.filePath = path;
+    return std::make_shared<RootSimHitWriter>(writerCfg, Logging::WARNING);
+  };
+
+  RootPerThreadWriter writer(cfg, Logging::WARNING);
+  BOOST_CHECK_EQUAL(writer.name(), "PerThreadRootSimHitWriter");
+  BOOST_CHECK_EQUAL(writer.threadFilePath(1), "./perthreadhits_thread1.root");
+  BOOST_CHECK(writer.initialize() == ProcessCode::SUCCESS);
+
+  // events arrive out of order, also within one thread, and are distributed
+  // over two threads
+  for (std::size_t event : {1, 2, 3, 0}) {
+    WhiteBoard board;
+    addToWhiteBoard("hits", makeSimHits(event + 1, event), board);
+    AlgorithmContext ctx(0, event, board, event % 2);
+    BOOST_CHECK(writer.beginEvent(ctx.threadId) == ProcessCode::SUCCESS);
+    BOOST_CHECK(writer.write(ctx) == ProcessCode::SUCCESS);
+  }
+  BOOST_CHECK(writer.finalize() == ProcessCode::SUCCESS);
+
+  BOOST_CHECK(std::filesystem::exists(cfg.filePath));
+  BOOST_CHECK(!std::filesystem::exists(writer.threadFilePath(0)));
+  BOOST_CHECK(!std::filesystem::exists(writer.threadFilePath(1)));
+
+  RootSimHitReader::Config readerCfg;
+  readerCfg.outputSimHits = "hits";
+  readerCfg.filePath = cfg.filePath;
+  RootSimHitReader reader(readerCfg, Logging::WARNING);
+  BOOST_CHECK_EQUAL(reader.availableEvents().first, 0);
+  BOOST_CHECK_EQUAL(reader.availableEvents().second, 4);
+
+  for (std::size_t event = 0; event < 4; ++event) {
+    WhiteBoard board;
+    AlgorithmContext ctx(0, event, board, 0);
+    BOOST_CHECK(reader.read(ctx) == ProcessCode::SUCCESS);
+    const auto hits = getFromWhiteBoard<SimHitContainer>("hits", board);
+    BOOST_CHECK_EQUAL(hits.size(), event + 1);
+    for (const auto& hit : hits) {
+      BOOST_CHECK_EQUAL(hit.geometryId().volume(), event + 1);
+    }
+  }
+  reader.finalize();
+}
+
+BOOST_AUTO_TEST_CASE(PerThreadWriterRequiresEventNumberBranch) {
+  RootPerThreadWriter::Config cfg;
+  cfg.filePath = "./perthreadhits_invalid.root";
+  cfg.treeName = "hits";
+  cfg.eventNumberBranch = "missing";
+  cfg.writerFactory = [](const std::string& path) {
+    RootSimHitWriter::Config writerCfg;
+    writerCfg.inputSimHits = "hits";
+    writerCfg.filePath = path;
+    return std::make_shared<RootSimHitWriter>(writerCfg, Logging::WARNING);
+  };
+
+  RootPerThreadWriter writer(cfg, Logging::WARNING);
+  BOOST_CHECK(writer.initialize() == ProcessCode::SUCCESS);
+
+  WhiteBoard board;
+  addToWhiteBoard("hits", makeSimHits(2, 0), board);
+  AlgorithmContext ctx(0, 0, board, 0);
+  BOOST_CHECK(writer.write(ctx) == ProcessCode::SUCCESS);
+  BOOST_CHECK_THROW(writer.finalize(), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace ActsTests
@@ -0,0 +1,203 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "ActsPlugins/Gnn/ModuleMapCpu.hpp"
+
+#include <cmath>
+#include <set>
+#include <utility>
+
+#include <tbb/task_arena.h>
+
+using namespace Acts;
+using namespace ActsPlugins;
+
+namespace {
+
+ModuleMapCpu::DoubletCuts wideCuts() {
+  ModuleMapCpu::DoubletCuts cuts;
+  cuts.z0Min = -100.f;
+  cuts.z0Max = 100.f;
+  cuts.dEtaMin = -0.1f;
+  cuts.dEtaMax = 0.1f;
+  cuts.phiSlopeMin = -0.01f;
+  cuts.phiSlopeMax = 0.01f;
+  cuts.dPhiMin = -0.1f;
+  cuts.dPhiMax = 0.1f;
+  return cuts;
+}
+
+/// Three barrel layers with one module each, connected by one triplet
+std::shared_ptr<const ModuleMapCpu::ModuleMap> makeModuleMap() {
+  auto map = std::make_shared<ModuleMapCpu::ModuleMap>();
+  map->doublets.push_back({1, 2, wideCuts()});
+  map->doublets.push_back({2, 3, wideCuts()});
+
+  ModuleMapCpu::ModuleTriplet triplet;
+  triplet.module1 = 1;
+  triplet.module2 = 2;
+  triplet.module3 = 3;
+  triplet.cuts12 = wideCuts();
+  triplet.cuts23 = wideCuts();
+  triplet.diffDyDxMin = -0.05f;
+  triplet.diffDyDxMax = 0.05f;
+  triplet.diffDzDrMin = -0.05f;
+  triplet.diffDzDrMax = 0.05f;
+  map->triplets.push_back(triplet);
+  return map;
+}
+
+/// Hits as (r, phi, z, eta) features
+struct Hits {
+  std::vector<float> features;
+  std::vector<std::uint64_t> moduleIds;
+
+  void add(std::uint64_t module, float r, float phi, float z) {
+    const float theta = std::atan2(r, z);
+    const float eta = -std::log(std::tan(0.5f * theta));
+    features.insert(features.end(), {r, phi, z, eta});
+    moduleIds.push_back(module);
+  }
+};
+
+/// Straight tracks from the origin, plus hits which do not form triplets
+Hits makeHits() {
+  Hits hits;
+  const std::vector<float> radii = {30.f, 70.f, 120.f};
+  for (float phi : {0.1f, 1.5f, -2.f}) {
+    for (std::size_t l = 0; l < radii.size(); ++l) {
+      hits.add(l + 1, radii[l], phi, 0.5f * radii[l]);
+    }
+  }
+  // compatible in the inner doublet, but kinked in z for the outer one
+  hits.add(3, 120.f, 0.1f, 90.f);
+  // on a module that is not part of the map
+  hits.add(42, 50.f, 0.1f, 25.f);
+  // far away from everything
+  hits.add(2, 70.f, 3.f, -100.f);
+  return hits;
+}
+
+std::set<std::pair<std::int64_t, std::int64_t>> runGraph(Hits hits,
+                                                         std::size_t nThreads) {
+  ModuleMapCpu::Config cfg;
+  cfg.moduleMap = makeModuleMap();
+  ModuleMapCpu graphConstructor(cfg, getDefaultLogger("Test", Logging::INFO));
+
+  const std::size_t nNodes = hits.moduleIds.size();
+  tbb::task_arena arena(static_cast<int>(nThreads));
+  auto tensors = arena.execute([&]() {
+    return graphConstructor(hits.features, nNodes, hits.moduleIds, {});
+  });
+
+  BOOST_CHECK_EQUAL(tensors.nodeFeatures.shape()[0], nNodes);
+  BOOST_CHECK_EQUAL(tensors.nodeFeatures.shape()[1], 4ul);
+  BOOST_REQUIRE(tensors.edgeFeatures.has_value());
+  BOOST_CHECK_EQUAL(tensors.edgeFeatures->shape()[1], 6ul);
+
+  const std::size_t nEdges = tensors.edgeIndex.shape()[1];
+  BOOST_CHECK_EQUAL(tensors.edgeFeatures->shape()[0], nEdges);
+
+  std::set<std::pair<std::int64_t, std::int64_t>> edges;
+  for (std::size_t e = 0; e < nEdges; ++e) {
+    edges.emplace(tensors.edgeIndex.data()[e],
+                  tensors.edgeIndex.data()[nEdges + e]);
+  }
+  BOOST_CHECK_EQUAL(edges.size(), nEdges);
+  return edges;
+}
+
+}  // namespace
+
+namespace ActsTests {
+
+BOOST_AUTO_TEST_SUITE(GnnSuite)
+
+BOOST_AUTO_TEST_CASE(module_map_cpu_straight_tracks) {
+  const auto edges = runGraph(makeHits(), 1);
+
+  const std::set<std::pair<std::int64_t, std::int64_t>> expected = {
+      {0, 1}, {1, 2}, {3, 4}, {4, 5}, {6, 7}, {7, 8}};
+  BOOST_CHECK(edges == expected);
+}
+
+BOOST_AUTO_TEST_CASE(module_map_cpu_threads) {
+  Hits hits;
+  // many hits per module, so that the work is split into several parts
+  for (int i = 0; i < 200; ++i) {
+    const float phi = -3.f + 0.03f * i;
+    const float slope = 0.2f + 0.005f * (i % 7);
+    hits.add(1, 30.f, phi, slope * 30.f);
+    hits.add(2, 70.f, phi + 0.001f * (i % 3), slope * 70.f);
+    hits.add(3, 120.f, phi - 0.002f * (i % 5), slope * 120.f);
+  }
+
+  const auto reference = runGraph(hits, 1);
+  BOOST_CHECK(!reference.empty());
+  BOOST_CHECK(runGraph(hits, 4) == reference);
+}
+
+BOOST_AUTO_TEST_CASE(module_map_cpu_edge_features) {
+  ModuleMapCpu::Config cfg;
+  cfg.moduleMap = makeModuleMap();
+  ModuleMapCpu graphConstructor(cfg, getDefaultLogger("Test", Logging::INFO));
+
+  Hits hits;
+  hits.add(1, 30.f, 0.100f, 15.f);
+  hits.add(2, 70.f, 0.101f, 35.f);
+  hits.add(3, 120.f, 0.102f, 60.f);
+  auto tensors = graphConstructor(hits.features, 3, hits.moduleIds, {});
+
+  const std::size_t nEdges = tensors.edgeIndex.shape()[1];
+  BOOST_REQUIRE_EQUAL(nEdges, 2ul);
+  const std::size_t e01 = tensors.edgeIndex.data()[0] == 0 ? 0 : 1;
+  BOOST_REQUIRE_EQUAL(tensors.edgeIndex.data()[e01], 0);
+  BOOST_REQUIRE_EQUAL(tensors.edgeIndex.data()[nEdges + e01], 1);
+
+  // Definitions of detail::makeEdgeFeatures used by ModuleMapCuda
+  const float* features = tensors.edgeFeatures->data() + e01 * 6;
+  const float dr = 40.f;
+  const float dphi = 0.001f;
+  BOOST_CHECK_CLOSE(features[0], dr, 1e-4);
+  BOOST_CHECK_CLOSE(features[1], dphi, 1e-2);
+  BOOST_CHECK_CLOSE(features[2], 20.f, 1e-4);
+  BOOST_CHECK_SMALL(features[3], 1e-6f);
+  BOOST_CHECK_CLOSE(features[4], dphi / dr, 1e-2);
+  BOOST_CHECK_CLOSE(features[5], 0.5f * (30.f + 70.f) * dphi / dr, 1e-2);
+}
+
+BOOST_AUTO_TEST_CASE(module_map_cpu_no_edges) {
+  ModuleMapCpu::Config cfg;
+  cfg.moduleMap = makeModuleMap();
+  ModuleMapCpu graphConstructor(cfg, getDefaultLogger("Test", Logging::INFO));
+
+  Hits hits;
+  hits.add(1, 30.f, 0.1f, 15.f);
+  hits.add(2, 70.f, 2.f, 35.f);
+  BOOST_CHECK_THROW(graphConstructor(hits.features, 2, hits.moduleIds, {}),
+                    NoEdgesError);
+
+  std::vector<float> noFeatures;
+  BOOST_CHECK_THROW(graphConstructor(noFeatures, 0, {}, {}), NoEdgesError);
+}
+
+BOOST_AUTO_TEST_CASE(module_map_cpu_invalid_map) {
+  auto map = std::make_shared<ModuleMapCpu::ModuleMap>(*makeModuleMap());
+  map->doublets.pop_back();
+
+  ModuleMapCpu::Config cfg;
+  cfg.moduleMap = map;
+  BOOST_CHECK_THROW(ModuleMapCpu(cfg, getDefaultLogger("Test", Logging::INFO)),
+                    std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace ActsTests
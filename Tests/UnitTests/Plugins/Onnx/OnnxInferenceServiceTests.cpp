@@ -0,0 +1,213 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "ActsPlugins/Onnx/OnnxInferenceService.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace ActsPlugins;
+using namespace std::chrono_literals;
+
+namespace ActsTests {
+
+namespace {
+
+constexpr std::size_t kInputSize = 2;
+constexpr std::size_t kOutputSize = 2;
+
+/// Model returning the sum and the difference of the two inputs of every
+/// entry, which records the size of every batch
+struct SumModel {
+  std::mutex mutex;
+  std::vector<std::size_t> batchSizes;
+
+  OnnxInferenceService::InferenceFunction function() {
+    return [this](std::span<float> input, std::size_t batchSize,
+                  std::span<float> output) {
+      for (std::size_t i = 0; i < batchSize; ++i) {
+        output[i * kOutputSize] =
+            input[i * kInputSize] + input[i * kInputSize + 1];
+        output[i * kOutputSize + 1] =
+            input[i * kInputSize] - input[i * kInputSize + 1];
+      }
+      std::lock_guard lock(mutex);
+      batchSizes.push_back(batchSize);
+    };
+  }
+};
+
+/// Input with entries (offset + i, 1)
+NetworkBatchInput makeInput(std::size_t nEntries, float offset) {
+  NetworkBatchInput input(nEntries, kInputSize);
+  for (std::size_t i = 0; i < nEntries; ++i) {
+    input(i, 0) = offset + static_cast<float>(i);
+    input(i, 1) = 1.f;
+  }
+  return input;
+}
+
+void checkOutput(const std::vector<std::vector<float>>& output,
+                 std::size_t nEntries, float offset) {
+  BOOST_REQUIRE_EQUAL(output.size(), nEntries);
+  for (std::size_t i = 0; i < nEntries; ++i) {
+    BOOST_REQUIRE_EQUAL(output[i].size(), kOutputSize);
+    BOOST_CHECK_EQUAL(output[i][0], offset + static_cast<float>(i) + 1.f);
+    BOOST_CHECK_EQUAL(output[i][1], offset + static_cast<float>(i) - 1.f);
+  }
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(OnnxSuite)
+
+BOOST_AUTO_TEST_CASE(OnnxInferenceServiceBatchesConcurrentRequests) {
+  constexpr std::size_t nCallers = 4;
+  constexpr std::size_t nEntries = 3;
+
+  SumModel model;
+  // The batch is only complete with the requests of all callers, the latency
+  // is long enough to never be reached
+  OnnxInferenceService::Config cfg;
+  cfg.maxBatchSize = nCallers * nEntries;
+  cfg.maxLatency = 60s;
+  std::vector<std::vector<std::vector<float>>> outputs(nCallers);
+  {
+    OnnxInferenceService service(model.function(), kInputSize, kOutputSize,
+                                 cfg);
+
+    std::vector<std::thread> callers;
+    for (std::size_t c = 0; c < nCallers; ++c) {
+      callers.emplace_back([&, c]() {
+        const NetworkBatchInput input = makeInput(nEntries, 100.f * c);
+        outputs[c] = service.runONNXInference(input);
+      });
+    }
+    for (std::thread& caller : callers) {
+      caller.join();
+    }
+
+    const auto stats = service.statistics();
+    BOOST_CHECK_EQUAL(stats.nRequests, nCallers);
+    BOOST_CHECK_EQUAL(stats.nBatches, 1u);
+    BOOST_CHECK_EQUAL(stats.nEntries, nCallers * nEntries);
+  }
+
+  BOOST_REQUIRE_EQUAL(model.batchSizes.size(), 1u);
+  BOOST_CHECK_EQUAL(model.batchSizes.front(), nCallers * nEntries);
+  // Every caller receives the rows of its own entries
+  for (std::size_t c = 0; c < nCallers; ++c) {
+    checkOutput(outputs[c], nEntries, 100.f * c);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(OnnxInferenceServiceFlushesAtDeadline) {
+  SumModel model;
+  OnnxInferenceService::Config cfg;
+  cfg.maxBatchSize = 1000;
+  cfg.maxLatency = 50ms;
+  OnnxInferenceService service(model.function(), kInputSize, kOutputSize,
+                               cfg);
+
+  // A single small request never fills the batch and is run once the
+  // latency is exceeded
+  const auto start = std::chrono::steady_clock::now();
+  const auto output = service.runONNXInference(makeInput(2, 0.f));
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+
+  checkOutput(output, 2, 0.f);
+  BOOST_CHECK(elapsed >= cfg.maxLatency);
+  BOOST_CHECK_EQUAL(service.statistics().nBatches, 1u);
+}
+
+BOOST_AUTO_TEST_CASE(OnnxInferenceServiceOversizedRequest) {
+  SumModel model;
+  OnnxInferenceService::Config cfg;
+  cfg.maxBatchSize = 4;
+  cfg.maxLatency = 60s;
+  {
+    OnnxInferenceService service(model.function(), kInputSize, kOutputSize,
+                                 cfg);
+
+    // A request larger than the batch size is run as its own batch without
+    // waiting for the latency
+    const auto output = service.runONNXInference(makeInput(10, 5.f));
+    checkOutput(output, 10, 5.f);
+  }
+  BOOST_REQUIRE_EQUAL(model.batchSizes.size(), 1u);
+  BOOST_CHECK_EQUAL(model.batchSizes.front(), 10u);
+}
+
+BOOST_AUTO_TEST_CASE(OnnxInferenceServiceFailureReachesAllCallers) {
+  constexpr std::size_t nCallers = 3;
+
+  std::size_t nCalls = 0;
+  OnnxInferenceService::Config cfg;
+  cfg.maxBatchSize = nCallers;
+  cfg.maxLatency = 60s;
+  OnnxInferenceService service(
+      [&](std::span<float> /*input*/, std::size_t /*batchSize*/,
+          std::span<float> /*output*/) {
+        ++nCalls;
+        throw std::runtime_error("inference failed");
+      },
+      kInputSize, kOutputSize, cfg);
+
+  // The assertions are evaluated on the main thread
+  std::vector<std::exception_ptr> errors(nCallers);
+  std::vector<std::thread> callers;
+  for (std::size_t c = 0; c < nCallers; ++c) {
+    callers.emplace_back([&, c]() {
+      try {
+        service.runONNXInference(makeInput(1, 0.f));
+      } catch (...) {
+        errors[c] = std::current_exception();
+      }
+    });
+  }
+  for (std::thread& caller : callers) {
+    caller.join();
+  }
+
+  BOOST_CHECK_EQUAL(nCalls, 1u);
+  for (const std::exception_ptr& error : errors) {
+    BOOST_REQUIRE(error != nullptr);
+    BOOST_CHECK_THROW(std::rethrow_exception(error), std::runtime_error);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(OnnxInferenceServiceInvalidInput) {
+  SumModel model;
+  OnnxInferenceService::Config cfg;
+  BOOST_CHECK_THROW(OnnxInferenceService(nullptr, kInputSize, kOutputSize, cfg),
+                    std::invalid_argument);
+  cfg.maxBatchSize = 0;
+  BOOST_CHECK_THROW(
+      OnnxInferenceService(model.function(), kInputSize, kOutputSize, cfg),
+      std::invalid_argument);
+
+  cfg.maxBatchSize = 10;
+  OnnxInferenceService service(model.function(), kInputSize, kOutputSize,
+                               cfg);
+  BOOST_CHECK(service.runONNXInference(NetworkBatchInput(0, kInputSize))
+                  .empty());
+  BOOST_CHECK_THROW(service.runONNXInference(NetworkBatchInput(1, 3)),
+                    std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace ActsTests
@@ -0,0 +1,64 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "ActsPlugins/Onnx/OnnxRuntimeBase.hpp"
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include <onnxruntime_cxx_api.h>
+
+using namespace ActsPlugins;
+
+namespace ActsTests {
+
+BOOST_AUTO_TEST_SUITE(OnnxSuite)
+
+BOOST_AUTO_TEST_CASE(OnnxRuntimeBaseBufferInference) {
+  Ort::Env env(ORT_LOGGING_LEVEL_WARNING, "OnnxRuntimeBaseTests");
+  OnnxRuntimeBase model(env, ACTS_ONNX_TEST_MODEL);
+
+  constexpr std::size_t nEntries = 5;
+  const std::size_t inputSize = model.inputSize();
+  const std::size_t outputSize = model.outputSize();
+  BOOST_REQUIRE_GT(inputSize, 0u);
+  BOOST_REQUIRE_GT(outputSize, 0u);
+
+  NetworkBatchInput input(nEntries, inputSize);
+  for (std::size_t i = 0; i < nEntries; ++i) {
+    for (std::size_t j = 0; j < inputSize; ++j) {
+      input(i, j) = 0.1f * static_cast<float>(i + 1) - 0.05f * j;
+    }
+  }
+  const std::vector<std::vector<float>> expected =
+      model.runONNXInference(input);
+  BOOST_REQUIRE_EQUAL(expected.size(), nEntries);
+
+  // The buffers are reused between calls, also for smaller batches
+  std::vector<float> inputBuffer(input.data(), input.data() + input.size());
+  std::vector<float> outputBuffer(nEntries * outputSize, -1.f);
+  for (std::size_t batchSize : {nEntries, nEntries - 2}) {
+    model.runONNXInference(
+        std::span(inputBuffer.data(), batchSize * inputSize), batchSize,
+        std::span(outputBuffer.data(), batchSize * outputSize));
+    for (std::size_t i = 0; i < batchSize; ++i) {
+      BOOST_REQUIRE_EQUAL(expected[i].size(), outputSize);
+      for (std::size_t j = 0; j < outputSize; ++j) {
+        BOOST_CHECK_CLOSE(outputBuffer[i * outputSize + j], expected[i][j],
+                          1e-4);
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace ActsTests